@@ -51,6 +51,26 @@ void AppController::goSettings() {
 }
 
 void AppController::handleEvent(const ButtonEvent& e) {
+    // Реакция на кнопку — в ближайшем кадре, не ждём targetFps().
+    // Экран, который сейчас получит событие, — ключ замера задержки;
+    // что обработчик пометил к перерисовке — его реакция.
+    _sm.noteInput(e);
+    _sm.requestFrame();
+
+    dispatch(e);
+
+    _sm.noteHandled();
+}
+
+void AppController::dispatch(const ButtonEvent& e) {
+    // =========================================================
+    // GLOBAL: LEFT+RIGHT -> debug HUD
+    // =========================================================
+    if (e.type == ButtonEventType::CHORD) {
+        _sm.toggleDebugOverlay();
+        return;
+    }
+
     // =========================================================
     // GLOBAL: LONG OK -> Settings (из любого экрана)
     // =========================================================
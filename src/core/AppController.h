@@ -38,6 +38,9 @@ private:
         SETTINGS
     };
 
+    // Маршрут события; handleEvent() оборачивает его замером задержки
+    void dispatch(const ButtonEvent& e);
+
     void goClock();
     void goForecast();
     void goSettings();
@@ -0,0 +1,95 @@
+#include "core/EventBus.h"
+
+// ============================================================================
+// EventBus
+// ============================================================================
+EventBus::EventBus()
+    : _wakeMask(0)
+{
+    for (uint8_t i = 0; i < N; i++) {
+        _v[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void EventBus::begin() {
+    _waiter = xTaskGetCurrentTaskHandle();
+}
+
+void EventBus::publish(UiChannel ch) {
+    const uint8_t i = (uint8_t)ch;
+    if (i >= N) return;
+
+    // 0 — "ещё ничего не было" у свежего подписчика; переполнение его пропускает
+    if (_v[i].fetch_add(1, std::memory_order_release) + 1 == 0) {
+        _v[i].fetch_add(1, std::memory_order_release);
+    }
+
+    if (_waiter &&
+        (_wakeMask.load(std::memory_order_relaxed) & channelBit(ch)) &&
+        xTaskGetCurrentTaskHandle() != _waiter) {
+        xTaskNotifyGive(_waiter);
+    }
+}
+
+uint32_t EventBus::version(UiChannel ch) const {
+    const uint8_t i = (uint8_t)ch;
+    return i < N ? _v[i].load(std::memory_order_acquire) : 0;
+}
+
+void EventBus::wakeOn(ChannelMask mask) {
+    _wakeMask.store(mask, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Subscriber
+// ============================================================================
+EventBus::Subscriber::Subscriber(const EventBus& bus, ChannelMask mask)
+    : _bus(bus)
+    , _mask(mask)
+{
+    // Глобальные объекты: шина может быть ещё не построена — не читаем её
+    for (uint8_t i = 0; i < N; i++) _seen[i] = 0;
+}
+
+ChannelMask EventBus::Subscriber::poll() {
+    ChannelMask out = 0;
+
+    for (uint8_t i = 0; i < N; i++) {
+        if (!(_mask & (1u << i))) continue;
+
+        const uint32_t v = _bus.version((UiChannel)i);
+        if (v != _seen[i]) {
+            _seen[i] = v;
+            out |= (ChannelMask)(1u << i);
+        }
+    }
+    return out;
+}
+
+bool EventBus::Subscriber::changed(UiChannel ch) {
+    const uint8_t i = (uint8_t)ch;
+    if (i >= N || !(_mask & channelBit(ch))) return false;
+
+    const uint32_t v = _bus.version(ch);
+    if (v == _seen[i]) return false;
+
+    _seen[i] = v;
+    return true;
+}
+
+ChannelMask EventBus::Subscriber::pending() const {
+    ChannelMask out = 0;
+
+    for (uint8_t i = 0; i < N; i++) {
+        if ((_mask & (1u << i)) && _bus.version((UiChannel)i) != _seen[i]) {
+            out |= (ChannelMask)(1u << i);
+        }
+    }
+    return out;
+}
+
+void EventBus::Subscriber::sync() {
+    for (uint8_t i = 0; i < N; i++) {
+        _seen[i] = _bus.version((UiChannel)i);
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+/*
+ * EventBus
+ * --------
+ * Публикация / подписка для реактивной перерисовки UI.
+ *
+ * Идея:
+ *  - сервис (WiFi/Time/Theme/Screen/Forecast...) делает publish(channel)
+ *  - у каждого читателя СВОЙ Subscriber: маска каналов + курсор
+ *    (последняя увиденная версия) на канал
+ *  - чтение "потребляет" изменение только для этого подписчика:
+ *    ForecastScreen больше не крадёт THEME/SCREEN у остальных
+ *
+ * Потоки:
+ *  - версии каналов — std::atomic<uint32_t>: publish() безопасен
+ *    из ForecastTask / ServiceTask (ядро 0) и любых других задач
+ *  - Subscriber — объект ОДНОЙ задачи (курсоры не атомарные)
+ *
+ * Ожидание:
+ *  - wakeOn(mask): publish() канала из маски ИЗ ДРУГОЙ задачи будит
+ *    задачу loop() (ту, что вызвала begin()) — Scheduler::idle()
+ *    возвращается, не дожидаясь дедлайна
+ *  - публикация из самой loop() не будит: она и так не спит
+ */
+
+enum class UiChannel : uint8_t {
+    WIFI_STATE = 0,    // состояние / RSSI / SSID
+    WIFI_LIST,         // результаты скана
+    TIME,
+    THEME,
+    SCREEN,
+    DHT,
+    FORECAST,          // новая попытка загрузки (ForecastTask)
+    CLOCK,             // снимок часов ядра 0: новая секунда / время provider
+    COUNT
+};
+
+typedef uint16_t ChannelMask;
+
+static constexpr ChannelMask channelBit(UiChannel ch) {
+    return (ChannelMask)(1u << (uint8_t)ch);
+}
+
+static constexpr ChannelMask CHANNELS_ALL =
+    (ChannelMask)((1u << (uint8_t)UiChannel::COUNT) - 1);
+
+class EventBus {
+public:
+    static constexpr uint8_t N = (uint8_t)UiChannel::COUNT;
+
+    EventBus();
+
+    // Запоминает задачу loop() для wakeOn (звать из setup())
+    void begin();
+
+    // Сигнал "что-то поменялось" (любая задача / ядро)
+    void publish(UiChannel ch);
+
+    // Текущая версия канала
+    uint32_t version(UiChannel ch) const;
+
+    // Каналы, публикация которых будит loop() из сна
+    void wakeOn(ChannelMask mask);
+
+    // ------------------------------------------------------------------------
+    // Subscriber — курсор одного читателя
+    // ------------------------------------------------------------------------
+    class Subscriber {
+    public:
+        Subscriber(const EventBus& bus, ChannelMask mask);
+
+        // Изменившиеся каналы маски с прошлого чтения (и отметить увиденными)
+        ChannelMask poll();
+
+        // Один канал: true, если изменился (двигает только его курсор)
+        bool changed(UiChannel ch);
+
+        // Без потребления
+        ChannelMask pending() const;
+
+        // Забыть накопленное (например, в begin() экрана)
+        void sync();
+
+    private:
+        const EventBus& _bus;
+        ChannelMask     _mask;
+        uint32_t        _seen[N];
+    };
+
+private:
+    std::atomic<uint32_t> _v[N];
+
+    TaskHandle_t             _waiter = nullptr;
+    std::atomic<uint32_t>    _wakeMask;   // 32 бита: нативный атомик Xtensa
+};
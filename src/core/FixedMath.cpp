@@ -0,0 +1,37 @@
+#include "core/FixedMath.h"
+
+// ============================================================================
+// sin: четверть волны, 64 отрезка (65 точек), Q15
+// ============================================================================
+static const int16_t SIN_QUARTER[65] = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767
+};
+
+int16_t sinQ15(uint16_t phase) {
+
+    // phase: [квадрант:2][индекс:6][доля:8]
+    const uint8_t quadrant = (uint8_t)(phase >> 14);
+    uint16_t      p        = (uint16_t)(phase & 0x3FFF);
+
+    // 2-я и 4-я четверти — зеркало по X
+    if (quadrant & 1) p = (uint16_t)(0x4000 - p);
+
+    const uint8_t idx  = (uint8_t)(p >> 8);
+    const int32_t frac = (int32_t)(p & 0xFF);
+
+    int32_t v = SIN_QUARTER[idx];
+    if (idx < 64) {
+        v += ((SIN_QUARTER[idx + 1] - v) * frac) >> 8;
+    }
+
+    // 3-я и 4-я четверти — отрицательные
+    return (int16_t)((quadrant & 2) ? -v : v);
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * FixedMath
+ * ---------
+ * Целочисленная математика для покадровых путей (анимации, easing).
+ *
+ * Форматы:
+ *  - Q16: int32_t, 1.0 == 65536 (прогресс, коэффициенты 0..1)
+ *  - Q15: int16_t, 1.0 == 32767 (sin)
+ *  - фаза: uint16_t, полный круг 0..65535 == 0..2π
+ *
+ * Зачем:
+ *  - sinf / float easing на каждом кадре — лишние десятки тактов
+ *    на вызов; здесь — таблица + умножение
+ *  - одна реализация smoothstep вместо копий по экранам
+ *
+ * Точность (против float-версий):
+ *  - sinQ15: четверть волны, 64 отрезка + линейная интерполяция,
+ *    ошибка < 0.00012 (≈ 4 LSB Q15)
+ *  - smoothstep / pulse: ошибка < 0.0001 (усечение в умножениях)
+ */
+
+typedef int32_t q16_t;
+
+static constexpr q16_t Q16_ONE  = 65536;
+static constexpr q16_t Q16_HALF = 32768;
+
+// ============================================================================
+// basic
+// ============================================================================
+static inline q16_t q16Clamp01(q16_t v) {
+    return v < 0 ? 0 : (v > Q16_ONE ? Q16_ONE : v);
+}
+
+static inline q16_t q16Mul(q16_t a, q16_t b) {
+    return (q16_t)(((int64_t)a * (int64_t)b) >> 16);
+}
+
+// num / den в Q16, без клампа (den > 0)
+static inline q16_t q16Div(int32_t num, int32_t den) {
+    return (q16_t)(((int64_t)num << 16) / den);
+}
+
+static inline q16_t q16Lerp(q16_t a, q16_t b, q16_t t) {
+    return a + q16Mul(b - a, t);
+}
+
+// 0..1 → 0..255 с округлением (alpha для blend565)
+static inline uint8_t q16ToU8(q16_t v) {
+    v = q16Clamp01(v);
+    return (uint8_t)(((uint32_t)v * 255u + (uint32_t)Q16_HALF) >> 16);
+}
+
+// Округление к целому (для координат)
+static inline int32_t q16Round(q16_t v) {
+    return (v + Q16_HALF) >> 16;
+}
+
+// ============================================================================
+// easing (вход и выход — 0..1 в Q16, вход клампится)
+// ============================================================================
+static inline q16_t smoothstepQ16(q16_t t) {
+    t = q16Clamp01(t);
+    // t^2 * (3 - 2t)
+    return q16Mul(q16Mul(t, t), 3 * Q16_ONE - 2 * t);
+}
+
+static inline q16_t outQuadQ16(q16_t t) {
+    t = q16Clamp01(t);
+    return q16Mul(t, 2 * Q16_ONE - t);
+}
+
+// ============================================================================
+// trig
+// ============================================================================
+int16_t sinQ15(uint16_t phase);
+
+// 0.5 + 0.5 * sin(2πt), t — доля периода в Q16
+static inline q16_t pulseQ16(q16_t t) {
+    // 1.0 == полный круг; 0.5 * sin в Q16 == sin в Q15
+    return Q16_HALF + (q16_t)sinQ15((uint16_t)(uint32_t)t);
+}
@@ -0,0 +1,198 @@
+#include "core/InputLatency.h"
+#include <ctype.h>
+#include <string.h>
+
+static const char* const SCREEN_NAMES[InputLatency::SCREENS] = {
+    "clock", "forecast", "settings", "other"
+};
+
+static const char* const BUTTON_NAMES[4] = { "left", "right", "ok", "back" };
+static const char* const TYPE_NAMES[3]   = { "short", "long", "chord" };
+
+// ============================================================================
+// сбор
+// ============================================================================
+void InputLatency::begin(const ButtonEvent& e, UiTag screen) {
+
+    // Очередь полна — самый старый замер теряем (кадра так и не было)
+    if (_pendingCount >= PENDING) {
+        memmove(&_pending[0], &_pending[1], sizeof(Pending) * (PENDING - 1));
+        _pendingCount--;
+        _noReaction++;
+    }
+
+    Pending& p = _pending[_pendingCount++];
+    p.us     = e.us;
+    p.watch  = UiRect{ 0, 0, 0, 0 };
+    p.screen = screenIndex(screen);
+    p.action = (uint8_t)((uint8_t)e.id * 3 + (uint8_t)e.type);
+    p.armed  = false;
+}
+
+void InputLatency::handled(const UiRect& watch) {
+
+    uint8_t keep = 0;
+    for (uint8_t i = 0; i < _pendingCount; i++) {
+        Pending& p = _pending[i];
+
+        if (!p.armed) {
+            // Обработчик ничего не объявил грязным — кадр-реакции не будет
+            if (watch.empty()) {
+                _noReaction++;
+                continue;
+            }
+            p.watch = watch;
+            p.armed = true;
+        }
+        _pending[keep++] = p;
+    }
+    _pendingCount = keep;
+}
+
+bool InputLatency::onFrame(const UiRect& flushed, uint32_t doneUs) {
+
+    if (_pendingCount == 0) return false;
+
+    bool closed = false;
+
+    uint8_t keep = 0;
+    for (uint8_t i = 0; i < _pendingCount; i++) {
+        const Pending& p = _pending[i];
+
+        // Кадр задел область реакции — она на экране
+        if (p.armed && !flushed.empty() && p.watch.intersects(flushed)) {
+            record(p, doneUs - p.us);
+            closed = true;
+            continue;
+        }
+
+        // Слишком старые — не ждём
+        if (doneUs - p.us > NO_REACTION_US) {
+            _noReaction++;
+            continue;
+        }
+        _pending[keep++] = p;
+    }
+    _pendingCount = keep;
+    return closed;
+}
+
+void InputLatency::record(const Pending& p, uint32_t latencyUs) {
+
+    Cell& c = _cells[p.screen][p.action];
+
+    uint16_t& h = c.hist[bucketOf(latencyUs)];
+    if (h < 0xFFFF) h++;
+    if (c.count < 0xFFFF) c.count++;
+    if (latencyUs > c.maxUs) c.maxUs = latencyUs;
+
+    _lastUs = latencyUs;
+    label(p.screen, p.action, _lastLabel);
+}
+
+void InputLatency::reset() {
+    memset(_cells, 0, sizeof(_cells));
+    _noReaction = 0;
+}
+
+// ============================================================================
+// helpers
+// ============================================================================
+char InputLatency::screenLetter(UiTag screen) {
+    return (char)toupper(SCREEN_NAMES[screenIndex(screen)][0]);
+}
+
+void InputLatency::screenHist(UiTag screen, uint16_t out[BUCKETS]) const {
+    memset(out, 0, sizeof(uint16_t) * BUCKETS);
+
+    const uint8_t s = screenIndex(screen);
+    for (uint8_t a = 0; a < ACTIONS; a++) {
+        for (uint8_t b = 0; b < BUCKETS; b++) {
+            const uint32_t sum = (uint32_t)out[b] + _cells[s][a].hist[b];
+            out[b] = sum > 0xFFFF ? 0xFFFF : (uint16_t)sum;
+        }
+    }
+}
+
+uint8_t InputLatency::screenIndex(UiTag t) {
+    switch (t) {
+        case UiTag::CLOCK:    return 0;
+        case UiTag::FORECAST: return 1;
+        case UiTag::SETTINGS: return 2;
+        default:              return 3;
+    }
+}
+
+uint8_t InputLatency::bucketOf(uint32_t us) {
+    const uint32_t ms = us / 1000;
+
+    uint8_t b = 0;
+    while (b < BUCKETS - 1 && ms >= bucketMs(b)) b++;
+    return b;
+}
+
+// "F:R.s" — экран, кнопка, тип (HUD)
+void InputLatency::label(uint8_t screen, uint8_t action, char out[8]) {
+    out[0] = (char)toupper(SCREEN_NAMES[screen][0]);
+    out[1] = ':';
+    out[2] = (char)toupper(BUTTON_NAMES[action / 3][0]);
+    out[3] = '.';
+    out[4] = TYPE_NAMES[action % 3][0];
+    out[5] = 0;
+}
+
+// Корзина, в которую попал pct-й перцентиль
+uint8_t InputLatency::percentileBucket(const Cell& c, uint8_t pct) const {
+    const uint32_t target = ((uint32_t)c.count * pct + 99) / 100;
+
+    uint32_t acc = 0;
+    for (uint8_t b = 0; b < BUCKETS; b++) {
+        acc += c.hist[b];
+        if (acc >= target) return b;
+    }
+    return BUCKETS - 1;
+}
+
+// " p90<8ms"; последняя корзина открыта — " p90>=1024ms"
+void InputLatency::printBucket(Print& out, const char* name, uint8_t b) {
+    if (b == BUCKETS - 1) {
+        out.printf(" %s>=%ums", name, (unsigned)bucketMs(BUCKETS - 2));
+    } else {
+        out.printf(" %s<%ums", name, (unsigned)bucketMs(b));
+    }
+}
+
+// ============================================================================
+// dump
+// ============================================================================
+void InputLatency::dump(Print& out) const {
+
+    out.printf("[LAT] buckets <4..<%ums x2, >=%ums, pending=%u noReaction=%u\n",
+               (unsigned)bucketMs(BUCKETS - 2),
+               (unsigned)bucketMs(BUCKETS - 2),
+               (unsigned)_pendingCount,
+               (unsigned)_noReaction);
+
+    for (uint8_t s = 0; s < SCREENS; s++) {
+        for (uint8_t a = 0; a < ACTIONS; a++) {
+            const Cell& c = _cells[s][a];
+            if (c.count == 0) continue;
+
+            out.printf(
+                "[LAT] %-8s %-5s %-5s n=%u",
+                SCREEN_NAMES[s],
+                BUTTON_NAMES[a / 3],
+                TYPE_NAMES[a % 3],
+                (unsigned)c.count
+            );
+            printBucket(out, "p50", percentileBucket(c, 50));
+            printBucket(out, "p90", percentileBucket(c, 90));
+            out.printf(" max=%ums hist=", (unsigned)(c.maxUs / 1000));
+
+            for (uint8_t b = 0; b < BUCKETS; b++) {
+                out.printf(b ? ",%u" : "%u", (unsigned)c.hist[b]);
+            }
+            out.print('\n');
+        }
+    }
+}
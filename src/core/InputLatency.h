@@ -0,0 +1,107 @@
+#pragma once
+#include <Arduino.h>
+
+#include "input/Buttons.h"
+#include "ui/DirtyRegion.h"
+#include "ui/UiTag.h"
+
+/*
+ * InputLatency
+ * ------------
+ * Press-to-photon: от момента события кнопки до конца flush кадра,
+ * который на него ответил.
+ *
+ * Как меряем:
+ *  - ButtonEvent::us — момент события по фронтам (Buttons): short —
+ *    фронт отпускания, long / chord — момент, когда удержание дотянуло
+ *  - AppController отдаёт событие в ScreenManager::noteInput() ДО
+ *    обработки экраном; экран, который его получил, — ключ замера
+ *  - сразу ПОСЛЕ обработчика ScreenManager::noteHandled() берёт
+ *    регионы, которые обработчик добавил в dirty, и зону экрана,
+ *    если тот принял изменение (Screen::redrawPending), — область
+ *    реакции (handled); update() слоёв ради замера не зовётся
+ *  - замер закрывает кадр, flush которого задел эту область
+ *    (onFrame); чужие кадры (пульс двоеточия, статус-бар) — нет
+ *  - обработчик ничего не объявил грязным, или кадр с областью не
+ *    ушёл за NO_REACTION_US — не замер, счётчик noReaction()
+ *
+ * Гистограммы:
+ *  - ячейка на пару (экран, действие); действие = кнопка x тип
+ *  - корзины по степеням двойки: <4, <8, ... <1024 мс, последняя —
+ *    ">=1024"; p50/p90 — граница корзины, в которую попали
+ *
+ * ПАМЯТЬ:
+ *  - фиксированная: SCREENS * ACTIONS ячеек, без heap
+ */
+class InputLatency {
+public:
+    static constexpr uint8_t SCREENS = 4;   // clock / forecast / settings / other
+    static constexpr uint8_t ACTIONS = 4 * 3;
+    static constexpr uint8_t BUCKETS = 10;
+    static constexpr uint8_t PENDING = 4;
+
+    static constexpr uint32_t NO_REACTION_US = 2000000;
+
+    struct Cell {
+        uint16_t hist[BUCKETS];
+        uint16_t count;
+        uint32_t maxUs;
+    };
+
+    // Событие принято экраном screen — ждём конца обработчика
+    void begin(const ButtonEvent& e, UiTag screen);
+
+    // Обработчик отработал; watch — что он объявил грязным
+    // (пусто — видимой реакции не будет)
+    void handled(const UiRect& watch);
+
+    // Кадр закончил flush области flushed в doneUs.
+    // true — закрыт хотя бы один замер.
+    bool onFrame(const UiRect& flushed, uint32_t doneUs);
+
+    // Последний закрытый замер (для HUD)
+    uint32_t    lastUs()    const { return _lastUs; }
+    const char* lastLabel() const { return _lastLabel; }
+
+    uint32_t noReaction() const { return _noReaction; }
+
+    // Гистограмма экрана по всем действиям (для HUD)
+    void screenHist(UiTag screen, uint16_t out[BUCKETS]) const;
+    static char screenLetter(UiTag screen);
+
+    // "[LAT] экран действие n= p50<4ms p90>=1024ms max= hist=..." по ячейке
+    void dump(Print& out) const;
+    void reset();
+
+    // Верхняя граница корзины b < BUCKETS - 1, мс.
+    // Последняя открыта: ">= bucketMs(BUCKETS - 2)".
+    static uint32_t bucketMs(uint8_t b) { return 4u << b; }
+
+private:
+    struct Pending {
+        uint32_t us;
+        UiRect   watch;    // область реакции (после handled)
+        uint8_t  screen;
+        uint8_t  action;
+        bool     armed;    // обработчик отработал
+    };
+
+    static uint8_t screenIndex(UiTag t);
+    static uint8_t bucketOf(uint32_t us);
+    static void    label(uint8_t screen, uint8_t action, char out[8]);
+
+    void     record(const Pending& p, uint32_t latencyUs);
+    uint8_t  percentileBucket(const Cell& c, uint8_t pct) const;
+    static void printBucket(Print& out, const char* name, uint8_t b);
+
+private:
+    Cell _cells[SCREENS][ACTIONS] = {};
+
+    Pending _pending[PENDING] = {};
+    uint8_t _pendingCount = 0;
+
+    uint32_t _noReaction = 0;
+
+    uint32_t _lastUs = 0;
+    char     _lastLabel[8] = {};
+};
@@ -0,0 +1,73 @@
+#include "core/PowerManager.h"
+
+// ============================================================================
+// PowerManager
+// ============================================================================
+void PowerManager::begin(bool allowLightSleep) {
+
+    (void)allowLightSleep;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t cfg;
+    cfg.max_freq_mhz       = MAX_MHZ;
+    cfg.min_freq_mhz       = MIN_MHZ;
+    cfg.light_sleep_enable = false;
+
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    cfg.light_sleep_enable = allowLightSleep;
+#endif
+
+    if (esp_pm_configure(&cfg) == ESP_OK) {
+        _mode = cfg.light_sleep_enable ? LIGHT_SLEEP : DFS;
+    }
+#endif
+}
+
+const char* PowerManager::modeName() const {
+    switch (_mode) {
+        case DFS:         return "dfs";
+        case LIGHT_SLEEP: return "light-sleep";
+        default:          return "off";
+    }
+}
+
+void PowerManager::dump(Print& out) const {
+    out.printf("[PWR] mode=%s cpu=%uMHz\n",
+               modeName(),
+               (unsigned)getCpuFrequencyMhz());
+}
+
+// ============================================================================
+// AwakeLock
+// ============================================================================
+void AwakeLock::begin() {
+#if CONFIG_PM_ENABLE
+    if (!_lock && esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, _name, &_lock) != ESP_OK) {
+        _lock = nullptr;
+    }
+    if (_lock) esp_pm_lock_acquire(_lock);
+#endif
+
+    _windowStartUs = micros();
+}
+
+void AwakeLock::sleep() {
+#if CONFIG_PM_ENABLE
+    if (_lock) esp_pm_lock_release(_lock);
+#endif
+
+    _sleepStartUs = micros();
+}
+
+void AwakeLock::wake() {
+    _asleepUs += micros() - _sleepStartUs;
+
+#if CONFIG_PM_ENABLE
+    if (_lock) esp_pm_lock_acquire(_lock);
+#endif
+}
+
+void AwakeLock::resetStats() {
+    _asleepUs      = 0;
+    _windowStartUs = micros();
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <Arduino.h>
+
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+/*
+ * PowerManager
+ * ------------
+ * Что делает чип, пока задачи ждут дедлайнов.
+ *
+ * Режимы (выбираются в begin() по тому, с чем собран SDK):
+ *  - OFF        — SDK без CONFIG_PM_ENABLE: ожидание = блок задачи
+ *                 (ulTaskNotifyTake), частота не меняется
+ *  - DFS        — блок задачи + CPU на MIN_MHZ, пока ни одна задача
+ *                 не держит AwakeLock (APB остаётся 80 МГц: SPI, LEDC,
+ *                 UART не замечают)
+ *  - LIGHT_SLEEP — DFS + автоматический light sleep в idle FreeRTOS.
+ *                 Только по запросу и при CONFIG_FREERTOS_USE_TICKLESS_IDLE:
+ *                 LEDC подсветки на APB в light sleep останавливается,
+ *                 а пробуждение по GPIO — уровнем, что заменяет фронты
+ *                 Buttons
+ *
+ * AwakeLock:
+ *  - у каждой задачи свой; держится, пока задача работает, и
+ *    отпускается на время ожидания (Scheduler::idle, ServiceCore)
+ *  - заодно — учёт "спит / не спит" для счётчиков энергии
+ */
+class PowerManager {
+public:
+    enum Mode : uint8_t {
+        OFF = 0,
+        DFS,
+        LIGHT_SLEEP
+    };
+
+    static constexpr int MAX_MHZ = 240;
+    static constexpr int MIN_MHZ = 80;
+
+    // Звать в начале setup(), до создания AwakeLock
+    void begin(bool allowLightSleep = false);
+
+    Mode        mode() const { return _mode; }
+    const char* modeName() const;
+
+    // "[PWR] mode= cpu=MHz"
+    void dump(Print& out) const;
+
+private:
+    Mode _mode = OFF;
+};
+
+// ============================================================================
+// AwakeLock — полная частота, пока задача не ждёт
+// ============================================================================
+class AwakeLock {
+public:
+    explicit AwakeLock(const char* name) : _name(name) {}
+
+    // Создать и взять (звать из своей задачи)
+    void begin();
+
+    // Вокруг блокирующего ожидания
+    void sleep();
+    void wake();
+
+    // Время в ожидании за окно до resetStats()
+    uint32_t asleepUs() const { return _asleepUs; }
+    uint32_t windowUs() const { return micros() - _windowStartUs; }
+    void     resetStats();
+
+private:
+    const char* _name;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t _lock = nullptr;
+#endif
+
+    uint32_t _sleepStartUs  = 0;
+    uint32_t _asleepUs      = 0;
+    uint32_t _windowStartUs = 0;
+};
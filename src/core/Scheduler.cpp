@@ -0,0 +1,195 @@
+#include "core/Scheduler.h"
+
+TaskHandle_t  Scheduler::s_waiter    = nullptr;
+volatile bool Scheduler::s_inputWake = false;
+
+// ============================================================================
+// setup
+// ============================================================================
+void Scheduler::begin() {
+    s_waiter       = xTaskGetCurrentTaskHandle();
+    _windowStartMs = millis();
+}
+
+Scheduler::Id Scheduler::add(
+    const char* name,
+    uint32_t    periodMs,
+    TaskFn      fn,
+    void*       ctx,
+    uint32_t    firstDelayMs
+) {
+    if (_count >= MAX_TASKS || !fn) return NONE;
+
+    Task& t = _tasks[_count];
+    t.name     = name;
+    t.fn       = fn;
+    t.ctx      = ctx;
+    t.periodMs = periodMs ? periodMs : 1;
+    t.dueMs    = millis() + firstDelayMs;
+    t.st       = TaskStats{ 0, 0, 0 };
+
+    return (Id)_count++;
+}
+
+void Scheduler::setPeriod(Id id, uint32_t periodMs) {
+    if (id < 0 || id >= _count) return;
+    _tasks[id].periodMs = periodMs ? periodMs : 1;
+}
+
+void Scheduler::runNow(Id id) {
+    if (id < 0 || id >= _count) return;
+    _tasks[id].dueMs = millis();
+}
+
+// ============================================================================
+// run
+// ============================================================================
+uint8_t Scheduler::runDue() {
+
+    uint8_t ran = 0;
+
+    for (uint8_t i = 0; i < _count; i++) {
+        Task& t = _tasks[i];
+
+        const uint32_t now = millis();
+        if ((int32_t)(now - t.dueMs) < 0) continue;
+
+        const uint32_t t0 = micros();
+        t.fn(t.ctx);
+        const uint32_t us = micros() - t0;
+
+        t.st.runs++;
+        t.st.totalUs += us;
+        if (us > t.st.maxUs) t.st.maxUs = us;
+
+        // Без дрейфа; отстали на период и больше — без догоняющей пачки
+        t.dueMs += t.periodMs;
+        if ((int32_t)(now - t.dueMs) >= 0) {
+            t.dueMs = now + t.periodMs;
+        }
+
+        ran++;
+    }
+
+    return ran;
+}
+
+uint32_t Scheduler::msUntilNext() const {
+
+    const uint32_t now  = millis();
+    uint32_t       best = 0xFFFFFFFFu;
+
+    for (uint8_t i = 0; i < _count; i++) {
+        const int32_t left = (int32_t)(_tasks[i].dueMs - now);
+        if (left <= 0) return 0;
+        if ((uint32_t)left < best) best = (uint32_t)left;
+    }
+
+    return best;
+}
+
+// ============================================================================
+// idle
+// ============================================================================
+bool Scheduler::idle(uint32_t maxMs) {
+
+    // Фронт уже пришёл, пока loop() работал — не спим
+    if (s_inputWake) {
+        s_inputWake = false;
+        _wakeups++;
+        _inputWakeups++;
+        return true;
+    }
+
+    if (maxMs == 0) return false;
+
+    if (_awake) _awake->sleep();
+
+    if (s_waiter) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(maxMs));
+    } else {
+        delay(maxMs);
+    }
+
+    if (_awake) _awake->wake();
+
+    _wakeups++;
+
+    const bool input = s_inputWake;
+    s_inputWake = false;
+    if (input) _inputWakeups++;
+
+    return input;
+}
+
+void IRAM_ATTR Scheduler::wakeFromIsr() {
+    s_inputWake = true;
+
+    if (!s_waiter) return;
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(s_waiter, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// ============================================================================
+// stats
+// ============================================================================
+const char* Scheduler::name(Id id) const {
+    return (id >= 0 && id < _count) ? _tasks[id].name : "";
+}
+
+const Scheduler::TaskStats& Scheduler::stats(Id id) const {
+    static const TaskStats EMPTY = { 0, 0, 0 };
+    return (id >= 0 && id < _count) ? _tasks[id].st : EMPTY;
+}
+
+void Scheduler::dumpStats(Print& out) const {
+
+    const uint32_t windowMs = millis() - _windowStartMs;
+
+    for (uint8_t i = 0; i < _count; i++) {
+        const Task& t = _tasks[i];
+        out.printf(
+            "[SCHED] %-10s period=%ums runs=%u cpu=%uus max=%uus\n",
+            t.name,
+            (unsigned)t.periodMs,
+            (unsigned)t.st.runs,
+            (unsigned)t.st.totalUs,
+            (unsigned)t.st.maxUs
+        );
+    }
+
+    out.printf(
+        "[SCHED] window=%ums wakeups=%u input=%u empty=%u",
+        (unsigned)windowMs,
+        (unsigned)_wakeups,
+        (unsigned)_inputWakeups,
+        (unsigned)_emptyWakeups
+    );
+
+    // Прокси энергии: доля окна, проведённая в ожидании
+    if (_awake) {
+        const uint32_t windowUs = _awake->windowUs();
+        const uint32_t permille = windowUs
+            ? (uint32_t)((uint64_t)_awake->asleepUs() * 1000u / windowUs)
+            : 0;
+        out.printf(" asleep=%u.%u%% awake=%ums",
+                   (unsigned)(permille / 10),
+                   (unsigned)(permille % 10),
+                   (unsigned)((windowUs - _awake->asleepUs()) / 1000));
+    }
+    out.print('\n');
+}
+
+void Scheduler::resetStats() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _tasks[i].st = TaskStats{ 0, 0, 0 };
+    }
+    _wakeups       = 0;
+    _inputWakeups  = 0;
+    _emptyWakeups  = 0;
+    _windowStartMs = millis();
+
+    if (_awake) _awake->resetStats();
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <Arduino.h>
+
+#include "core/PowerManager.h"
+
+/*
+ * Scheduler
+ * ---------
+ * Кооперативный планировщик сервисов по дедлайнам.
+ *
+ * Идея:
+ *  - сервис регистрирует период (мс) и функцию; loop() зовёт
+ *    runDue() — выполняются ТОЛЬКО те, чей дедлайн наступил
+ *  - millis()-бухгалтерия "не пора ли?" живёт здесь, а не в каждом
+ *    сервисе
+ *  - idle(maxMs) блокирует задачу loop() до ближайшего дедлайна
+ *    (его считает вызывающий: min(msUntilNext(), кадр UI, ...))
+ *    ИЛИ до пробуждения из прерывания (wakeFromIsr — фронт кнопки)
+ *
+ * Дедлайны:
+ *  - следующий = прошлый дедлайн + период (без накопления дрейфа)
+ *  - если задача отстала больше чем на период — следующий от "сейчас",
+ *    без пачки догоняющих запусков
+ *  - runNow(id) — выполнить на ближайшем runDue() (событие извне)
+ *
+ * Статистика (за окно до resetStats()):
+ *  - по задаче: запуски, суммарное и максимальное время CPU (мкс)
+ *  - по loop(): пробуждения всего, из них по вводу и "пустые"
+ *    (ни задача, ни кадр не понадобились)
+ *  - доля времени в idle() — если подключён AwakeLock (attachAwake):
+ *    на время ожидания он отпускается (PowerManager: DFS / light sleep)
+ *
+ * ПАМЯТЬ:
+ *  - фиксированный пул MAX_TASKS, без heap; name — строковый литерал
+ */
+
+class Scheduler {
+public:
+    typedef int8_t Id;
+    static constexpr Id NONE = -1;
+
+    static constexpr uint8_t MAX_TASKS = 12;
+
+    typedef void (*TaskFn)(void* ctx);
+
+    struct TaskStats {
+        uint32_t runs;
+        uint32_t totalUs;
+        uint32_t maxUs;
+    };
+
+    // Запоминает задачу, которую будит wakeFromIsr() (звать из setup()).
+    void begin();
+
+    // idle() отпускает lock на время ожидания и считает сон
+    void attachAwake(AwakeLock& lock) { _awake = &lock; }
+
+    // Периодическая задача; первый запуск через firstDelayMs.
+    // NONE — пул занят.
+    Id add(
+        const char* name,
+        uint32_t    periodMs,
+        TaskFn      fn,
+        void*       ctx          = nullptr,
+        uint32_t    firstDelayMs = 0
+    );
+
+    void setPeriod(Id id, uint32_t periodMs);
+    void runNow(Id id);
+
+    // Выполнить все задачи с наступившим дедлайном. Возвращает их число.
+    uint8_t runDue();
+
+    // Сколько мс до ближайшего дедлайна (0 — уже пора)
+    uint32_t msUntilNext() const;
+
+    // Блок до maxMs или до wakeFromIsr(). true — разбудил ввод.
+    bool idle(uint32_t maxMs);
+
+    // loop() проснулся зря: ни задачи, ни кадра, ни события ввода
+    void countEmptyWakeup() { _emptyWakeups++; }
+
+    // Из ISR: прервать idle() (безопасно звать и без begin())
+    static void IRAM_ATTR wakeFromIsr();
+
+    // ===== stats =====
+    uint8_t          count() const { return _count; }
+    const char*      name(Id id) const;
+    const TaskStats& stats(Id id) const;
+
+    uint32_t wakeups()      const { return _wakeups; }
+    uint32_t inputWakeups() const { return _inputWakeups; }
+    uint32_t emptyWakeups() const { return _emptyWakeups; }
+
+    // "[SCHED] name runs= cpu= max=" по строке на задачу + итог
+    void dumpStats(Print& out) const;
+    void resetStats();
+
+private:
+    struct Task {
+        const char* name;
+        TaskFn      fn;
+        void*       ctx;
+        uint32_t    periodMs;
+        uint32_t    dueMs;
+        TaskStats   st;
+    };
+
+    Task    _tasks[MAX_TASKS] = {};
+    uint8_t _count = 0;
+
+    uint32_t _wakeups      = 0;
+    uint32_t _inputWakeups = 0;
+    uint32_t _emptyWakeups = 0;
+    uint32_t _windowStartMs = 0;
+
+    AwakeLock* _awake = nullptr;
+
+    static TaskHandle_t  s_waiter;
+    static volatile bool s_inputWake;
+};
@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 #include "services/ThemeService.h"
+#include "ui/DirtyRegion.h"
+#include "ui/UiTag.h"
 
 /*
  * Screen
@@ -15,6 +17,19 @@
  * ПРАВИЛА:
  *  - Старый UI использует theme() -> Theme
  *  - Новый UI использует themeService().blend() -> ThemeBlend
+ *
+ * КАДР (компоновщик ScreenManager):
+ *  - update(dirty) — реактивная логика, НЕ рисует;
+ *                    сообщает изменившиеся прямоугольники в dirty
+ *  - draw()        — рисует ТЕКУЩЕЕ состояние своей области целиком;
+ *                    ScreenManager вызывает его для каждого грязного региона
+ *                    с выставленным clip, всё лишнее отсекается UiDisplay
+ *  - draw() может вызываться несколько раз за кадр → НЕ меняет состояние
+ *
+ * ТЕМП КАДРОВ:
+ *  - targetFps() — как часто ScreenManager вызывает update(dirty)
+ *  - пока экран анимируется → FPS_ANIM, в покое → FPS_STATIC
+ *  - ввод / смена экрана дают внеочередной кадр (requestFrame)
  */
 
 class Screen {
@@ -29,7 +44,24 @@ public:
     // Lifecycle
     // =====================================================================
     virtual void begin() {}
-    virtual void update() {}
+    // Экран уходит с дисплея (ScreenManager::set): отдать память,
+    // взятую в begin(). Следующий begin() возьмёт её снова.
+    virtual void end() {}
+    virtual void update(DirtyRegion& dirty) { (void)dirty; }
+    virtual void draw() {}
+
+    // =====================================================================
+    // Frame pacing
+    // =====================================================================
+    static constexpr uint8_t FPS_STATIC = 1;
+    static constexpr uint8_t FPS_ANIM   = 20;
+
+    virtual uint8_t targetFps() const { return FPS_STATIC; }
+
+    // Есть изменение, которое update() ещё не перевёл в dirty
+    // (ввод, данные). Без побочных эффектов: ScreenManager спрашивает
+    // до и после обработчика кнопки — так меряется реакция на ввод.
+    virtual bool redrawPending() const { return false; }
 
     // =====================================================================
     // UI flags
@@ -42,6 +74,9 @@ public:
 
     virtual bool hasStatusBar() const { return true; }
 
+    // Тег для учёта SPI-трафика (UiDisplay::traffic)
+    virtual UiTag uiTag() const { return UiTag::OTHER; }
+
     // =====================================================================
     // Theme hooks
     // =====================================================================
@@ -4,15 +4,17 @@
 // ctor
 // ============================================================================
 ScreenManager::ScreenManager(
-    Adafruit_ST7735& tft,
+    UiDisplay& tft,
     Screen& initial,
     StatusBar& statusBar,
     ButtonBar& buttonBar,
     LayoutService& layout,
     UiSeparator& sepStatus,
     UiSeparator& sepBottom,
-    UiVersionService& uiVersion,
-    ThemeService& themeService
+    EventBus& bus,
+    ThemeService& themeService,
+    UiDebugOverlay& overlay,
+    Timeline& timeline
 )
     : _tft(&tft)
     , _current(&initial)
@@ -22,21 +24,19 @@ ScreenManager::ScreenManager(
     , _layout(&layout)
     , _sepStatus(&sepStatus)
     , _sepBottom(&sepBottom)
-    , _uiVersion(&uiVersion)
     , _theme(&themeService)
+    , _overlay(&overlay)
+    , _timeline(&timeline)
+    , _events(bus, CHANNELS_ALL & ~channelBit(UiChannel::CLOCK))
+    , _bands(tft)
 {
 }
 
 // ============================================================================
 // helpers
 // ============================================================================
-void ScreenManager::clearStatusArea() {
-    if (!_tft || !_layout || !_theme) return;
-
-    const Theme& th = _theme->current();
-    const int h = _layout->statusBarY() + _layout->statusBarH();
-
-    _tft->fillRect(0, 0, _tft->width(), h, th.bg);
+void ScreenManager::invalidateAll() {
+    _dirty.add(0, 0, _tft->width(), _tft->height());
 }
 
 void ScreenManager::applyLayout() {
@@ -44,10 +44,12 @@ void ScreenManager::applyLayout() {
     const bool hasStatus  = (_current && _current->hasStatusBar());
     const bool hasButtons = (_current && _current->hasButtonBar());
 
+    const UiLayout& L = _layout->current();
+
     _sepStatus->setVisible(hasStatus);
     _sepStatus->setY(
         hasStatus
-            ? _layout->statusBarY() + _layout->statusBarH()
+            ? L.statusY + L.statusH
             : -1
     );
     _sepStatus->markDirty();
@@ -55,7 +57,7 @@ void ScreenManager::applyLayout() {
     _sepBottom->setVisible(hasButtons);
     _sepBottom->setY(
         hasButtons
-            ? _layout->buttonBarY()
+            ? L.bottomY
             : -1
     );
     _sepBottom->markDirty();
@@ -76,19 +78,20 @@ void ScreenManager::begin() {
 
     applyLayout();
 
-    // Экран полностью рисует свою область
+    // Экран сбрасывает состояние, первый flush нарисует всё
     _current->begin();
 
     // Overlay-элементы
     if (wantStatus) {
         _statusBar->markDirty();
-    } else {
-        clearStatusArea();
     }
 
     if (_buttonBar) {
         _buttonBar->markDirty();
     }
+
+    invalidateAll();
+    requestFrame();
 }
 
 // ============================================================================
@@ -96,6 +99,29 @@ void ScreenManager::begin() {
 // ============================================================================
 void ScreenManager::set(Screen& screen) {
 
+    // Снимок уходящего контента — до смены экрана.
+    // Переход во время перехода → мгновенная смена (не копим задержку).
+    const UiRect oldContent = contentZone();
+    bool captured = false;
+
+    if (_transitionsOn && _current && _current != &screen &&
+        !_xfade.active() && _xfade.reserve(oldContent)) {
+
+        _tft->beginOffscreen(oldContent, _xfade.snapshot());
+        flushRect(oldContent, _current->hasStatusBar(), _current->hasButtonBar());
+        _tft->endOffscreen();
+        _tft->resetClip();
+
+        captured = true;
+    } else {
+        _xfade.cancel();
+    }
+
+    // Снимок уже снят — уходящий экран может отдать свою память
+    if (_current && _current != &screen) {
+        _current->end();
+    }
+
     _prev = _current;
     _current = &screen;
 
@@ -116,11 +142,64 @@ void ScreenManager::set(Screen& screen) {
 
     if (wantStatus) {
         _statusBar->markDirty();
-    } else {
-        clearStatusArea();
+    }
+
+    // Новый экран — весь кадр грязный (зоны могли сдвинуться)
+    invalidateAll();
+    requestFrame();
+
+    // Зона контента сдвинулась — смешивать не с чем, снимок не нужен
+    const UiRect newContent = contentZone();
+    if (captured &&
+        newContent.x == oldContent.x && newContent.y == oldContent.y &&
+        newContent.w == oldContent.w && newContent.h == oldContent.h) {
+        _xfade.start(newContent);
+    } else if (captured) {
+        _xfade.cancel();
     }
 }
 
+// ============================================================================
+// frame pacing
+// ============================================================================
+uint32_t ScreenManager::framePeriodMs() const {
+
+    uint8_t fps = _current->targetFps();
+    if ((_xfade.active() || _timeline->anyActive()) && fps < Screen::FPS_ANIM) {
+        fps = Screen::FPS_ANIM;
+    }
+    if (fps == 0) fps = 1;
+
+    return 1000u / fps;
+}
+
+uint32_t ScreenManager::msUntilNextFrame() const {
+
+    if (!_current || _frameRequested)
+        return 0;
+
+    const uint32_t period  = framePeriodMs();
+    const uint32_t elapsed = millis() - _lastFrameMs;
+
+    return elapsed >= period ? 0 : period - elapsed;
+}
+
+void ScreenManager::accountDuty(uint32_t busyUs) {
+
+    const uint32_t now = micros();
+
+    _dutyBusyUs += busyUs;
+
+    const uint32_t window = now - _dutyWindowStartUs;
+    if (window < DUTY_WINDOW_US)
+        return;
+
+    _stats.dutyPermille = (uint16_t)(((uint64_t)_dutyBusyUs * 1000u) / window);
+
+    _dutyWindowStartUs = now;
+    _dutyBusyUs        = 0;
+}
+
 // ============================================================================
 // update (ГЛАВНЫЙ UI LOOP)
 // ============================================================================
@@ -129,6 +208,72 @@ void ScreenManager::update() {
     if (!_current)
         return;
 
+    _overlay->onLoop();
+
+    // Что-то опубликовано (в т.ч. с другого ядра) — кадр не ждёт темпа
+    if (_events.poll()) requestFrame();
+
+    // Кадр положен — строим
+    if (msUntilNextFrame() == 0) {
+
+        const uint32_t t0 = micros();
+
+        // Кадр по темпу: опоздание = (с прошлого кадра) - период
+        if (!_frameRequested) {
+            const uint32_t sinceUs  = t0 - _lastFrameUs;
+            const uint32_t periodUs = framePeriodMs() * 1000u;
+            const uint32_t late     = sinceUs > periodUs ? sinceUs - periodUs : 0;
+
+            _stats.lastJitterUs = late;
+            if (late > _stats.maxJitterUs) _stats.maxJitterUs = late;
+        }
+
+        _frameRequested = false;
+        _lastFrameMs    = millis();
+        _lastFrameUs    = t0;
+
+        renderFrame();
+        const uint32_t busy = micros() - t0;
+
+        _stats.lastFrameUs = busy;
+        accountDuty(busy);
+
+        if (_fullFrame) {
+            _fullFrame = false;
+            _stats.fullFrames++;
+            _stats.lastFullFrameUs = busy;
+        }
+
+        _overlay->onFrame(busy, _stats.lastPixels);
+
+        // Кадр, задевший область реакции, закрывает замеры ввода
+        if (_latency.onFrame(_flushed, t0 + busy)) {
+            _overlay->onInput(_latency.lastUs(), _latency.lastLabel());
+        }
+
+        // Кадр перехода слишком дорогой → остаток перехода пропускаем.
+        // Конец перехода (любой) — ещё один кадр чистого нового контента.
+        if (_xfade.active()) {
+            _xfade.advance(busy);
+            if (!_xfade.active()) {
+                _dirty.add(_xfade.area());
+                requestFrame();
+            }
+        }
+    }
+
+    // HUD — самым последним и вне замера кадра
+    drawOverlay();
+}
+
+// ============================================================================
+// один кадр: update слоёв + flush
+// ============================================================================
+void ScreenManager::renderFrame() {
+
+    // Часы анимаций — один раз на кадр, до update() слоёв
+    _timeline->tick(millis());
+
     const bool wantStatus  = _current->hasStatusBar();
     const bool wantButtons = _current->hasButtonBar();
 
@@ -138,24 +283,24 @@ void ScreenManager::update() {
     // =========================================================
     // 1️⃣ СНАЧАЛА — основной экран
     // =========================================================
-    _current->update();
+    _current->update(_dirty);
 
     // =========================================================
     // 2️⃣ Разделители (если видимы)
     // =========================================================
-    if (_sepStatus) _sepStatus->update();
-    if (_sepBottom) _sepBottom->update();
+    if (_sepStatus) _sepStatus->update(_dirty);
+    if (_sepBottom) _sepBottom->update(_dirty);
 
     // =========================================================
-    // 3️⃣ ПОСЛЕДНИМ — StatusBar (overlay)
+    // 3️⃣ StatusBar (overlay)
     //
     // 🔥 КЛЮЧЕВО:
     //  - update() вызывается ВСЕГДА
-    //  - НИКАКИХ UiVersion::changed() здесь
+    //  - НИКАКИХ подписок EventBus здесь
     //  - StatusBar сам решает, dirty он или нет
     // =========================================================
     if (wantStatus && _statusBar) {
-        _statusBar->update();
+        _statusBar->update(_dirty);
     }
 
     // =========================================================
@@ -163,10 +308,319 @@ void ScreenManager::update() {
     // =========================================================
     if (_buttonBar) {
         _buttonBar->setVisible(wantButtons);
-        if (wantButtons) {
-            _buttonBar->update();
+        _buttonBar->update(_dirty);
+    }
+
+    // =========================================================
+    // 5️⃣ Переход — контент перерисовывается каждый кадр
+    // =========================================================
+    if (_xfade.active()) {
+        _dirty.add(_xfade.area());
+    }
+
+    // =========================================================
+    // 6️⃣ Отправляем ТОЛЬКО грязные регионы
+    // =========================================================
+    flush();
+}
+
+// ============================================================================
+// flush
+// ============================================================================
+void ScreenManager::flush() {
+
+    _dirty.clip(UiRect{ 0, 0, (int16_t)_tft->width(), (int16_t)_tft->height() });
+
+    _flushed = UiRect{ 0, 0, 0, 0 };
+
+    if (_dirty.empty()) {
+        _stats.lastPixels = 0;
+        _stats.lastRects  = 0;
+        _stats.skipped++;
+        return;
+    }
+
+    const bool wantStatus  = _current->hasStatusBar();
+    const bool wantButtons = _current->hasButtonBar();
+
+    const uint32_t before = _tft->pixelsPushed();
+
+    const uint32_t screenPx = (uint32_t)_tft->width() * (uint32_t)_tft->height();
+
+    const bool   xfade   = _xfade.active();
+    const UiRect content = _xfade.area();
+
+    for (uint8_t i = 0; i < _dirty.count(); i++) {
+        const UiRect&  r  = _dirty.at(i);
+        const uint32_t px = (uint32_t)r.w * (uint32_t)r.h;
+
+        if (px == screenPx) _fullFrame = true;
+
+        _flushed = _flushed.empty() ? r : _flushed.unite(r);
+
+        if (_overlayShown && r.intersects(_overlay->rect())) _overlayDamaged = true;
+
+        // Переход: зона контента целиком уходит ниже, здесь — только
+        // то, что выше и ниже неё (зона — во всю ширину экрана)
+        if (xfade && r.intersects(content)) {
+            const UiRect above = r.intersect(UiRect{ 0, 0, (int16_t)_tft->width(), content.y });
+            const UiRect below = r.intersect(UiRect{
+                0, content.bottom(),
+                (int16_t)_tft->width(), (int16_t)(_tft->height() - content.bottom())
+            });
+            if (!above.empty()) flushRect(above, wantStatus, wantButtons);
+            if (!below.empty()) flushRect(below, wantStatus, wantButtons);
+            continue;
         }
+
+        if (_bandsOn && px >= BAND_MIN_PX) {
+            flushBanded(r, wantStatus, wantButtons);
+        } else {
+            flushRect(r, wantStatus, wantButtons);
+        }
+    }
+
+    if (xfade) {
+        flushCrossfade(wantStatus, wantButtons);
+    }
+
+    _tft->resetClip();
+
+    const uint32_t pushed = _tft->pixelsPushed() - before;
+
+    _stats.frames++;
+    _stats.lastPixels   = pushed;
+    _stats.totalPixels += pushed;
+    _stats.lastRects    = _dirty.count();
+    if (pushed > _stats.maxPixels) _stats.maxPixels = pushed;
+
+    _dirty.clear();
+}
+
+// Один регион: слои в z-order, каждый — только внутри своей зоны.
+void ScreenManager::flushRect(const UiRect& r, bool wantStatus, bool wantButtons) {
+
+    const UiLayout& L = _layout->current();
+    const int16_t   w = (int16_t)L.width;
+
+    const UiRect content = contentZone();
+    const UiRect statusZone{
+        0, (int16_t)L.statusY, w, (int16_t)L.statusH
+    };
+    const UiRect buttonZone{
+        0, (int16_t)L.bottomY, w, (int16_t)L.bottomH
+    };
+
+    UiRect c;
+
+    // 1) Screen
+    c = r.intersect(content);
+    if (!c.empty()) {
+        _tft->setClip(c);
+        _tft->setTag(_current->uiTag());
+        _current->draw();
+    }
+
+    // 2) Separators (поверх контента)
+    _tft->setClip(r);
+    _tft->setTag(UiTag::SEPARATOR);
+    if (_sepStatus) _sepStatus->draw();
+    if (_sepBottom) _sepBottom->draw();
+
+    // 3) StatusBar
+    c = r.intersect(statusZone);
+    if (wantStatus && _statusBar && !c.empty()) {
+        _tft->setClip(c);
+        _tft->setTag(UiTag::STATUSBAR);
+        _statusBar->draw();
+    }
+
+    // 4) ButtonBar
+    c = r.intersect(buttonZone);
+    if (wantButtons && _buttonBar && !c.empty()) {
+        _tft->setClip(c);
+        _tft->setTag(UiTag::BUTTONBAR);
+        _buttonBar->draw();
+    }
+
+    _tft->setTag(UiTag::OTHER);
+}
+
+UiRect ScreenManager::contentZone() const {
+    const UiLayout& L = _layout->current();
+    return UiRect{
+        0, (int16_t)L.contentY,
+        (int16_t)L.width, (int16_t)L.contentH
+    };
+}
+
+// Кадр перехода: новый контент полосами, каждая полоса смешана со снимком.
+void ScreenManager::flushCrossfade(bool wantStatus, bool wantButtons) {
+
+    _bands.render(
+        _xfade.area(),
+        _theme->current().bg,
+        [&](const UiRect& band) { flushRect(band, wantStatus, wantButtons); },
+        [&](const UiRect& band, uint16_t* px) { _xfade.blendBand(band, px); }
+    );
+}
+
+// Крупный регион: те же слои, но полосами через RAM.
+void ScreenManager::flushBanded(const UiRect& r, bool wantStatus, bool wantButtons) {
+
+    _bands.render(r, _theme->current().bg, [&](const UiRect& band) {
+        flushRect(band, wantStatus, wantButtons);
+    });
+
+    _stats.bandPasses++;
+}
+
+// ============================================================================
+// debug HUD
+// ============================================================================
+void ScreenManager::drawOverlay() {
+
+    if (!_overlay->isEnabled()) {
+        // Выключили — под HUD восстанавливаем обычный кадр
+        if (_overlayShown) {
+            _overlayShown = false;
+            _dirty.add(_overlay->rect());
+            requestFrame();
+        }
+        return;
+    }
+
+    const bool fresh = _overlay->refresh(millis());
+
+    if (fresh) {
+        const UiTag tag = _current->uiTag();
+        uint16_t hist[InputLatency::BUCKETS];
+        _latency.screenHist(tag, hist);
+        _overlay->onInputHist(InputLatency::screenLetter(tag), hist, _latency.noReaction());
+    }
+
+    if (!fresh && _overlayShown && !_overlayDamaged)
+        return;
+
+    _overlayDamaged = false;
+
+    _tft->setClip(_overlay->rect());
+    _tft->setTag(UiTag::OVERLAY);
+    _overlay->draw();
+    _tft->setTag(UiTag::OTHER);
+    _tft->resetClip();
+
+    _overlayShown = true;
+}
+
+void ScreenManager::toggleDebugOverlay() {
+    _overlay->toggle();
+
+    // Реакция аккорда — область HUD: включение рисует его поверх
+    // кадра, выключение восстанавливает кадр под ним
+    _dirty.add(_overlay->rect());
+    requestFrame();
+}
+
+void ScreenManager::noteInput(const ButtonEvent& e) {
+    _latency.begin(e, _current ? _current->uiTag() : UiTag::OTHER);
+
+    _dirtyAtInput   = _dirty;
+    _screenAtInput  = _current;
+    _pendingAtInput = _current && _current->redrawPending();
+}
+
+// Ничего не пересчитывает: update() слоёв — только в кадре
+void ScreenManager::noteHandled() {
+    if (!_current) return;
+
+    UiRect watch{ 0, 0, 0, 0 };
+
+    // Регионы, которые обработчик добавил сам (set(), HUD).
+    // Уже покрытое регионом до события — не реакция.
+    for (uint8_t i = 0; i < _dirty.count(); i++) {
+        const UiRect& r = _dirty.at(i);
+
+        bool before = false;
+        for (uint8_t j = 0; j < _dirtyAtInput.count() && !before; j++) {
+            before = _dirtyAtInput.at(j).contains(r);
+        }
+        if (before) continue;
+
+        watch = watch.empty() ? r : watch.unite(r);
+    }
+
+    // Экран принял изменение, которое update() заберёт в кадре
+    // (курсор, слайд): реакция — в его зоне
+    const bool pending = _current->redrawPending();
+    if (_current == _screenAtInput && pending && !_pendingAtInput) {
+        const UiRect content = contentZone();
+        watch = watch.empty() ? content : watch.unite(content);
+    }
+
+    _latency.handled(watch);
+}
+
+// ============================================================================
+// snapshot
+// ============================================================================
+static uint32_t crc32Update(uint32_t crc, const uint8_t* p, size_t n) {
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        for (uint8_t k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void ScreenManager::captureFrame(uint16_t* dst) {
+    if (!dst || !_current) return;
+
+    const UiRect full{ 0, 0, (int16_t)_tft->width(), (int16_t)_tft->height() };
+
+    const uint16_t bg = _theme->current().bg;
+    for (uint32_t i = 0; i < (uint32_t)full.w * (uint32_t)full.h; i++) dst[i] = bg;
+
+    _tft->beginOffscreen(full, dst);
+    flushRect(full, _current->hasStatusBar(), _current->hasButtonBar());
+    _tft->endOffscreen();
+
+    _tft->resetClip();
+}
+
+bool ScreenManager::dumpFrame(Print& out) {
+
+    const int16_t  w = _tft->width();
+    const int16_t  h = _tft->height();
+    const uint32_t n = (uint32_t)w * (uint32_t)h;
+
+    // 40 КБ на 160x128 — только на время снимка
+    uint16_t* buf = static_cast<uint16_t*>(malloc(n * sizeof(uint16_t)));
+    if (!buf) {
+        out.println("[FRAME] no memory");
+        return false;
     }
+
+    captureFrame(buf);
+
+    const uint32_t crc =
+        crc32Update(0, reinterpret_cast<const uint8_t*>(buf), n * sizeof(uint16_t));
+
+    out.printf("[FRAME] %dx%d rgb565 crc=%08X px=%u\n",
+               w, h, (unsigned)crc, (unsigned)_stats.lastPixels);
+
+    for (int16_t y = 0; y < h; y++) {
+        const uint16_t* row = buf + (uint32_t)y * w;
+        for (int16_t x = 0; x < w; x++) out.printf("%04X", row[x]);
+        out.println();
+    }
+
+    out.println("[FRAME] end");
+
+    free(buf);
+    return true;
 }
 
 // ============================================================================
@@ -186,9 +640,6 @@ bool ScreenManager::currentHasBottomBar() const {
 void ScreenManager::forceFullRedraw() {
     if (!_tft || !_theme) return;
 
-    const Theme& th = _theme->current();
-    _tft->fillScreen(th.bg);
-
     if (_current) {
         _current->begin();
     }
@@ -197,4 +648,7 @@ void ScreenManager::forceFullRedraw() {
     if (_sepBottom)  _sepBottom->markDirty();
     if (_statusBar)  _statusBar->markDirty();
     if (_buttonBar)  _buttonBar->markDirty();
+
+    invalidateAll();
+    requestFrame();
 }
\ No newline at end of file
@@ -3,13 +3,19 @@
 #include <Adafruit_ST7735.h>
 
 #include "core/Screen.h"
+#include "core/Timeline.h"
+#include "core/InputLatency.h"
+#include "ui/UiDisplay.h"
+#include "ui/BandRenderer.h"
+#include "ui/ScreenTransition.h"
+#include "ui/DirtyRegion.h"
 #include "ui/StatusBar.h"
 //#include "ui/BottomBar.h"   // legacy, не используется
 #include "ui/ButtonBar.h"
 #include "ui/UiSeparator.h"
 #include "ui/UiDebugOverlay.h"
 #include "services/LayoutService.h"
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 #include "services/ThemeService.h"
 
 /*
@@ -21,22 +27,77 @@
  *  3) StatusBar (overlay)
  *  4) ButtonBar (overlay)
  *
+ * КАДР (dirty rectangles):
+ *  1) update(dirty) у всех слоёв — они НЕ рисуют, а только
+ *     сообщают изменившиеся прямоугольники
+ *  2) DirtyRegion сливает их и обрезает по экрану
+ *  3) flush: для каждого итогового региона вызываем draw() слоёв
+ *     в z-order, clip = регион ∩ зона слоя
+ *     → каждый пиксель кадра уходит по SPI (почти) один раз
+ *  4) debug HUD (UiDebugOverlay) — после кадра, вне его замера
+ *  5) смена экрана — crossfade контента (ScreenTransition):
+ *     снимок старого контента смешивается с новым STEPS кадров
+ *  6) крупный регион (смена экрана, forceFullRedraw, очистка рабочей
+ *     области) — через BandRenderer: те же draw(), но полосами в RAM
+ *     и одним окном адреса на полосу
+ *
+ * ТЕМП:
+ *  - update() можно звать хоть каждую итерацию loop():
+ *    кадр строится не чаще, чем Screen::targetFps()
+ *  - пока в Timeline есть анимация — не реже FPS_ANIM;
+ *    Timeline::tick() — в начале каждого кадра (одни часы на кадр)
+ *  - requestFrame() — внеочередной кадр (ввод, смена экрана)
+ *  - публикация в EventBus (любой канал) — тоже внеочередной кадр:
+ *    данные ForecastTask появятся на экране сразу, а не в следующем
+ *    плановом кадре
+ *  - пустой кадр (нет dirty) ничего не шлёт и считается skipped
+ *
+ * ЗАДЕРЖКА ВВОДА (InputLatency):
+ *  - noteInput(e) — событие кнопки, которое сейчас получит экран
+ *  - noteHandled() — обработчик отработал: реакция — регионы, которые
+ *    он добавил в dirty, и зона экрана, если тот принял изменение
+ *    (Screen::redrawPending()); update() слоёв вне кадра не зовётся
+ *  - кадр, flush которого задел реакцию, закрывает замер
+ *    "фронт → конец flush" (гистограмма по экрану и действию)
+ *
  * ВАЖНО:
- *  - _tft / _theme / _uiVersion у нас ХРАНЯТСЯ как указатели (T*),
+ *  - _tft / _theme / _layout у нас ХРАНЯТСЯ как указатели (T*),
  *    поэтому доступ ТОЛЬКО через ->.
  *
  *  - Для Brightness (PWM подсветки) нужен "глобальный reset кадра":
- *      * залить весь экран bg (fillScreen)
  *      * заставить текущий экран заново отрисоваться (begin)
  *      * заставить overlays перерисоваться (markDirty)
+ *      * объявить грязным ВЕСЬ экран
  *    потому что Brightness меняет физическое состояние подсветки и
  *    частичные перерисовки оставляют визуальные артефакты.
  */
 
 class ScreenManager {
 public:
+    // Статистика компоновщика (SPI-трафик в пикселях)
+    struct FrameStats {
+        uint32_t frames;        // кадров, в которых что-то отправлено
+        uint32_t lastPixels;    // пикселей в последнем кадре
+        uint32_t maxPixels;     // максимум за всё время
+        uint64_t totalPixels;   // всего
+        uint8_t  lastRects;     // регионов в последнем кадре
+
+        uint32_t skipped;       // кадров без единого грязного пикселя
+        uint32_t lastFrameUs;   // время update+flush последнего кадра
+        uint16_t dutyPermille;  // доля CPU на UI за последнюю секунду, ‰
+
+        uint32_t fullFrames;      // кадров, перерисовавших весь экран
+        uint32_t lastFullFrameUs; // время последнего такого кадра
+        uint32_t bandPasses;      // регионов, ушедших полосами
+
+        // Джиттер: на сколько кадр по темпу опоздал к своему дедлайну
+        // (внеочередные кадры по событию не в счёт)
+        uint32_t lastJitterUs;
+        uint32_t maxJitterUs;     // худший — до resetJitter()
+    };
+
     ScreenManager(
-        Adafruit_ST7735& tft,
+        UiDisplay& tft,
         Screen& initial,
         StatusBar& statusBar,
         // BottomBar legacy — не используется
@@ -45,42 +106,132 @@ public:
         LayoutService& layout,
         UiSeparator& sepStatus,
         UiSeparator& sepBottom,
-        UiVersionService& uiVersion,
-        ThemeService& themeService
+        EventBus& bus,
+        ThemeService& themeService,
+        UiDebugOverlay& overlay,
+        Timeline& timeline
     );
 
     void begin();
     void update();
     void set(Screen& screen);
 
+    // Внеочередной кадр на ближайшем update()
+    void requestFrame() { _frameRequested = true; }
+
+    // Сколько мс до следующего кадра (0 — кадр нужен сейчас)
+    uint32_t msUntilNextFrame() const;
+
     bool currentHasStatusBar() const;
     bool currentHasBottomBar() const;
 
     // Глобальный принудительный redraw (используем после Brightness apply/cancel)
     void forceFullRedraw();
 
+    // Debug HUD вкл/выкл (аккорд кнопок)
+    void toggleDebugOverlay();
+
+    // Событие кнопки для текущего экрана: ждём кадр-реакцию
+    void noteInput(const ButtonEvent& e);
+    // Событие обработано: зафиксировать, что оно объявило грязным
+    void noteHandled();
+
+    const InputLatency& latency() const { return _latency; }
+    void resetLatency() { _latency.reset(); }
+
+    // ===== SNAPSHOT =====
+    // Текущий кадр теми же draw() слоёв — в RAM, в дисплей ничего
+    // не уходит. dst: width() * height() пикселей RGB565.
+    void captureFrame(uint16_t* dst);
+
+    // Снимок в Serial: заголовок с CRC32 + строки hex RGB565.
+    // CRC — "золотой" отпечаток кадра для сравнения до/после.
+    // false — не хватило heap под буфер.
+    bool dumpFrame(Print& out);
+
+    const FrameStats& stats() const { return _stats; }
+    void resetJitter() { _stats.maxJitterUs = 0; }
+
+    // Crossfade при смене экрана (по умолчанию включён)
+    void setTransitions(bool on) { _transitionsOn = on; if (!on) _xfade.cancel(); }
+    const ScreenTransition& transition() const { return _xfade; }
+
+    // Полосы для крупных регионов (по умолчанию включены).
+    // Выключение — для сравнения времени полного кадра "до/после".
+    void setBandRendering(bool on) { _bandsOn = on; }
+    bool bandRendering() const     { return _bandsOn; }
+
 private:
     void applyLayout();
-    void clearStatusArea();
+    void invalidateAll();
+
+    uint32_t framePeriodMs() const;
+
+    void renderFrame();
+    void accountDuty(uint32_t busyUs);
+
+    void flush();
+    void flushRect(const UiRect& r, bool wantStatus, bool wantButtons);
+    void flushBanded(const UiRect& r, bool wantStatus, bool wantButtons);
+
+    void drawOverlay();
+
+    UiRect contentZone() const;
+    void   flushCrossfade(bool wantStatus, bool wantButtons);
 
 private:
-    Adafruit_ST7735*  _tft;
+    UiDisplay*        _tft;
     Screen*           _current = nullptr;
     Screen*           _prev    = nullptr;
 
-    uint32_t _lastTimeVer   = 0;
-    uint32_t _lastThemeVer  = 0;
-    uint32_t _lastScreenVer = 0;
-
     StatusBar*        _statusBar;
     //BottomBar*        _bottomBar;   // legacy
     ButtonBar*        _buttonBar;   // 🔥 ТЕПЕРЬ РЕАЛЬНО ИСПОЛЬЗУЕТСЯ
     LayoutService*    _layout;
     UiSeparator*      _sepStatus;
     UiSeparator*      _sepBottom;
-    UiVersionService* _uiVersion;
     ThemeService*     _theme;
+    UiDebugOverlay*   _overlay;
+    Timeline*         _timeline;
+
+    // Все каналы шины: изменение → внеочередной кадр
+    EventBus::Subscriber _events;
+
+    // Грязные регионы текущего кадра
+    DirtyRegion _dirty;
+    FrameStats  _stats{};
+
+    // ---- band renderer ----
+    BandRenderer _bands;
+    bool         _bandsOn   = true;
+    bool         _fullFrame = false;   // текущий кадр покрыл весь экран
+
+    // ---- screen transition ----
+    ScreenTransition _xfade;
+    bool             _transitionsOn = true;
+
+    // ---- press-to-photon ----
+    InputLatency _latency;
+    DirtyRegion  _dirtyAtInput;             // dirty до обработчика события
+    Screen*      _screenAtInput  = nullptr;
+    bool         _pendingAtInput = false;   // redrawPending() до обработчика
+    UiRect       _flushed{ 0, 0, 0, 0 };    // охват flush последнего кадра
+
+    // ---- debug HUD ----
+    bool _overlayShown   = false;   // HUD сейчас на экране
+    bool _overlayDamaged = false;   // кадр затёр область HUD
+
+    // Регион от этой площади — полосами (четверть экрана 160x128)
+    static constexpr uint32_t BAND_MIN_PX = 160u * 128u / 4u;
+
+    // ---- frame pacing ----
+    bool     _frameRequested = true;
+    uint32_t _lastFrameMs    = 0;
+    uint32_t _lastFrameUs    = 0;   // начало кадра (для джиттера)
+
+    // окно измерения duty cycle
+    uint32_t _dutyWindowStartUs = 0;
+    uint32_t _dutyBusyUs        = 0;
 
-    // 🔥 ВНУТРЕННИЙ флаг, только ScreenManager решает как делать redraw
-    bool _forceFullRedraw = false;
+    static constexpr uint32_t DUTY_WINDOW_US = 1000000;
 };
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "core/ServiceCore.h"
+
+// ============================================================================
+// setup
+// ============================================================================
+Scheduler::Id ServiceCore::add(
+    const char*       name,
+    uint32_t          periodMs,
+    Scheduler::TaskFn fn,
+    void*             ctx,
+    uint32_t          firstDelayMs
+) {
+    if (_task) return Scheduler::NONE;
+    return _sched.add(name, periodMs, fn, ctx, firstDelayMs);
+}
+
+void ServiceCore::start() {
+    if (_task) return;
+
+    _lock = xSemaphoreCreateMutex();
+    _sched.resetStats();
+
+    xTaskCreatePinnedToCore(
+        taskEntry,
+        "ServiceTask",
+        STACK,
+        this,
+        PRIORITY,
+        &_task,
+        CORE
+    );
+}
+
+// ============================================================================
+// mode
+// ============================================================================
+void ServiceCore::setInline(bool on) {
+    _inline.store(on);
+
+    // Задача ядра 0 спит до дедлайна — будим, чтобы сразу увидела режим
+    if (_task) xTaskNotifyGive(_task);
+}
+
+uint8_t ServiceCore::runInline() {
+    if (!_inline.load()) return 0;
+    return runLocked();
+}
+
+uint32_t ServiceCore::msUntilNext() const {
+    return _inline.load() ? _sched.msUntilNext() : 0xFFFFFFFFu;
+}
+
+// ============================================================================
+// run
+// ============================================================================
+uint8_t ServiceCore::runLocked() {
+    if (!_lock) return _sched.runDue();
+
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    const uint8_t ran = _sched.runDue();
+    xSemaphoreGive(_lock);
+
+    return ran;
+}
+
+void ServiceCore::taskEntry(void* arg) {
+    static_cast<ServiceCore*>(arg)->run();
+}
+
+void ServiceCore::run() {
+
+    // Полная частота — пока задачи работают; ожидание отпускает
+    _awake.begin();
+    _sched.attachAwake(_awake);
+
+    for (;;) {
+
+        uint32_t sleepMs = INLINE_POLL_MS;
+
+        if (!_inline.load()) {
+            runLocked();
+            sleepMs = _sched.msUntilNext();
+        }
+
+        // Не Scheduler::idle(): тот будит loop() и считает его пробуждения
+        _awake.sleep();
+        ulTaskNotifyTake(pdTRUE, sleepMs ? pdMS_TO_TICKS(sleepMs) : 1);
+        _awake.wake();
+    }
+}
+
+// ============================================================================
+// stats
+// ============================================================================
+void ServiceCore::dumpStats(Print& out) const {
+    out.printf(
+        "[SVC] core=%d mode=%s\n",
+        _inline.load() ? (int)xPortGetCoreID() : (int)CORE,
+        _inline.load() ? "inline" : "split"
+    );
+
+    // Счётчики пишет ядро 0 — читаем и сбрасываем под тем же мьютексом
+    if (_lock) xSemaphoreTake(_lock, portMAX_DELAY);
+    _sched.dumpStats(out);
+    if (_lock) xSemaphoreGive(_lock);
+}
+
+void ServiceCore::resetStats() {
+    if (_lock) xSemaphoreTake(_lock, portMAX_DELAY);
+    _sched.resetStats();
+    if (_lock) xSemaphoreGive(_lock);
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+#include "core/Scheduler.h"
+#include "core/PowerManager.h"
+
+/*
+ * ServiceCore
+ * -----------
+ * Задача сервисов, закреплённая за ядром 0 (PRO_CPU — там же стек Wi-Fi).
+ *
+ * Разделение ядер:
+ *  - ядро 0: этот Scheduler — I/O сервисов (sample(): DHT, RTC,
+ *    getLocalTime, WiFi.status/RSSI), ForecastTask (HTTP + JSON)
+ *  - ядро 1: loop() — кнопки, ScreenManager, логика сервисов над
+ *    готовыми снимками (core/Snapshot.h)
+ *  - данные идут в одну сторону: sample() → Snapshot → update()
+ *
+ * Сравнение "до/после":
+ *  - setInline(true) — задачи этого Scheduler выполняет loop() через
+ *    runInline() (как до разделения), задача ядра 0 простаивает
+ *  - джиттер кадра — ScreenManager::FrameStats
+ *
+ * Потоки:
+ *  - add() — только до start()
+ *  - runDue() защищён мьютексом: при переключении режима задачи
+ *    никогда не выполняются на двух ядрах сразу
+ */
+class ServiceCore {
+public:
+    static constexpr BaseType_t CORE       = 0;
+    static constexpr uint32_t   STACK      = 4096;
+    static constexpr UBaseType_t PRIORITY  = 1;
+
+    // Сон задачи ядра 0 в режиме inline (проверка флага)
+    static constexpr uint32_t INLINE_POLL_MS = 100;
+
+    Scheduler::Id add(
+        const char*        name,
+        uint32_t           periodMs,
+        Scheduler::TaskFn  fn,
+        void*              ctx          = nullptr,
+        uint32_t           firstDelayMs = 0
+    );
+
+    // Создать задачу на ядре CORE (звать в конце setup())
+    void start();
+
+    // true — задачи сервисов выполняет loop() (runInline)
+    void setInline(bool on);
+    bool isInline() const { return _inline.load(); }
+
+    // Для loop(): выполнить наступившие задачи, если включён inline
+    uint8_t runInline();
+
+    // Для loop() в режиме inline: мс до ближайшего дедлайна
+    uint32_t msUntilNext() const;
+
+    // "[SVC] ..." + строки [SCHED] задач ядра сервисов
+    void dumpStats(Print& out) const;
+    void resetStats();
+
+private:
+    static void taskEntry(void* arg);
+    void run();
+
+    uint8_t runLocked();
+
+private:
+    Scheduler         _sched;
+    AwakeLock         _awake{ "svc" };
+    TaskHandle_t      _task = nullptr;
+    SemaphoreHandle_t _lock = nullptr;
+
+    std::atomic<bool> _inline{ false };
+};
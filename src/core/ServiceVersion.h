@@ -1,13 +1,19 @@
 #pragma once
 #include <stdint.h>
+#include <atomic>
 
 /*
  * ServiceVersion
  * --------------
  * Монотонный счётчик изменений сервиса.
  * bump() вызывается ТОЛЬКО если состояние реально изменилось.
+ *
+ * Атомарный: bump() из задачи на другом ядре (ForecastTask),
+ * get() из loop() — без гонок на 32-битном значении.
  */
 struct ServiceVersion {
-    uint32_t value = 0;
-    void bump() { ++value; }
+    std::atomic<uint32_t> value{0};
+
+    void bump() { value.fetch_add(1, std::memory_order_release); }
+    uint32_t get() const { return value.load(std::memory_order_acquire); }
 };
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+/*
+ * Snapshot
+ * --------
+ * Неизменяемый снимок состояния между ДВУМЯ задачами (разные ядра):
+ * один писатель, один читатель, без блокировок и без ожиданий.
+ *
+ * Зачем:
+ *  - I/O сервисов (DHT, RTC, getLocalTime, WiFi.*) идёт на ядре
+ *    сервисов, UI читает только готовые значения
+ *  - ни одна сторона не ждёт другую: ни мьютексов, ни очередей
+ *
+ * Как устроено (тройной буфер):
+ *  - три слота: у писателя свой, у читателя свой, третий — "средний"
+ *  - publish(): писатель заполняет свой слот и МЕНЯЕТ его со средним
+ *    (бит FRESH — "в среднем новое")
+ *  - fetch(): если FRESH — читатель меняет свой слот со средним
+ *  - get() — слот читателя: стабилен до следующего fetch(), писатель
+ *    его не трогает
+ *  - промежуточные снимки теряются: читатель видит ПОСЛЕДНИЙ
+ *    (события "по одному разу" кодировать счётчиками внутри T)
+ *
+ * ПАМЯТЬ:
+ *  - 3 * sizeof(T), без heap; T — простая структура (копируется)
+ */
+template <typename T>
+class Snapshot {
+public:
+    Snapshot() : _middle(1) {}
+
+    // ===== писатель =====
+    void publish(const T& v) {
+        _slot[_back] = v;
+        const uint32_t prev = _middle.exchange(
+            (uint32_t)(_back | FRESH), std::memory_order_acq_rel);
+        _back = (uint8_t)(prev & INDEX);
+    }
+
+    // ===== читатель =====
+    // true — появился новый снимок (и get() уже указывает на него)
+    bool fetch() {
+        if (!(_middle.load(std::memory_order_relaxed) & FRESH))
+            return false;
+
+        const uint32_t prev = _middle.exchange(_front, std::memory_order_acq_rel);
+        _front = (uint8_t)(prev & INDEX);
+        return true;
+    }
+
+    const T& get() const { return _slot[_front]; }
+
+private:
+    static constexpr uint8_t INDEX = 0x03;
+    static constexpr uint8_t FRESH = 0x04;
+
+    T _slot[3] = {};
+
+    uint8_t               _front = 0;   // только читатель
+    uint8_t               _back  = 2;   // только писатель
+    std::atomic<uint32_t> _middle;      // индекс | FRESH (32 бита: нативный атомик Xtensa)
+};
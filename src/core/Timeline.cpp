@@ -0,0 +1,177 @@
+#include "core/Timeline.h"
+
+#include <Arduino.h>
+
+// ============================================================================
+// Id: младший байт — слот + 1, старший — поколение
+// ============================================================================
+int8_t Timeline::slotOf(Id id) const {
+    if (id == NONE) return -1;
+
+    const uint8_t slot = (uint8_t)(id & 0xFF) - 1;
+    if (slot >= MAX_TRACKS) return -1;
+
+    const Track& t = _tracks[slot];
+    if (t.state == State::FREE || t.gen != (uint8_t)(id >> 8)) return -1;
+
+    return (int8_t)slot;
+}
+
+Timeline::Id Timeline::alloc(const Spec& s, DoneFn done, void* ctx) {
+    for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+        Track& t = _tracks[i];
+        if (t.state != State::FREE) continue;
+
+        t.gen++;
+        t.spec    = s;
+        t.done    = done;
+        t.ctx     = ctx;
+        t.startMs = _nowMs;
+        t.value   = s.from;
+        t.after   = NONE;
+
+        return (Id)(((uint16_t)t.gen << 8) | (uint16_t)(i + 1));
+    }
+    return NONE;
+}
+
+void Timeline::release(uint8_t slot) {
+    _tracks[slot].state = State::FREE;
+}
+
+// ============================================================================
+// control
+// ============================================================================
+Timeline::Id Timeline::start(const Spec& s, DoneFn done, void* ctx) {
+    const Id id = alloc(s, done, ctx);
+    if (id != NONE) _tracks[(id & 0xFF) - 1].state = State::RUNNING;
+    return id;
+}
+
+Timeline::Id Timeline::chain(Id after, const Spec& s, DoneFn done, void* ctx) {
+    if (slotOf(after) < 0) return start(s, done, ctx);
+
+    const Id id = alloc(s, done, ctx);
+    if (id == NONE) return NONE;
+
+    Track& t = _tracks[(id & 0xFF) - 1];
+    t.after = after;
+    t.state = State::WAITING;
+    return id;
+}
+
+void Timeline::stop(Id id) {
+    const int8_t slot = slotOf(id);
+    if (slot < 0) return;
+
+    release((uint8_t)slot);
+
+    // Цепочка за остановленной дорожкой тоже не стартует
+    for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+        Track& t = _tracks[i];
+        if (t.state == State::WAITING && t.after == id) {
+            stop((Id)(((uint16_t)t.gen << 8) | (uint16_t)(i + 1)));
+        }
+    }
+}
+
+void Timeline::startWaiting(Id finished, uint32_t atMs) {
+    for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+        Track& t = _tracks[i];
+        if (t.state != State::WAITING || t.after != finished) continue;
+
+        t.state   = State::RUNNING;
+        t.after   = NONE;
+        t.startMs = atMs;
+    }
+}
+
+// ============================================================================
+// tick — один раз на кадр
+// ============================================================================
+void Timeline::tick(uint32_t nowMs) {
+
+    _nowMs = nowMs;
+
+    // Завершение может запустить цепочку — её тоже считаем в этом tick,
+    // поэтому проходим, пока есть запуски (глубина ≤ MAX_TRACKS)
+    for (uint8_t pass = 0; pass < MAX_TRACKS; pass++) {
+
+        bool started = false;
+
+        for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+            Track& t = _tracks[i];
+            if (t.state != State::RUNNING) continue;
+
+            const Spec& s = t.spec;
+
+            int32_t elapsed = (int32_t)(nowMs - t.startMs) - (int32_t)s.delayMs;
+            if (elapsed < 0) {
+                t.value = s.from;
+                continue;
+            }
+
+            if (s.loop) {
+                // Петля нулевой длины — стоит на to (делить не на что)
+                if (s.durationMs == 0) {
+                    t.value = s.to;
+                    continue;
+                }
+                elapsed %= s.durationMs;
+            }
+
+            if (!s.loop && (s.durationMs == 0 || elapsed >= (int32_t)s.durationMs)) {
+                t.value = s.to;
+
+                const Id       id   = (Id)(((uint16_t)t.gen << 8) | (uint16_t)(i + 1));
+                const uint32_t endMs = t.startMs + s.delayMs + s.durationMs;
+                DoneFn         done = t.done;
+                void*          ctx  = t.ctx;
+
+                release(i);
+                startWaiting(id, endMs);
+                started = true;
+
+                if (done) done(ctx);
+                continue;
+            }
+
+            const q16_t k = ease(s.ease, q16Div(elapsed, s.durationMs));
+            t.value = q16Lerp(s.from, s.to, k);
+        }
+
+        if (!started) break;
+    }
+}
+
+// ============================================================================
+// state
+// ============================================================================
+bool Timeline::active(Id id) const {
+    return slotOf(id) >= 0;
+}
+
+q16_t Timeline::value(Id id, q16_t idle) const {
+    const int8_t slot = slotOf(id);
+    return slot < 0 ? idle : _tracks[slot].value;
+}
+
+bool Timeline::anyActive() const {
+    for (uint8_t i = 0; i < MAX_TRACKS; i++) {
+        const Track& t = _tracks[i];
+        if (t.state != State::FREE && !t.spec.loop) return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// easing
+// ============================================================================
+q16_t Timeline::ease(Ease e, q16_t t) {
+    switch (e) {
+        case Ease::SMOOTH:   return smoothstepQ16(t);
+        case Ease::OUT_QUAD: return outQuadQ16(t);
+        case Ease::PULSE:    return pulseQ16(t);
+        default:             return q16Clamp01(t);
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <stdint.h>
+
+#include "core/FixedMath.h"
+
+/*
+ * Timeline
+ * --------
+ * Единый движок анимаций UI.
+ *
+ * Идея:
+ *  - одни часы кадра: ScreenManager вызывает tick(millis()) ОДИН раз
+ *    в начале кадра, все анимации кадра видят одно и то же время
+ *  - анимация = дорожка (track): from → to за durationMs,
+ *    с задержкой, easing, повтором (loop)
+ *  - значения — Q16 (FixedMath), в покадровом пути нет float
+ *  - цепочки: chain(after, ...) стартует дорожку, когда after
+ *    завершилась (в том же tick, от момента завершения)
+ *  - колбэк завершения: обычная функция + ctx (без heap)
+ *
+ * Темп кадров:
+ *  - anyActive() — есть ли конечная анимация (идущая или ждущая
+ *    в цепочке); пока есть — ScreenManager держит FPS_ANIM
+ *  - loop-дорожки (пульс ":") "фоновые": anyActive() их не считает,
+ *    их частоту задаёт экран через targetFps()
+ *
+ * Идентификатор:
+ *  - Id = слот + поколение; после завершения слот переиспользуется,
+ *    старый Id становится недействительным (active() == false)
+ *
+ * ПАМЯТЬ:
+ *  - фиксированный пул MAX_TRACKS, без heap
+ */
+
+class Timeline {
+public:
+    typedef uint16_t Id;
+    static constexpr Id NONE = 0;
+
+    static constexpr uint8_t MAX_TRACKS = 8;
+
+    enum class Ease : uint8_t {
+        LINEAR = 0,
+        SMOOTH,        // smoothstep 3t^2 - 2t^3
+        OUT_QUAD,      // быстрый старт, мягкая остановка
+        PULSE          // 0.5 + 0.5 * sin(2πt) — "дыхание"
+    };
+
+    typedef void (*DoneFn)(void* ctx);
+
+    struct Spec {
+        q16_t    from;
+        q16_t    to;
+        uint16_t durationMs;   // 0: сразу to (loop — стоит на to)
+        uint16_t delayMs;
+        Ease     ease;
+        bool     loop;
+    };
+
+    // Старт от текущих часов. NONE — пул занят.
+    Id start(const Spec& s, DoneFn done = nullptr, void* ctx = nullptr);
+
+    // Старт после завершения after (after недействителен → сразу).
+    Id chain(Id after, const Spec& s, DoneFn done = nullptr, void* ctx = nullptr);
+
+    // Остановить без колбэка (и всю цепочку за ней)
+    void stop(Id id);
+
+    // ===== frame clock =====
+    void tick(uint32_t nowMs);
+    uint32_t now() const { return _nowMs; }
+
+    // ===== state =====
+    bool active(Id id) const;
+
+    // Значение (Q16) на текущем tick; недействительный Id → idle
+    q16_t value(Id id, q16_t idle) const;
+
+    bool anyActive() const;
+
+private:
+    enum class State : uint8_t {
+        FREE = 0,
+        WAITING,     // ждёт завершения предыдущей в цепочке
+        RUNNING
+    };
+
+    struct Track {
+        Spec     spec;
+        DoneFn   done;
+        void*    ctx;
+        uint32_t startMs;
+        q16_t    value;
+        Id       after;   // для WAITING
+        uint8_t  gen;
+        State    state;
+    };
+
+    static q16_t ease(Ease e, q16_t t);
+
+    Id   alloc(const Spec& s, DoneFn done, void* ctx);
+    int8_t slotOf(Id id) const;
+    void release(uint8_t slot);
+    void startWaiting(Id finished, uint32_t atMs);
+
+    Track    _tracks[MAX_TRACKS] = {};
+    uint32_t _nowMs = 0;
+};
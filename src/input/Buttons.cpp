@@ -1,5 +1,24 @@
 #include "input/Buttons.h"
 
+#include <atomic>
+#include "soc/gpio_struct.h"
+
+static constexpr uint32_t CHORD_US = Buttons::CHORD_MS * 1000u;
+static constexpr uint32_t NO_DEADLINE = 0xFFFFFFFFu;
+
+// Прошло ли span от since к моменту at. Со знаком: момент "раньше since"
+// (фронт пришёл между чтением кольца и micros()) — не прошло.
+static inline bool elapsed(uint32_t atUs, uint32_t sinceUs, uint32_t spanUs) {
+    return (int32_t)(atUs - sinceUs) >= (int32_t)spanUs;
+}
+
+// Уровень пина прямо из регистра: digitalRead() не обязан жить в IRAM
+static inline bool IRAM_ATTR readPinIsr(uint8_t pin) {
+    return pin < 32
+        ? ((GPIO.in >> pin) & 1u)
+        : ((GPIO.in1.data >> (pin - 32)) & 1u);
+}
+
 Buttons::Buttons(
     uint8_t pinLeft,
     uint8_t pinRight,
@@ -8,13 +27,25 @@ Buttons::Buttons(
     uint32_t debounceMs,
     uint32_t longPressMs
 )
-    : _debounceMs(debounceMs)
-    , _longPressMs(longPressMs)
+    : _debounceUs(debounceMs * 1000u)
+    , _longPressUs(longPressMs * 1000u)
 {
     _left.pin  = pinLeft;
     _right.pin = pinRight;
     _ok.pin    = pinOk;
     _back.pin  = pinBack;
+
+    _left.id  = ButtonId::LEFT;
+    _right.id = ButtonId::RIGHT;
+    _ok.id    = ButtonId::OK;
+    _back.id  = ButtonId::BACK;
+
+    _btn[(uint8_t)ButtonId::LEFT]  = &_left;
+    _btn[(uint8_t)ButtonId::RIGHT] = &_right;
+    _btn[(uint8_t)ButtonId::OK]    = &_ok;
+    _btn[(uint8_t)ButtonId::BACK]  = &_back;
+
+    for (Btn* b : _btn) b->owner = this;
 }
 
 void Buttons::Btn::begin(uint8_t p) {
@@ -24,87 +55,241 @@ void Buttons::Btn::begin(uint8_t p) {
     bool r = digitalRead(pin);
     stable = r;
     lastRaw = r;
-    lastChangeMs = 0;
+    lastChangeUs = micros();
 
     isDown = (stable == LOW);
-    downSinceMs = 0;
+    downSinceUs = lastChangeUs;
     longFired = false;
 }
 
-void Buttons::Btn::updateRaw(bool raw, uint32_t nowMs, uint32_t debounceMs) {
-    // фиксируем изменения сырого сигнала
-    if (raw != lastRaw) {
-        lastRaw = raw;
-        lastChangeMs = nowMs;
+// ============================================================================
+// setup
+// ============================================================================
+void Buttons::begin() {
+    _left.begin(_left.pin);
+    _right.begin(_right.pin);
+    _ok.begin(_ok.pin);
+    _back.begin(_back.pin);
+
+    // ISR GPIO ставится на ядро вызывающего — здесь это ядро loop()
+    for (Btn* b : _btn) {
+        attachInterruptArg(digitalPinToInterrupt(b->pin), onEdge, b, CHANGE);
     }
+}
 
-    // если сырой сигнал стабилен достаточное время — принимаем новое stable
-    if ((nowMs - lastChangeMs) >= debounceMs && stable != lastRaw) {
-        stable = lastRaw;
-
-        // переходы stable:
-        if (stable == LOW) {
-            // НАЖАТИЕ (down)
-            isDown = true;
-            downSinceMs = nowMs;
-            longFired = false;
-        } else {
-            // ОТПУСКАНИЕ (up)
-            isDown = false;
-        }
+void Buttons::attachWake(void (*isr)()) {
+    _wake = isr;
+}
+
+// ============================================================================
+// ISR → кольцо
+// ============================================================================
+void IRAM_ATTR Buttons::onEdge(void* arg) {
+    Btn* b = static_cast<Btn*>(arg);
+    b->owner->pushEdge((uint8_t)b->id, readPinIsr(b->pin), micros());
+}
+
+void IRAM_ATTR Buttons::pushEdge(uint8_t btn, uint8_t level, uint32_t us) {
+
+    const uint8_t head = _edgeHead;
+
+    if ((uint8_t)(head - _edgeTail) >= EDGE_RING) {
+        _edgesDropped = _edgesDropped + 1;
+        _overflow = true;
+    } else {
+        Edge& e = _edges[head & (EDGE_RING - 1)];
+        e.us    = us;
+        e.btn   = btn;
+        e.level = level;
+
+        // Слот заполнен раньше, чем poll() увидит новый head
+        std::atomic_signal_fence(std::memory_order_release);
+        _edgeHead = (uint8_t)(head + 1);
     }
+
+    void (*wake)() = _wake;
+    if (wake) wake();
 }
 
-bool Buttons::readEventFor(Btn& b, ButtonId id, uint32_t nowMs, ButtonEvent& out) {
+// ============================================================================
+// кольцо → состояние кнопок
+// ============================================================================
+void Buttons::drainEdges() {
+
+    uint8_t       tail = _edgeTail;
+    const uint8_t head = _edgeHead;
+    std::atomic_signal_fence(std::memory_order_acquire);
+
+    while (tail != head) {
+        const Edge e = _edges[tail & (EDGE_RING - 1)];
+        tail++;
+
+        // Всё, что наступило ДО этого фронта, — по старому уровню
+        settleAll(e.us);
+
+        // Любой фронт (и дребезг) перезапускает окно debounce
+        Btn& b = *_btn[e.btn];
+        b.lastRaw      = e.level;
+        b.lastChangeUs = e.us;
+    }
+
+    _edgeTail = tail;
+}
 
-    // Long press: один раз за удержание
-    if (b.isDown && !b.longFired) {
-        if ((nowMs - b.downSinceMs) >= _longPressMs) {
-            b.longFired = true;
-            out = { id, ButtonEventType::LONG_PRESS };
-            return true;
+// Кольцо переполнилось — фронты потеряны, сверяемся с пинами
+void Buttons::resync(uint32_t nowUs) {
+    for (Btn* b : _btn) {
+        const bool raw = digitalRead(b->pin);
+        if (raw != b->lastRaw) {
+            b->lastRaw      = raw;
+            b->lastChangeUs = nowUs;
         }
     }
+}
+
+// ============================================================================
+// события по времени
+// ============================================================================
+void Buttons::settleAll(uint32_t atUs) {
+
+    for (Btn* b : { &_ok, &_back, &_left, &_right }) settle(*b, atUs);
+
+    // аккорд раньше long: он подавляет события одиночных
+    settleChord(atUs);
+
+    for (Btn* b : { &_ok, &_back, &_left, &_right }) {
+        if (!b->isDown || b->longFired) continue;
+        if (!elapsed(atUs, b->downSinceUs, _longPressUs)) continue;
+
+        b->longFired = true;
+        emit(b->id, ButtonEventType::LONG_PRESS, b->downSinceUs + _longPressUs);
+    }
+}
+
+void Buttons::settle(Btn& b, uint32_t atUs) {
+
+    // сырой сигнал стабилен debounce — принимаем; момент — последний фронт
+    if (b.lastRaw == b.stable) return;
+    if (!elapsed(atUs, b.lastChangeUs, _debounceUs)) return;
+
+    const uint32_t edgeUs = b.lastChangeUs;
+    b.stable = b.lastRaw;
+
+    if (b.stable == LOW) {
+        // НАЖАТИЕ (down)
+        b.isDown      = true;
+        b.downSinceUs = edgeUs;
+        b.longFired   = false;
+        return;
+    }
 
-    // Short press: событие на отпускании, если long не было
-    // (то есть "клик" считается завершённым только на release)
-    // Важно: мы не используем отдельный флаг "released" — его можно поймать так:
-    // stable==HIGH и при этом lastRaw==HIGH и isDown==false после перехода
-    // Но нам нужно сработать ОДИН раз. Для этого используем трюк:
-    // - если stable==HIGH, isDown==false, и longFired==false, и downSinceMs != 0,
-    //   значит был клик и отпустили.
-    if (!b.isDown && !b.longFired && b.downSinceMs != 0) {
-        // генерим short и сбрасываем downSinceMs чтобы не повторялось
-        b.downSinceMs = 0;
-        out = { id, ButtonEventType::SHORT_PRESS };
-        return true;
+    // ОТПУСКАНИЕ (up): удержание могло дотянуть до long
+    if (!b.longFired && elapsed(edgeUs, b.downSinceUs, _longPressUs)) {
+        b.longFired = true;
+        emit(b.id, ButtonEventType::LONG_PRESS, b.downSinceUs + _longPressUs);
     }
 
-    return false;
+    b.isDown = false;
+
+    // Short — на отпускании, если не было long / аккорда
+    if (!b.longFired) {
+        emit(b.id, ButtonEventType::SHORT_PRESS, edgeUs);
+    }
 }
 
-void Buttons::begin() {
-    _left.begin(_left.pin);
-    _right.begin(_right.pin);
-    _ok.begin(_ok.pin);
-    _back.begin(_back.pin);
+void Buttons::settleChord(uint32_t atUs) {
+
+    // Аккорд "взводится" снова, только когда обе кнопки отпущены
+    if (!_left.isDown && !_right.isDown) {
+        _chordFired = false;
+        return;
+    }
+
+    if (_chordFired || !_left.isDown || !_right.isDown)
+        return;
+
+    // отсчёт — от позже нажатой кнопки
+    const uint32_t sinceUs =
+        (atUs - _left.downSinceUs < atUs - _right.downSinceUs)
+            ? _left.downSinceUs
+            : _right.downSinceUs;
+
+    if (!elapsed(atUs, sinceUs, CHORD_US))
+        return;
+
+    _chordFired = true;
+
+    // longFired глушит и long, и short на отпускании
+    _left.longFired  = true;
+    _right.longFired = true;
+
+    emit(ButtonId::LEFT, ButtonEventType::CHORD, sinceUs + CHORD_US);
+}
+
+void Buttons::emit(ButtonId id, ButtonEventType type, uint32_t us) {
+    if (_evCount >= EVENT_Q) return;
+
+    _events[(uint8_t)((_evHead + _evCount) % EVENT_Q)] = { id, type, us };
+    _evCount++;
 }
 
+// ============================================================================
+// API для loop()
+// ============================================================================
 bool Buttons::poll(ButtonEvent& out) {
-    const uint32_t now = millis();
-
-    // обновляем stable состояния
-    _left.updateRaw(digitalRead(_left.pin), now, _debounceMs);
-    _right.updateRaw(digitalRead(_right.pin), now, _debounceMs);
-    _ok.updateRaw(digitalRead(_ok.pin), now, _debounceMs);
-    _back.updateRaw(digitalRead(_back.pin), now, _debounceMs);
-
-    // порядок приоритетов событий (чтобы не было "одновременно")
-    // OK/BACK обычно важнее для UX, поэтому они раньше
-    if (readEventFor(_ok, ButtonId::OK, now, out)) return true;
-    if (readEventFor(_back, ButtonId::BACK, now, out)) return true;
-    if (readEventFor(_left, ButtonId::LEFT, now, out)) return true;
-    if (readEventFor(_right, ButtonId::RIGHT, now, out)) return true;
-
-    return false;
-}
\ No newline at end of file
+
+    if (_evCount == 0) {
+        drainEdges();
+
+        // после чтения head: все разобранные фронты не позже now
+        const uint32_t now = micros();
+
+        if (_overflow) {
+            _overflow = false;
+            resync(now);
+        }
+
+        settleAll(now);
+    }
+
+    if (_evCount == 0) return false;
+
+    out = _events[_evHead];
+    _evHead = (uint8_t)((_evHead + 1) % EVENT_Q);
+    _evCount--;
+    return true;
+}
+
+uint32_t Buttons::msUntilNext() const {
+
+    if (_evCount || _edgeHead != _edgeTail || _overflow) return 0;
+
+    const uint32_t now  = micros();
+    uint32_t       best = NO_DEADLINE;
+
+    auto consider = [&](uint32_t sinceUs, uint32_t spanUs) {
+        const uint32_t el   = now - sinceUs;
+        const uint32_t left = el >= spanUs ? 0 : spanUs - el;
+        if (left < best) best = left;
+    };
+
+    for (const Btn* b : _btn) {
+        if (b->lastRaw != b->stable)      consider(b->lastChangeUs, _debounceUs);
+        if (b->isDown && !b->longFired)   consider(b->downSinceUs,  _longPressUs);
+    }
+
+    if (!_chordFired && _left.isDown && _right.isDown) {
+        consider(
+            (now - _left.downSinceUs < now - _right.downSinceUs)
+                ? _left.downSinceUs
+                : _right.downSinceUs,
+            CHORD_US
+        );
+    }
+
+    return best == NO_DEADLINE ? NO_DEADLINE : (best + 999u) / 1000u;
+}
+
+bool Buttons::busy() const {
+    return msUntilNext() != NO_DEADLINE;
+}
@@ -2,7 +2,7 @@
 #include <Arduino.h>
 
 /*
- * Buttons (v2)
+ * Buttons (v3)
  * ------------
  * Слой ввода: 4 аппаратные кнопки + debounce + long-press.
  *
@@ -10,6 +10,27 @@
  *  - UI/экраны НЕ знают про millis()
  *  - Buttons генерирует события: short/long
  *  - LongPress срабатывает ОДИН раз за удержание
+ *  - Аккорд LEFT+RIGHT (оба удержаны CHORD_MS) — одно событие CHORD,
+ *    short/long этих нажатий подавляются
+ *
+ * Захват (прерывания):
+ *  - begin() вешает CHANGE на все 4 пина; ISR кладёт фронт
+ *    {кнопка, уровень, micros()} в кольцо и зовёт isr из attachWake()
+ *  - poll() разбирает фронты ПО ИХ ВРЕМЕНИ: debounce, long, chord
+ *    считаются от моментов фронтов, а не от того, когда loop()
+ *    до них добрался — длинный кадр не сдвигает нажатие
+ *  - события копятся в очереди: два клика за один кадр — два события
+ *
+ * Кольцо фронтов:
+ *  - один писатель (ISR), один читатель (poll()), оба на ядре loop()
+ *    (прерывания вешаются из setup()) — без блокировок
+ *  - переполнение: новые фронты теряются, poll() сверяет уровни
+ *    пинов с digitalRead() (edgesDropped() — счётчик)
+ *
+ * Сон loop():
+ *  - фронт будит loop() сам (attachWake); ждать нужно только
+ *    дедлайнов по времени — msUntilNext() (конец debounce, long, chord)
+ *  - busy() — что-то из этого ещё впереди
  */
 
 enum class ButtonId : uint8_t {
@@ -21,12 +42,14 @@ enum class ButtonId : uint8_t {
 
 enum class ButtonEventType : uint8_t {
     SHORT_PRESS = 0,   // отпустили до long threshold
-    LONG_PRESS         // удержали >= threshold (срабатывает один раз)
+    LONG_PRESS,        // удержали >= threshold (срабатывает один раз)
+    CHORD              // LEFT+RIGHT вместе (id = LEFT)
 };
 
 struct ButtonEvent {
     ButtonId id;
     ButtonEventType type;
+    uint32_t us;       // micros() момента, когда событие наступило
 };
 
 class Buttons {
@@ -40,38 +63,95 @@ public:
         uint32_t longPressMs = 800
     );
 
+    // Пины + прерывания по фронтам (звать из setup())
     void begin();
 
-    // poll() возвращает true, если есть событие (одно за вызов).
-    // Внутри хранится очередь максимум 1 событие; вызывать в loop() часто.
+    // Следующее событие из очереди (false — событий нет).
+    // Разбирает накопленные фронты; звать в loop() до false.
     bool poll(ButtonEvent& out);
 
+    // Фронт на любом пине → isr (разбудить loop). Звать после begin().
+    void attachWake(void (*isr)());
+
+    // Впереди debounce / long / chord или не разобранные фронты
+    bool busy() const;
+
+    // Мс до ближайшего дедлайна по времени (0 — poll() нужен сейчас)
+    uint32_t msUntilNext() const;
+
+    uint32_t edgesDropped() const { return _edgesDropped; }
+
+    // Сколько обе кнопки аккорда должны быть нажаты одновременно
+    static constexpr uint32_t CHORD_MS = 300;
+
+    static constexpr uint8_t EDGE_RING = 32;   // степень двойки
+    static constexpr uint8_t EVENT_Q   = 8;
+
 private:
+    static constexpr uint8_t COUNT = 4;
+
     struct Btn {
-        uint8_t pin = 0;
+        uint8_t  pin   = 0;
+        ButtonId id    = ButtonId::LEFT;
+        Buttons* owner = nullptr;
 
         // debounce
         bool stable = HIGH;
         bool lastRaw = HIGH;
-        uint32_t lastChangeMs = 0;
+        uint32_t lastChangeUs = 0;
 
         // press/hold
         bool isDown = false;
-        uint32_t downSinceMs = 0;
+        uint32_t downSinceUs = 0;
         bool longFired = false;
 
         void begin(uint8_t p);
-        void updateRaw(bool raw, uint32_t nowMs, uint32_t debounceMs);
     };
 
-    bool readEventFor(Btn& b, ButtonId id, uint32_t nowMs, ButtonEvent& out);
+    struct Edge {
+        uint32_t us;
+        uint8_t  btn;
+        uint8_t  level;
+    };
+
+    static void IRAM_ATTR onEdge(void* arg);
+    void IRAM_ATTR pushEdge(uint8_t btn, uint8_t level, uint32_t us);
+
+    void drainEdges();
+    void resync(uint32_t nowUs);
+
+    // Всё, что наступило к моменту atUs: debounce → long → chord
+    void settleAll(uint32_t atUs);
+    void settle(Btn& b, uint32_t atUs);
+    void settleChord(uint32_t atUs);
+
+    void emit(ButtonId id, ButtonEventType type, uint32_t us);
 
 private:
-    Btn _left;
-    Btn _right;
+    // Порядок = приоритет событий одного момента: OK/BACK важнее для UX
     Btn _ok;
     Btn _back;
+    Btn _left;
+    Btn _right;
 
-    uint32_t _debounceMs;
-    uint32_t _longPressMs;
-};
\ No newline at end of file
+    Btn* _btn[COUNT];   // индекс = ButtonId
+
+    uint32_t _debounceUs;
+    uint32_t _longPressUs;
+
+    bool _chordFired = false;
+
+    void (*volatile _wake)() = nullptr;
+
+    // ---- кольцо фронтов (ISR → poll) ----
+    Edge              _edges[EDGE_RING];
+    volatile uint8_t  _edgeHead = 0;    // пишет только ISR
+    volatile uint8_t  _edgeTail = 0;    // пишет только poll()
+    volatile uint32_t _edgesDropped = 0;
+    volatile bool     _overflow = false;
+
+    // ---- очередь событий (только loop) ----
+    ButtonEvent _events[EVENT_Q];
+    uint8_t     _evHead  = 0;
+    uint8_t     _evCount = 0;
+};
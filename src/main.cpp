@@ -11,12 +11,16 @@
 // ================= CORE =================
 #include "core/ScreenManager.h"
 #include "core/AppController.h"
+#include "core/Timeline.h"
+#include "core/Scheduler.h"
+#include "core/ServiceCore.h"
+#include "core/PowerManager.h"
+#include "core/EventBus.h"
 
 // ================= INPUT =================
 #include "input/Buttons.h"
 
 // ================= SERVICES =================
-#include "services/UiVersionService.h"
 #include "services/ThemeService.h"
 #include "services/ThemeBlend.h"
 #include "services/TimeService.h"
@@ -38,15 +42,21 @@
 #include "services/LayoutService.h"
 
 // ================= UI =================
+#include "ui/UiDisplay.h"
 #include "ui/StatusBar.h"
 #include "ui/UiSeparator.h"
+#include "ui/UiDebugOverlay.h"
 
 // ================= SCREENS =================
 #include "screens/ClockScreen.h"
 #include "screens/ForecastScreen.h"
 #include "screens/SettingsScreen.h"
 
-Adafruit_ST7735 tft(TFT_CS, TFT_DC, TFT_RST);
+UiDisplay tft(TFT_CS, TFT_DC, TFT_RST);
+
+// Частота SPI дисплея — одна для Adafruit и для DMA полос
+// (spi_master: 80 МГц / 3)
+static constexpr uint32_t TFT_SPI_HZ = 26666666;
 DhtService dht(DHT_PIN, DHT_TYPE);
 
 Buttons buttons(
@@ -55,20 +65,26 @@ Buttons buttons(
 );
 
 LayoutService layout(tft);
-UiVersionService uiVersion;
-NightTransitionService nightTransition;
-ThemeService themeService(uiVersion);
+EventBus bus;
+Timeline timeline;
+Scheduler scheduler;
+ServiceCore serviceCore;
+PowerManager power;
+AwakeLock loopAwake("loop");
+NightTransitionService nightTransition(timeline);
+ThemeService themeService(bus);
 
 PreferencesService prefs;
-NightService nightService(uiVersion, prefs);
+NightService nightService(bus, prefs);
 
 ColorTemperatureService colorTemp;
 BrightnessService brightness;
 BacklightService backlight;
 
-WifiService wifi(uiVersion, prefs);
+WifiService wifi(bus, prefs);
 
 ForecastService forecastService(
+    bus,
     "07108cf067a5fdf5aa26dce75354400f",
     "Kharkiv",
     "metric",
@@ -80,7 +96,7 @@ RtcService rtc(RTC_CLK, RTC_DAT, RTC_RST);
 RtcTimeProvider rtcProvider(rtc);
 NtpTimeProvider ntpProvider;
 
-TimeService timeService(uiVersion);
+TimeService timeService(bus);
 
 StatusBar statusBar(
     tft,
@@ -96,14 +112,17 @@ ConnectivityService connectivity(timeService);
 UiSeparator sepStatus(tft, themeService, layout);
 UiSeparator sepBottom(tft, themeService, layout);
 
+UiDebugOverlay debugOverlay(tft, forecastService);
+
 ClockScreen clockScreen(
     tft,
     timeService,
     nightTransition,
     themeService,
     layout,
-    uiVersion,
-    dht
+    bus,
+    dht,
+    timeline
 );
 
 ForecastScreen forecastScreen(
@@ -111,7 +130,8 @@ ForecastScreen forecastScreen(
     themeService,
     forecastService,
     layout,
-    uiVersion
+    bus,
+    timeline
 );
 
 SettingsScreen settingsScreen(
@@ -122,7 +142,7 @@ SettingsScreen settingsScreen(
     timeService,
     wifi,
     brightness,
-    uiVersion,
+    bus,
     buttonBar
 );
 
@@ -134,8 +154,10 @@ ScreenManager screenManager(
     layout,
     sepStatus,
     sepBottom,
-    uiVersion,
-    themeService
+    bus,
+    themeService,
+    debugOverlay,
+    timeline
 );
 
 AppController app(
@@ -145,6 +167,115 @@ AppController app(
     settingsScreen
 );
 
+// =====================================================
+// SERVICE CORE TASKS (ядро 0: I/O → снимки)
+// =====================================================
+static void sampleClock(void*) { timeService.sample(); }
+static void sampleWifi(void*)  { wifi.sample(); }
+static void sampleDht(void*)   { dht.sample(); }
+
+// =====================================================
+// SCHEDULED TASKS (ядро UI; периоды — в setup())
+// =====================================================
+static Scheduler::Id nightTask = Scheduler::NONE;
+static Scheduler::Id timeTask  = Scheduler::NONE;
+
+// Снимок часов с ядра 0 (новая секунда / время provider)
+static EventBus::Subscriber clockEvents(bus, channelBit(UiChannel::CLOCK));
+
+static void taskTime(void*)         { timeService.update(); }
+static void taskWifi(void*)         { wifi.update(); }
+static void taskConnectivity(void*) { connectivity.update(); }
+static void taskDht(void*)          { dht.update(); }
+static void taskForecast(void*)     { forecastService.update(); }
+
+static void taskNight(void*) {
+    nightService.update(timeService);
+    themeService.setNight(nightService.isNight());
+    nightTransition.setTarget(nightService.isNight());
+}
+
+static void taskRtcSync(void*) {
+    if (!timeService.shouldWriteRtc()) return;
+
+    tm now;
+    if (getLocalTime(&now)) {
+        rtc.write(now);
+        timeService.markRtcWritten();
+    }
+}
+
+// Диагностика по Serial: 'f' — снимок кадра, 't' — трафик TFT,
+// 's' — статистика планировщиков, 'c' — сервисы на ядре 0 / в loop()
+// (сравнение джиттера кадра "до/после" разделения ядер),
+// 'l' — гистограммы задержки ввода, 'L' — сбросить их,
+// 'b' — полосы вкл/выкл (full=...us в [UI] "band" против "direct")
+static void taskSerial(void*) {
+    if (!Serial.available()) return;
+
+    switch (Serial.read()) {
+        case 'f': screenManager.dumpFrame(Serial); break;
+        case 't': tft.dumpTraffic(Serial);         break;
+        case 's':
+            scheduler.dumpStats(Serial);
+            serviceCore.dumpStats(Serial);
+            break;
+        case 'l': screenManager.latency().dump(Serial); break;
+        case 'L': screenManager.resetLatency();          break;
+        case 'b':
+            screenManager.setBandRendering(!screenManager.bandRendering());
+            screenManager.forceFullRedraw();
+            break;
+        case 'c':
+            serviceCore.setInline(!serviceCore.isInline());
+            screenManager.resetJitter();
+            Serial.printf("[SVC] mode=%s\n", serviceCore.isInline() ? "inline" : "split");
+            break;
+        default: break;
+    }
+}
+
+// SPI-трафик компоновщика и работа планировщика (раз в 10 с)
+static void taskStats(void*) {
+
+    const ScreenManager::FrameStats& st = screenManager.stats();
+    Serial.printf(
+        "[UI] frames=%u skipped=%u px/frame last=%u max=%u avg=%u "
+        "frame=%uus duty=%u.%u%% text=%u ch/s full=%uus (%s) bands=%u "
+        "jitter=%uus max=%uus\n",
+        (unsigned)st.frames,
+        (unsigned)st.skipped,
+        (unsigned)st.lastPixels,
+        (unsigned)st.maxPixels,
+        (unsigned)(st.frames ? st.totalPixels / st.frames : 0),
+        (unsigned)st.lastFrameUs,
+        (unsigned)(st.dutyPermille / 10),
+        (unsigned)(st.dutyPermille % 10),
+        (unsigned)(tft.textUs()
+            ? (uint64_t)tft.textChars() * 1000000ULL / tft.textUs()
+            : 0),
+        (unsigned)st.lastFullFrameUs,
+        screenManager.bandRendering() ? "band" : "direct",
+        (unsigned)st.bandPasses,
+        (unsigned)st.lastJitterUs,
+        (unsigned)st.maxJitterUs
+    );
+    screenManager.resetJitter();
+
+    // Трафик по виджетам за эти 10 с
+    tft.dumpTraffic(Serial);
+    tft.resetTraffic();
+
+    // Запуски / CPU по сервисам и пустые пробуждения loop()
+    scheduler.dumpStats(Serial);
+    scheduler.resetStats();
+
+    serviceCore.dumpStats(Serial);
+    serviceCore.resetStats();
+
+    power.dump(Serial);
+}
+
 // =====================================================
 // SETUP
 // =====================================================
@@ -153,7 +284,10 @@ void setup() {
     Serial.begin(115200);
     Serial.println("BOOT");
 
-    uiVersion.begin();
+    // DFS до старта задач; light sleep выключен: LEDC подсветки
+    // и фронты кнопок в нём не живут (см. PowerManager)
+    power.begin(false);
+
     prefs.begin();
     nightService.begin();
 
@@ -169,11 +303,16 @@ void setup() {
     backlight.set(1.0f);
 
     tft.initR(INITR_BLACKTAB);
+    tft.setSPISpeed(TFT_SPI_HZ);
     tft.setRotation(1);
     tft.fillScreen(0x0000);
 
+    // Полосы по DMA на той же частоте; не вышло — блокирующий путь
+    Serial.printf("[UI] band dma=%s\n", tft.beginDma(TFT_SPI_HZ) ? "on" : "off");
+
     brightness.begin();
     buttons.begin();
+    themeService.attachFilters(colorTemp, brightness);
     themeService.begin();
     rtc.begin();
     timeService.begin();
@@ -185,6 +324,33 @@ void setup() {
 
     screenManager.begin();
     app.begin();
+
+    // Кнопки и публикации из других задач (ForecastTask) будят loop()
+    // из сна; дальше всё — по дедлайнам
+    scheduler.begin();
+    loopAwake.begin();
+    scheduler.attachAwake(loopAwake);
+    buttons.attachWake(&Scheduler::wakeFromIsr);
+    bus.begin();
+    bus.wakeOn(CHANNELS_ALL);
+
+    // update() — по CLOCK (loop()); период — только страховка
+    timeTask = scheduler.add("time", 1000, taskTime);
+    scheduler.add("wifi",    250,   taskWifi);
+    scheduler.add("conn",    250,   taskConnectivity);
+    nightTask = scheduler.add("night", 1000, taskNight);
+    scheduler.add("dht",     1000,  taskDht);
+    scheduler.add("forecast", 1000, taskForecast);
+    scheduler.add("rtc",     1000,  taskRtcSync);
+    scheduler.add("serial",  100,   taskSerial);
+    scheduler.add("stats",   10000, taskStats, nullptr, 10000);
+
+    // I/O сервисов — на ядро 0; loop() забирает готовые снимки
+    serviceCore.add("clock", 50,  sampleClock);
+    serviceCore.add("link",  250, sampleWifi);
+    serviceCore.add("dht",   DhtService::READ_INTERVAL_MS, sampleDht,
+                    nullptr, DhtService::READ_INTERVAL_MS);
+    serviceCore.start();
 }
 
 // =====================================================
@@ -193,40 +359,58 @@ void setup() {
 void loop() {
 
     // 1️⃣ INPUT — всегда первым
+    bool input = false;
     ButtonEvent e;
     while (buttons.poll(e)) {
         app.handleEvent(e);
+        input = true;
     }
 
-    // 2️⃣ ВАЖНЫЕ сервисы
-    timeService.update();
-    wifi.update();
-    connectivity.update();
+    // Настройки могли сменить режим ночи — не ждём периода
+    if (input) scheduler.runNow(nightTask);
 
-    // 3️⃣ UI
-    nightService.update(timeService);
-    themeService.setNight(nightService.isNight());
-    nightTransition.setTarget(nightService.isNight());
-    nightTransition.update();
+    // 2️⃣ Сервисы — только те, чей дедлайн наступил
+    // (I/O сервисов — здесь же только в режиме сравнения 'c')
+    uint8_t ran = scheduler.runDue();
+    ran += serviceCore.runInline();
 
-    colorTemp.set(
-        nightTransition.value() > 0.7f ? ColorTemp::NIGHT :
-        nightTransition.value() > 0.3f ? ColorTemp::EVENING :
-                                         ColorTemp::DAY
-    );
+    // Новый снимок часов (ядро 0 или runInline выше) — update() сейчас,
+    // а не по таймеру: loop() не просыпается ради пустого опроса
+    if (clockEvents.poll()) {
+        scheduler.runNow(timeTask);
+        ran += scheduler.runDue();
+    }
+
+    // 3️⃣ UI — ScreenManager сам держит темп кадров
+    const bool frameDue = (screenManager.msUntilNextFrame() == 0);
+    if (frameDue) {
+        nightTransition.update();
+
+        // Пороги 0.7 / 0.3 в шкале value8() — без float в каждом кадре
+        const uint8_t night8 = nightTransition.value8();
+        colorTemp.set(
+            night8 > 178 ? ColorTemp::NIGHT :
+            night8 > 76  ? ColorTemp::EVENING :
+                           ColorTemp::DAY
+        );
+    }
 
     screenManager.update();
 
-    // 4️⃣ Медленные
-    dht.update();
-    forecastService.update();
-
-    // RTC sync
-    if (timeService.shouldWriteRtc()) {
-        tm now;
-        if (getLocalTime(&now)) {
-            rtc.write(now);
-            timeService.markRtcWritten();
-        }
+    if (!input && !ran && !frameDue && !buttons.busy()) {
+        scheduler.countEmptyWakeup();
     }
-}
\ No newline at end of file
+
+    // 4️⃣ Спим до ближайшего дедлайна (сервис, кадр — темп уже учитывает
+    // анимации Timeline, debounce / long / chord) или до фронта кнопки —
+    // его ISR будит нас сам. Сон отпускает loopAwake (PowerManager).
+    uint32_t idleMs = scheduler.msUntilNext();
+    const uint32_t inlineMs = serviceCore.msUntilNext();
+    if (inlineMs < idleMs) idleMs = inlineMs;
+    const uint32_t frameMs = screenManager.msUntilNextFrame();
+    if (frameMs < idleMs) idleMs = frameMs;
+    const uint32_t inputMs = buttons.msUntilNext();
+    if (inputMs < idleMs) idleMs = inputMs;
+
+    scheduler.idle(idleMs);
+}
@@ -1,60 +1,75 @@
 #include "screens/ClockScreen.h"
+#include "ui/ColorUtil.h"
 #include <math.h>
+#include <string.h>
 
 // =====================================================
-// Fade config (HH:MM)
+// Animation config
 // =====================================================
-static constexpr uint8_t FADE_STEPS = 6;
+// Fade HH:MM: 6 кадров при FPS_ANIM
+static constexpr uint16_t FADE_MS = 300;
+
+// Пульс ":" — период 1 с, плавности 10 кадров/с хватает с запасом
+static constexpr uint16_t PULSE_MS  = 1000;
+static constexpr uint8_t  COLON_FPS = 10;
+
+// Пульс живёт окно после входа на экран, дальше ":" ровный и экран
+// в покое (FPS_STATIC): часы на стене не держат 10 кадров/с вечно
+static constexpr uint32_t PULSE_WINDOW_MS = 30000;
 
 // =====================================================
 // Time layout
 // =====================================================
 static constexpr int TIME_SHIFT_X = 0;
-static constexpr int TIME_SHIFT_Y = -6;
 
-// =====================================================
-// DHT layout
-// =====================================================
-static constexpr int DHT_Y_OFFSET = 4;
-static constexpr int DHT_ROW_H    = 12;
+// Полосы DHT / HH:MM / секунд — в таблице layout (ui/Layout.h),
+// здесь только ширина поля секунд
+static constexpr int SEC_W = 24;
 
 // =====================================================
 // helpers
 // =====================================================
-static float smooth01(float t) {
-    if (t < 0.0f) t = 0.0f;
-    if (t > 1.0f) t = 1.0f;
-    return t * t * (3.0f - 2.0f * t);
-}
+// Залить r фоном, КРОМЕ hole (её закрывают opaque-глифы HH:MM).
+static void fillRectAround(
+    Adafruit_ST7735& tft,
+    const UiRect& r,
+    const UiRect& hole,
+    uint16_t color
+) {
+    const UiRect in = r.intersect(hole);
+    if (in.empty()) {
+        tft.fillRect(r.x, r.y, r.w, r.h, color);
+        return;
+    }
 
-// Пульсация для ":" — 0..1
-// Используем секунды + долю секунды → мягкое "дыхание"
-static float colonPulse(uint32_t ms) {
-    // период ~1 сек
-    float t = (float)(ms % 1000) / 1000.0f;
-    // sin: 0..1
-    return 0.5f + 0.5f * sinf(t * 2.0f * PI);
+    // сверху / снизу — на всю ширину, слева / справа — по высоте дырки
+    tft.fillRect(r.x, r.y, r.w, in.y - r.y, color);
+    tft.fillRect(r.x, in.bottom(), r.w, r.bottom() - in.bottom(), color);
+    tft.fillRect(r.x, in.y, in.x - r.x, in.h, color);
+    tft.fillRect(in.right(), in.y, r.right() - in.right(), in.h, color);
 }
 
 // =====================================================
 // ctor
 // =====================================================
 ClockScreen::ClockScreen(
-    Adafruit_ST7735& t,
+    UiDisplay& t,
     TimeService& timeService,
     NightTransitionService& nightTransition,
     ThemeService& themeService,
     LayoutService& layoutService,
-    UiVersionService& uiVer,
-    DhtService& dhtService
+    EventBus& bus,
+    DhtService& dhtService,
+    Timeline& tl
 )
     : Screen(themeService)
     , tft(t)
     , time(timeService)
     , night(nightTransition)
     , layout(layoutService)
-    , uiVersion(uiVer)
+    , screenEvents(bus, channelBit(UiChannel::SCREEN))
     , dht(dhtService)
+    , timeline(tl)
 {
 }
 
@@ -63,185 +78,275 @@ ClockScreen::ClockScreen(
 // =====================================================
 void ClockScreen::begin() {
 
-    uint32_t sv = uiVersion.version(UiChannel::SCREEN);
-    if (sv != lastScreenV) {
-        lastScreenV = sv;
-        fadeActive = true;
-        fadeStep   = 0;
+    // Размер цифр — из геометрии LayoutService (пересчёт только при смене)
+    sprites.begin(digitHeight());
+
+    static const Timeline::Spec FADE  = { 0, Q16_ONE, FADE_MS,  0, Timeline::Ease::SMOOTH, false };
+    static const Timeline::Spec PULSE = { 0, Q16_ONE, PULSE_MS, 0, Timeline::Ease::PULSE,  true  };
+
+    if (screenEvents.changed(UiChannel::SCREEN)) {
+        timeline.stop(fadeTrack);
+        fadeTrack = timeline.start(FADE);
     }
 
-    const ThemeBlend th = themeService().interpolate(night.value());
+    // Пульс — после fade (или сразу, если fade нет); один на экран
+    timeline.stop(pulseTrack);
+    pulseTrack   = timeline.chain(fadeTrack, PULSE);
+    pulseSinceMs = millis();
+    lastPulse    = Q16_HALF;
 
-    tft.fillRect(
+    // Экран полностью перерисует свою область в первом кадре
+    fullDirty = true;
+}
+
+// =====================================================
+// frame pacing
+// =====================================================
+uint8_t ClockScreen::targetFps() const {
+    return timeline.active(pulseTrack) ? COLON_FPS : FPS_STATIC;
+}
+
+// =====================================================
+// geometry
+// =====================================================
+UiRect ClockScreen::contentRect() const {
+    const UiLayout& L = layout.current();
+    return UiRect{
         0,
-        layout.contentY(),
-        tft.width(),
-        layout.contentH(),
-        th.bg
-    );
+        (int16_t)L.contentY,
+        (int16_t)L.width,
+        (int16_t)L.contentH
+    };
+}
 
-    lastTimeV = uiVersion.version(UiChannel::TIME);
-    lastDhtV  = uiVersion.version(UiChannel::DHT);
+// Полоса под HH:MM: от строки DHT до секунд
+int ClockScreen::digitHeight() const {
+    return layout.current().clockDigitsH;
+}
+
+UiRect ClockScreen::timeRect() const {
+    const UiLayout& L = layout.current();
+
+    const int w  = 4 * sprites.digitW() + sprites.colonW();
+    const int h  = sprites.digitH();
+
+    const int x0 = (L.width - w) / 2 + TIME_SHIFT_X;
+    const int y0 = L.clockDigitsY + (L.clockDigitsH - h) / 2;
+
+    return UiRect{ (int16_t)x0, (int16_t)y0, (int16_t)w, (int16_t)h };
+}
+
+UiRect ClockScreen::glyphRect(uint8_t pos) const {
+    const UiRect  t  = timeRect();
+    const int16_t dw = sprites.digitW();
+    const int16_t cw = sprites.colonW();
+
+    // HH  :  MM — ":" уже цифры
+    const int16_t x =
+        (pos < 2)  ? (int16_t)(t.x + pos * dw) :
+        (pos == 2) ? (int16_t)(t.x + 2 * dw) :
+                     (int16_t)(t.x + (pos - 1) * dw + cw);
+
+    return UiRect{ x, t.y, (pos == 2) ? cw : dw, t.h };
+}
 
-    drawTime(true);
-    drawDht(true);
+UiRect ClockScreen::secRect() const {
+    const UiRect t = timeRect();
+    return UiRect{
+        (int16_t)(t.right() - SEC_W),
+        (int16_t)(t.bottom() + CLOCK_SEC_GAP),
+        SEC_W,
+        CLOCK_SEC_H
+    };
+}
+
+UiRect ClockScreen::dhtRect() const {
+    const UiLayout& L = layout.current();
+    return UiRect{
+        0,
+        (int16_t)L.clockDhtY,
+        (int16_t)L.width,
+        (int16_t)L.clockDhtH
+    };
 }
 
 // =====================================================
-// update
+// update — считаем кадр и помечаем изменившиеся части
 // =====================================================
-void ClockScreen::update() {
+void ClockScreen::update(DirtyRegion& dirty) {
 
     // ===== NIGHT TRANSITION =====
-    if (night.dirty()) {
-        night.clearDirty();
-        drawTime(true);
-        drawDht(true);
-        return;
+    // Готовые цвета из таблицы ThemeService (O(1)).
+    // Сменился квант перехода / температура / яркость → весь контент.
+    const ThemeBlend& nt = themeService().at(night.value8());
+    if (memcmp(&nt, &th, sizeof(ThemeBlend)) != 0) {
+        th = nt;
+        fullDirty = true;
     }
-
-    // ===== FADE HH:MM =====
-    if (fadeActive) {
-        drawTime(true);
-        fadeStep++;
-        if (fadeStep >= FADE_STEPS) {
-            fadeActive = false;
+    night.clearDirty();
+
+    ClockFrame next = frame;
+
+    // ===== TIME =====
+    next.timeValid = time.isValid();
+    next.h = (int8_t)time.hour();
+    next.m = (int8_t)time.minute();
+    next.s = (int8_t)time.second();
+
+    // ---- fade HH:MM ----
+    const q16_t fadeK = timeline.value(fadeTrack, Q16_ONE);
+    next.digitColor = blend565(th.muted, th.fg, q16ToU8(fadeK));
+
+    // ---- ":" (СТАБИЛЬНО ВИДИМОЕ + МЯГКАЯ ПУЛЬСАЦИЯ) ----
+    // Базовый цвет — ВСЕГДА видимый
+    next.colonColor = th.accent;
+    // После fade (pulseTrack ждёт в цепочке) — мягкая пульсация яркости
+    if (!timeline.active(fadeTrack)) {
+        q16_t pulse = timeline.value(pulseTrack, Q16_HALF); // 0..1
+
+        // Окно пульса кончилось — гасим на подъёме через середину:
+        // ":" остаётся на среднем уровне без скачка цвета
+        if (timeline.active(pulseTrack) &&
+            millis() - pulseSinceMs >= PULSE_WINDOW_MS &&
+            lastPulse < Q16_HALF && pulse >= Q16_HALF) {
+            timeline.stop(pulseTrack);
+            pulseTrack = Timeline::NONE;
+            pulse      = Q16_HALF;
         }
-        return;
+        lastPulse = pulse;
+
+        // Лёгкое усиление яркости, а не замена цвета
+        next.colonColor = blend565(next.colonColor, th.fg, q16ToU8(pulse));
     }
 
-// ===== TIME =====
-uint32_t timeV = uiVersion.version(UiChannel::TIME);
-if (timeV != lastTimeV) {
-    lastTimeV = timeV;
-    drawTime(false);
-} else {
-    // перерисовываем ":" для пульсации
-    drawTime(false);
-}
     // ===== DHT =====
-    uint32_t dhtV = uiVersion.version(UiChannel::DHT);
-    if (dht.isValid() && (!dhtDrawnOnce || dhtV != lastDhtV)) {
-        lastDhtV = dhtV;
-        drawDht(false);
+    next.dhtValid = dht.isValid();
+    if (next.dhtValid) {
+        next.temp = (int16_t)round(dht.temperature());
+        next.hum  = (int16_t)round(dht.humidity());
     }
-}
-
-// =====================================================
-// drawTime — ШАГ A (ТОЛЬКО :)
-// =====================================================
-void ClockScreen::drawTime(bool force) {
 
-    if (!time.isValid())
+    // ===== DIRTY =====
+    if (fullDirty) {
+        fullDirty = false;
+        dirty.add(contentRect());
+        frame = next;
         return;
+    }
 
-    const ThemeBlend th = themeService().interpolate(night.value());
+    const bool validChanged = next.timeValid != frame.timeValid;
+    const bool colorChanged = next.digitColor != frame.digitColor;
 
-    // ---- fade HH:MM (как было) ----
-    float fadeK = 1.0f;
-    if (fadeActive) {
-        fadeK = smooth01((float)fadeStep / (float)FADE_STEPS);
-    }
+    // ---- цифры: только те, у которых сменилось значение или цвет ----
+    const int8_t was[4] = { (int8_t)(frame.h / 10), (int8_t)(frame.h % 10),
+                            (int8_t)(frame.m / 10), (int8_t)(frame.m % 10) };
+    const int8_t now[4] = { (int8_t)(next.h / 10),  (int8_t)(next.h % 10),
+                            (int8_t)(next.m / 10),  (int8_t)(next.m % 10) };
+    static const uint8_t POS[4] = { 0, 1, 3, 4 };
 
-    const int h = time.hour();
-    const int m = time.minute();
-    const int s = time.second();
+    for (uint8_t i = 0; i < 4; i++) {
+        if (validChanged || colorChanged || was[i] != now[i]) {
+            dirty.add(glyphRect(POS[i]));
+        }
+    }
 
-    const int DIGIT_W = 18;
-    const int DIGIT_H = 24;
-    const int TIME_W  = 5 * DIGIT_W;
-    const int TIME_H  = DIGIT_H;
+    // ":" перерисовываем ТОЛЬКО когда реально сменился цвет пульсации
+    if (validChanged || next.colonColor != frame.colonColor) {
+        dirty.add(glyphRect(2));
+    }
 
-    const int X0 = (tft.width() - TIME_W) / 2 + TIME_SHIFT_X;
-    const int Y0 = layout.contentY()
-                 + (layout.contentH() - TIME_H) / 2
-                 + TIME_SHIFT_Y;
+    // секунды — ТОЛЬКО при реальном изменении времени
+    if (validChanged || next.s != frame.s) {
+        dirty.add(secRect());
+    }
 
-    if (force) {
-        tft.fillRect(X0, Y0, TIME_W, TIME_H, th.bg);
+    if (next.dhtValid != frame.dhtValid ||
+        (next.dhtValid && (next.temp != frame.temp || next.hum != frame.hum))) {
+        dirty.add(dhtRect());
     }
 
-    tft.setTextSize(3);
+    frame = next;
+}
 
-    // ---- HH ----
-    uint16_t hhColor =
-        ThemeService::blend565(th.muted, th.fg, fadeK);
-
-    tft.setTextColor(hhColor, th.bg);
-    tft.setCursor(X0, Y0);
-    tft.printf("%02d", h);
-
-float nightK = night.value(); // 0..1
-    // В Day: accent → accent
-    // В Night: accent → muted
-
-// ---- ":" (СТАБИЛЬНО ВИДИМОЕ + МЯГКАЯ ПУЛЬСАЦИЯ) ----
-// Базовый цвет — ВСЕГДА видимый
-uint16_t colonColor = th.accent;
-// После fade добавляем мягкую пульсацию яркости
-if (!fadeActive) {
-    float pulse = colonPulse(millis()); // 0..1
-    // Лёгкое усиление яркости, а не замена цвета
-    colonColor = ThemeService::blend565(colonColor, th.fg, pulse * 1.0f);
+// =====================================================
+// draw
+// =====================================================
+void ClockScreen::draw() {
+
+    // Фон контента. Блок HH:MM закрывают сами opaque-глифы,
+    // поэтому под ним фон не льём (иначе двойная запись пикселей).
+    if (frame.timeValid) {
+        fillRectAround(tft, contentRect(), timeRect(), th.bg);
+    } else {
+        const UiRect c = contentRect();
+        tft.fillRect(c.x, c.y, c.w, c.h, th.bg);
+    }
+
+    drawTime();
+    drawDht();
 }
 
-tft.setTextColor(colonColor, th.bg);
-tft.setCursor(X0 + 2 * DIGIT_W, Y0);
-tft.print(":");
+// =====================================================
+// drawTime — ШАГ A (ТОЛЬКО :)
+// =====================================================
+void ClockScreen::drawTime() {
 
-    // ---- MM ----
-    uint16_t mmColor =
-        ThemeService::blend565(th.muted, th.fg, fadeK);
+    if (!frame.timeValid)
+        return;
 
-    tft.setTextColor(mmColor, th.bg);
-    tft.setCursor(X0 + 3 * DIGIT_W, Y0);
-    tft.printf("%02d", m);
+    // ---- HH ----
+    drawGlyph(0, frame.h / 10, frame.digitColor);
+    drawGlyph(1, frame.h % 10, frame.digitColor);
 
-// ---- seconds ----
-// секунды перерисовываем ТОЛЬКО при реальном изменении времени
-static int lastSec = -1;
-if (s != lastSec || force) {
-    lastSec = s;
+    // ---- ":" ----
+    drawGlyph(2, DigitSpriteCache::COLON, frame.colonColor);
 
-    const int SEC_X = X0 + TIME_W - 24;
-    const int SEC_Y = Y0 + TIME_H + 4;
+    // ---- MM ----
+    drawGlyph(3, frame.m / 10, frame.digitColor);
+    drawGlyph(4, frame.m % 10, frame.digitColor);
+
+    // ---- seconds ----
+    const UiRect sr = secRect();
 
-    tft.fillRect(SEC_X, SEC_Y, 24, 12, th.bg);
     tft.setTextSize(1);
     tft.setTextColor(th.muted, th.bg);
-    tft.setCursor(SEC_X, SEC_Y);
-    tft.printf("%02d", s);
+    tft.setCursor(sr.x, sr.y);
+    tft.printf("%02d", frame.s);
 }
+
+// Один глиф — один спрайт, одно окно адреса.
+// Глифы вне текущего clip не трогаем вовсе (и не гоняем LRU).
+void ClockScreen::drawGlyph(uint8_t pos, uint8_t glyph, uint16_t color) {
+
+    const UiRect r = glyphRect(pos);
+    if (!tft.clipIntersects(r.x, r.y, r.w, r.h))
+        return;
+
+    const uint16_t* px = sprites.sprite(glyph, color, th.bg);
+    tft.blit(r.x, r.y, r.w, r.h, px);
 }
 
 // =====================================================
 // drawDht
 // =====================================================
-void ClockScreen::drawDht(bool force) {
-
-    const ThemeBlend th = themeService().interpolate(night.value());
-    const int y = layout.contentY() + DHT_Y_OFFSET;
-
-    if (force) {
-        tft.fillRect(0, y, tft.width(), DHT_ROW_H, th.bg);
-    }
+void ClockScreen::drawDht() {
 
-    if (!dht.isValid())
+    if (!frame.dhtValid)
         return;
 
+    const int y = dhtRect().y;
+
     tft.setTextSize(2);
     tft.setTextColor(th.warn, th.bg);
     tft.setTextWrap(false);
 
     tft.setCursor(4, y);
-    tft.printf("%dC", (int)round(dht.temperature()));
+    tft.printf("%dC", frame.temp);
 
     char buf[8];
-    snprintf(buf, sizeof(buf), "%d%%", (int)round(dht.humidity()));
+    snprintf(buf, sizeof(buf), "%d%%", frame.hum);
 
     const int w = strlen(buf) * 8;
     tft.setCursor(tft.width() - w-15 , y);
     tft.print(buf);
-
-    dhtDrawnOnce = true;
-} 
\ No newline at end of file
+}
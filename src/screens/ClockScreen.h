@@ -3,12 +3,15 @@
 #include <Adafruit_ST7735.h>
 
 #include "core/Screen.h"
+#include "core/Timeline.h"
+#include "ui/UiDisplay.h"
+#include "ui/DigitSpriteCache.h"
 
 #include "services/TimeService.h"
 #include "services/NightTransitionService.h"
 #include "services/ThemeService.h"
 #include "services/LayoutService.h"
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 #include "services/DhtService.h"
 
 /*
@@ -23,42 +26,100 @@
  * UX:
  *  - Пульсирующее двоеточие (:)
  *  - HH / MM не затрагиваются (Шаг A)
+ *
+ * КАДР:
+ *  - update() считает "что должно быть на экране" (ClockFrame)
+ *    и помечает грязными ТОЛЬКО изменившиеся части:
+ *    каждую цифру HH / MM отдельно, ":", секунды, DHT
+ *  - draw() рисует ClockFrame целиком, лишнее отсекает clip
+ *  - цифры и ":" — готовые RGB565 спрайты (DigitSpriteCache),
+ *    каждый уходит одним окном адреса
+ *
+ * АНИМАЦИИ (Timeline):
+ *  - fade HH:MM после смены экрана — дорожка SMOOTH
+ *  - пульс ":" — loop-дорожка PULSE, по цепочке после fade; живёт
+ *    PULSE_WINDOW_MS после begin(), потом ":" ровный
+ *
+ * ТЕМП:
+ *  - пока идёт пульс — COLON_FPS, после — FPS_STATIC (секунды и
+ *    минуты дают внеочередной кадр через публикацию TIME)
+ *
+ * ЦИФРЫ:
+ *  - сглаженный шрифт, высота — полоса между DHT и секундами
+ *    (digitHeight() из LayoutService), ":" вдвое уже цифры
  */
 
 class ClockScreen : public Screen {
 public:
     ClockScreen(
-        Adafruit_ST7735&        tft,
+        UiDisplay&              tft,
         TimeService&            timeService,
         NightTransitionService& nightTransition,
         ThemeService&           themeService,
         LayoutService&          layoutService,
-        UiVersionService&       uiVersion,
-        DhtService&             dhtService
+        EventBus&               bus,
+        DhtService&             dhtService,
+        Timeline&               timeline
     );
 
     void begin() override;
-    void update() override;
+    void update(DirtyRegion& dirty) override;
+    void draw() override;
+
+    // Пульс ":" — COLON_FPS, в покое FPS_STATIC
+    // (fade и переход день-ночь ускоряет Timeline)
+    uint8_t targetFps() const override;
+
+    UiTag uiTag() const override { return UiTag::CLOCK; }
+
+    bool redrawPending() const override { return fullDirty; }
 
 private:
-    void drawTime(bool force);
-    void drawDht(bool force);
+    // Снимок того, что нарисовано (или будет нарисовано) в этом кадре
+    struct ClockFrame {
+        bool     timeValid;
+        int8_t   h;
+        int8_t   m;
+        int8_t   s;
+        uint16_t digitColor;   // HH / MM (с учётом fade)
+        uint16_t colonColor;   // ":" (с учётом пульсации)
+
+        bool     dhtValid;
+        int16_t  temp;         // °C, округлено
+        int16_t  hum;          // %,  округлено
+    };
+
+    void drawTime();
+    void drawDht();
+    void drawGlyph(uint8_t pos, uint8_t glyph, uint16_t color);
+
+    // Геометрия (зависит от LayoutService)
+    // pos: 0,1 — HH, 2 — ":", 3,4 — MM
+    int    digitHeight() const;
+    UiRect contentRect() const;
+    UiRect timeRect() const;
+    UiRect glyphRect(uint8_t pos) const;
+    UiRect secRect() const;
+    UiRect dhtRect() const;
 
 private:
-    Adafruit_ST7735&        tft;
+    UiDisplay&              tft;
     TimeService&            time;
     NightTransitionService& night;
     LayoutService&          layout;
-    UiVersionService&       uiVersion;
+    EventBus::Subscriber    screenEvents;   // SCREEN → fade HH:MM
     DhtService&             dht;
+    Timeline&               timeline;
 
-    uint32_t lastTimeV    = 0;
-    uint32_t lastDhtV     = 0;
-    uint32_t lastScreenV  = 0;
+    ThemeBlend th{};
+    ClockFrame frame{};
+    bool       fullDirty = true;
 
-    bool     dhtDrawnOnce = false;
+    DigitSpriteCache sprites;
 
-    // fade HH:MM (оставляем как было)
-    bool     fadeActive   = false;
-    uint8_t  fadeStep     = 0;
+    // fade HH:MM → пульс ":"
+    Timeline::Id fadeTrack  = Timeline::NONE;
+    Timeline::Id pulseTrack = Timeline::NONE;
+    uint32_t     pulseSinceMs = 0;
+    q16_t        lastPulse    = Q16_HALF;
 };
\ No newline at end of file
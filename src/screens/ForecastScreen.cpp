@@ -12,7 +12,7 @@
  * ПРИНЦИПЫ:
  *  - Экран не знает Day / Night
  *  - Экран использует ТОЛЬКО ThemeBlend
- *  - Экран реактивен через UiVersionService
+ *  - Экран реактивен через EventBus
  *
  * Любые изменения цвета / темы приходят извне
  * (ThemeService + NightTransitionService + ColorTemperatureService).
@@ -25,31 +25,28 @@
 // helpers
 // ============================================================================
 
-static float clamp01(float v) {
-    if (v < 0.0f) return 0.0f;
-    if (v > 1.0f) return 1.0f;
-    return v;
+// "Псевдо-fade" без альфы: день, уехавший от центра дальше чем на
+// 55% ширины, рисуем muted, ближе — fg. Это не настоящая прозрачность,
+// но выглядит мягче (и без float: сравнение в целых).
+static uint16_t fadeTextColor(const ThemeBlend& b, int xOff, int w) {
+    const int d = xOff < 0 ? -xOff : xOff;
+    if (d * 100 > w * 55) return b.muted;
+    return b.fg;
 }
 
-// Простейшее smoothstep для прогресса анимации (0..1).
-static float smooth01(float t) {
-    t = clamp01(t);
-    return t * t * (3.0f - 2.0f * t);
-}
+// Тот же fade для карточки (она нарисована при xOff=0 и цветов
+// по положению не знает): blit смешивает её с bg. У края экрана —
+// на полпути к bg, примерно как muted у текста; в центре — как есть.
+static constexpr int CARD_FADE_MAX = 128;
 
-// "Псевдо-fade" без альфы: на первых кадрах рисуем muted,
-// ближе к финалу — fg. Это не настоящая прозрачность, но выглядит мягче.
-static uint16_t fadeTextColor(const ThemeBlend& b, float k) {
-    // k: 0..1 (0 - приглушённо, 1 - ярко)
-    // Мы не умеем смешивать 565 корректно без утилиты, поэтому:
-    // делаем дискрет: 0..0.45 -> muted, 0.45..0.75 -> fg, >0.75 -> fg
-    // (да, два шага. На TFT это выглядит ок и дешево.)
-    if (k < 0.45f) return b.muted;
-    return b.fg;
+static uint8_t cardAlpha(int xOff, int w) {
+    int d = xOff < 0 ? -xOff : xOff;
+    if (d > w) d = w;
+    return (uint8_t)(255 - d * CARD_FADE_MAX / w);
 }
 
 static void drawDegreeDot(
-    Adafruit_ST7735& tft,
+    Adafruit_GFX& tft,
     int x,
     int y,
     uint16_t color
@@ -61,17 +58,23 @@ static void drawDegreeDot(
 // ctor
 // ============================================================================
 ForecastScreen::ForecastScreen(
-    Adafruit_ST7735&  tft,
+    UiDisplay&        tft,
     ThemeService&     theme,
     ForecastService&  forecast,
     LayoutService&    layout,
-    UiVersionService& ui
+    EventBus&         bus,
+    Timeline&         timeline
 )
     : Screen(theme)
     , _tft(tft)
     , _forecast(forecast)
     , _layout(layout)
-    , _ui(ui)
+    , _timeline(timeline)
+    , _events(
+          bus,
+          channelBit(UiChannel::THEME) |
+          channelBit(UiChannel::SCREEN) |
+          channelBit(UiChannel::FORECAST))
 {
 }
 
@@ -90,13 +93,27 @@ void ForecastScreen::begin() {
     _state     = UiState::LOADING;
     _lastState = UiState::ERROR;
 
-    _animActive  = false;
-    _animStartMs = 0;
-    _animDir     = 0;
+    _timeline.stop(_animTrack);
+    _animActive = false;
+    _animDir    = 0;
+
+    // Память под карточки — пока экран на дисплее (не вышло — рисуем напрямую)
+    _cards.begin(_tft.width(), _layout.current().contentH);
 
     _dirty = true;
 }
 
+// ============================================================================
+// end — экран уходит: карточки не держат кучу под чужими экранами
+// ============================================================================
+void ForecastScreen::end() {
+
+    _timeline.stop(_animTrack);
+    _animActive = false;
+
+    _cards.end();
+}
+
 // ============================================================================
 // buttons
 // ============================================================================
@@ -126,27 +143,62 @@ void ForecastScreen::startDayTransition(int dir) {
     if (next < 0) return;
     if (next >= (int)_forecast.daysCount()) return;
 
-    _animActive  = true;
-    _animStartMs = millis();
-    _animDir     = dir;
-    _animFrom    = _dayIndex;
-    _animTo      = (uint8_t)next;
+    static const Timeline::Spec SLIDE = {
+        0, Q16_ONE, ANIM_MS, 0, Timeline::Ease::SMOOTH, false
+    };
 
-    // Во время анимации мы будем рисовать оба дня по кадрам.
     _dirty = true;
+
+    _animTrack = _timeline.start(SLIDE, &ForecastScreen::onAnimDone, this);
+    if (_animTrack == Timeline::NONE) {
+        // Пул дорожек занят — просто переключаем день
+        _dayIndex = (uint8_t)next;
+        return;
+    }
+
+    _animActive = true;
+    _animDir    = dir;
+    _animFrom   = _dayIndex;
+    _animTo     = (uint8_t)next;
+    _animT      = 0;
+
+    // Во время анимации мы будем рисовать оба дня по кадрам.
+}
+
+// Последний кадр анимации == обычный экран нового дня:
+// update() увидит смену _dayIndex и перерисует контент.
+void ForecastScreen::onAnimDone(void* ctx) {
+    ForecastScreen* self = static_cast<ForecastScreen*>(ctx);
+    self->_animActive = false;
+    self->_dayIndex   = self->_animTo;
 }
 
 // ============================================================================
 // update (reactive)
 // ============================================================================
-void ForecastScreen::update() {
+UiRect ForecastScreen::contentRect() const {
+    const UiLayout& L = _layout.current();
+    return UiRect{
+        0,
+        (int16_t)L.contentY,
+        (int16_t)L.width,
+        (int16_t)L.contentH
+    };
+}
+
+void ForecastScreen::update(DirtyRegion& dirty) {
 
-    // Реакция на смену темы или явный запрос перерисовки экрана
-    if (_ui.changed(UiChannel::THEME) ||
-        _ui.changed(UiChannel::SCREEN)) {
+    // Смена темы, явный запрос перерисовки экрана, новые данные прогноза
+    if (_events.poll()) {
         _dirty = true;
     }
 
+    // Палитра пересчитана (фильтры) — старые цветные иконки не нужны
+    _icons.sync(themeService().tableVersion());
+
+    // Новые данные или другие цвета — карточки дней перерисуются
+    _cards.sync(_forecast.version(), themeService().blend());
+
     // Пока сервис обновляется — UI не трогаем
     if (_forecast.isUpdating()) return;
 
@@ -159,9 +211,30 @@ void ForecastScreen::update() {
         _state = UiState::READY;
     }
 
-    // Если анимация активна — мы рисуем кадры, даже если "вроде ничего не менялось".
+    // LOADING / ERROR анимацию отменяют
+    if (_animActive && _state != UiState::READY) {
+        _timeline.stop(_animTrack);
+        _animActive = false;
+    }
+
+    // Если анимация активна — каждый кадр перерисовываем контент,
+    // даже если "вроде ничего не менялось".
     if (_animActive) {
-        redrawAll();
+
+        _animT = _timeline.value(_animTrack, Q16_ONE);
+
+        // Если вдруг данных нет — прекращаем анимацию.
+        if (!_forecast.day(_animFrom) || !_forecast.day(_animTo)) {
+            _timeline.stop(_animTrack);
+            _animActive = false;
+            _dayIndex   = _animTo;
+        }
+
+        dirty.add(contentRect());
+
+        _lastState    = _state;
+        _lastDayIndex = _dayIndex;
+        _dirty        = false;
         return;
     }
 
@@ -172,7 +245,7 @@ void ForecastScreen::update() {
         return;
     }
 
-    redrawAll();
+    dirty.add(contentRect());
 
     _lastState    = _state;
     _lastDayIndex = _dayIndex;
@@ -180,47 +253,52 @@ void ForecastScreen::update() {
 }
 
 // ============================================================================
-// redraw all
+// draw
 // ============================================================================
-void ForecastScreen::redrawAll() {
+void ForecastScreen::draw() {
 
     // ЕДИНСТВЕННАЯ точка получения цветов (уже после Day/Night + ColorTemp)
     const ThemeBlend& b = themeService().blend();
 
+    // Геометрия кадра — одна строка таблицы layout
+    const UiLayout& L = _layout.current();
+
+    _tft.setFont(nullptr);
+    _tft.setTextSize(1);
+    _tft.setTextWrap(false);
+
+    // ----- READY через карточки: blit'ы закрывают контент целиком -----
+    if (_state == UiState::READY && drawReadyCards(b)) return;
+
     // ------------------------------------------------------------------------
     // Фон рабочей области (чистим всегда, потому что:
     //  - анимация требует чистого холста
-    //  - и это гарантирует отсутствие "хвостов"
+    //  - и это гарантирует отсутствие "хвостов")
+    // Строки ниже фон уже НЕ заливают — пиксели уходят по SPI один раз.
     // ------------------------------------------------------------------------
     _tft.fillRect(
         0,
-        _layout.contentY(),
-        _tft.width(),
-        _layout.contentH(),
+        L.contentY,
+        L.width,
+        L.contentH,
         b.bg
     );
 
     // ----- LOADING -----
     if (_state == UiState::LOADING) {
-        drawHeaderAtX(b, nullptr, 0, 0, 0);
+        drawHeaderAtX(_tft, b, nullptr, 0, 0, 0, L.contentY);
         drawLoading(b);
-        _animActive = false;
-        _dirty = false;
-        _lastState = _state;
         return;
     }
 
     // ----- ERROR -----
     if (_state == UiState::ERROR) {
-        drawHeaderAtX(b, nullptr, 0, 0, 0);
+        drawHeaderAtX(_tft, b, nullptr, 0, 0, 0, L.contentY);
         drawError(b);
-        _animActive = false;
-        _dirty = false;
-        _lastState = _state;
         return;
     }
 
-    // ----- READY -----
+    // ----- READY (без карточек: нет памяти) -----
     // Если идёт анимация — рисуем кадр, иначе рисуем обычный экран.
     if (_animActive) {
         drawTransitionFrame(b);
@@ -230,24 +308,74 @@ void ForecastScreen::redrawAll() {
     const ForecastDay* d = _forecast.day(_dayIndex);
     if (!d) return;
 
-    drawReadyAtX(b, d, _dayIndex + 1, _forecast.daysCount(), 0);
+    drawReadyAtX(_tft, b, d, _dayIndex + 1, _forecast.daysCount(), 0, L.contentY);
+}
 
-    _lastState    = _state;
-    _lastDayIndex = _dayIndex;
-    _dirty        = false;
+// ============================================================================
+// cards — день рисуется в холст один раз, дальше только blit
+// ============================================================================
+GFXcanvas16* ForecastScreen::cardFor(const ThemeBlend& b, uint8_t day, int keep) {
+
+    GFXcanvas16* c = _cards.find(day);
+    if (c) return c;
+
+    const ForecastDay* d = _forecast.day(day);
+    if (!d) return nullptr;
+
+    c = _cards.acquire(day, keep);
+    if (!c) return nullptr;
+
+    c->setFont(nullptr);
+    c->setTextSize(1);
+    c->fillScreen(b.bg);
+
+    drawReadyAtX(*c, b, d, day + 1, _forecast.daysCount(), 0, 0);
+    return c;
+}
+
+bool ForecastScreen::drawReadyCards(const ThemeBlend& b) {
+
+    if (!_cards.ready()) return false;
+
+    const UiLayout& L = _layout.current();
+
+    // Layout поменял высоту контента — карточки уже не подходят
+    if (_cards.height() != L.contentH) return false;
+
+    const int16_t y0 = (int16_t)L.contentY;
+    const int16_t w  = _cards.width();
+    const int16_t h  = _cards.height();
+
+    if (!_animActive) {
+        GFXcanvas16* c = cardFor(b, _dayIndex, -1);
+        if (!c) return false;
+
+        _tft.blit(0, y0, w, h, c->getBuffer());
+        return true;
+    }
+
+    // Каждая карточка бережёт другую от вытеснения
+    GFXcanvas16* from = cardFor(b, _animFrom, _animTo);
+    GFXcanvas16* to   = cardFor(b, _animTo,   _animFrom);
+    if (!from || !to) return false;
+
+    // Карточки стыкуются без зазора: new = old + dir * W
+    const int xOld = slideOffset();
+    const int xNew = xOld + _animDir * w;
+
+    // blit сам режет окно по экрану и клипу компоновщика;
+    // смешиваются только видимые пиксели
+    _tft.blitBlend((int16_t)xOld, y0, w, h, from->getBuffer(), b.bg, cardAlpha(xOld, w));
+    _tft.blitBlend((int16_t)xNew, y0, w, h, to->getBuffer(),   b.bg, cardAlpha(xNew, w));
+    return true;
 }
 
 // ============================================================================
 // transition frame
 // ============================================================================
-void ForecastScreen::drawTransitionFrame(const ThemeBlend& b) {
-
-    const uint32_t now = millis();
-    uint32_t elapsed = now - _animStartMs;
-    if (elapsed > ANIM_MS) elapsed = ANIM_MS;
+int ForecastScreen::slideOffset() const {
 
-    float t = (float)elapsed / (float)ANIM_MS;     // 0..1
-    t = smooth01(t);
+    const q16_t t = _animT;     // 0..1 (Q16), уже со smoothstep
 
     const int W = _tft.width();
 
@@ -262,94 +390,122 @@ void ForecastScreen::drawTransitionFrame(const ThemeBlend& b) {
     //  old: x = +t*W
     //  new: x = -(1-t)*W
     //
-    const int xOld = (int)lroundf((float)(- _animDir) * t * (float)W);
-    const int xNew = (int)lroundf((float)(- _animDir) * (t - 1.0f) * (float)W);
+    return (int)q16Round(-_animDir * t * W);
+}
+
+void ForecastScreen::drawTransitionFrame(const ThemeBlend& b) {
+
+    const int xOld = slideOffset();
+    const int xNew = xOld + _animDir * _tft.width();
 
     const ForecastDay* dOld = _forecast.day(_animFrom);
     const ForecastDay* dNew = _forecast.day(_animTo);
 
-    // Если вдруг данных нет — прекращаем анимацию.
-    if (!dOld || !dNew) {
-        _animActive = false;
-        _dayIndex = _animTo;
-        _dirty = true;
-        return;
-    }
+    if (!dOld || !dNew) return;
 
     // Рисуем оба дня. Порядок: сначала old, потом new (чтобы new был "сверху").
-    drawReadyAtX(b, dOld, _animFrom + 1, _forecast.daysCount(), xOld);
-    drawReadyAtX(b, dNew, _animTo   + 1, _forecast.daysCount(), xNew);
-
-    // Завершение
-    if (elapsed >= ANIM_MS) {
-        _animActive  = false;
-        _dayIndex    = _animTo;
-        _lastDayIndex = 255; // форсим корректный redraw при следующем апдейте
-        _dirty       = true;
-    }
+    const int y0 = _layout.current().contentY;
+
+    drawReadyAtX(_tft, b, dOld, _animFrom + 1, _forecast.daysCount(), xOld, y0);
+    drawReadyAtX(_tft, b, dNew, _animTo   + 1, _forecast.daysCount(), xNew, y0);
 }
 
 // ============================================================================
 // ready (one day) at x offset
 // ============================================================================
 void ForecastScreen::drawReadyAtX(
+    Adafruit_GFX& g,
     const ThemeBlend& b,
     const ForecastDay* d,
     uint8_t idx,
     uint8_t total,
-    int xOff
+    int xOff,
+    int y0
 ) {
-    drawHeaderAtX(b, d, idx, total, xOff);
-    drawRowDayAtX(b, d, xOff);
-    drawRowNightAtX(b, d, xOff);
-    drawRowHumAtX(b, d->humidity, xOff);
+    drawHeaderAtX(g, b, d, idx, total, xOff, y0);
+    drawRowDayAtX(g, b, d, xOff, y0);
+    drawRowNightAtX(g, b, d, xOff, y0);
+    drawRowHumAtX(g, b, d->humidity, xOff, y0);
 }
 
 // ============================================================================
 // header at x offset
 // ============================================================================
 void ForecastScreen::drawHeaderAtX(
+    Adafruit_GFX& g,
     const ThemeBlend& b,
     const ForecastDay* d,
     uint8_t idx,
     uint8_t total,
-    int xOff
+    int xOff,
+    int y0
 ) {
-    const int y = _layout.contentY() + 4;
+    const int y = y0 + 4;
 
     // Полоса заголовка — внутри content области, поэтому можно рисовать с оффсетом.
-    // Фон заголовка уже очищен в redrawAll(), но для безопасности подчистим.
-    _tft.fillRect(xOff, y, _tft.width(), 18, b.bg);
+    // Фон заголовка уже залит (draw() или холст карточки).
 
     const char* names[] = {
         "SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"
     };
 
-    _tft.setTextColor(b.muted, b.bg);
+    g.setTextColor(b.muted, b.bg);
 
-    _tft.setCursor(xOff + 10, y + 4);
-    _tft.print(d ? names[d->weekday % 7] : "---");
+    g.setCursor(xOff + 10, y + 4);
+    g.print(d ? names[d->weekday % 7] : "---");
 
-    _tft.setCursor(xOff + _tft.width() - 30, y + 4);
+    g.setCursor(xOff + g.width() - 30, y + 4);
     if (d && total) {
         char buf[8];
         snprintf(buf, sizeof(buf), "%d/%d", idx, total);
-        _tft.print(buf);
+        g.print(buf);
     } else {
-        _tft.print("--/--");
+        g.print("--/--");
+    }
+}
+
+// ============================================================================
+// icon — цветной спрайт из кеша (на дисплей — одним окном адреса)
+// ============================================================================
+void ForecastScreen::drawIconAtX(
+    Adafruit_GFX& g,
+    const ThemeBlend& b,
+    const WeatherIcon& icon,
+    int x,
+    int y
+) {
+    const bool toDisplay = (&g == static_cast<Adafruit_GFX*>(&_tft));
+
+    // Целиком вне экрана/клипа — не трогаем кеш
+    if (toDisplay && !_tft.clipIntersects(x, y, icon.width, icon.height)) return;
+
+    const uint16_t* px = _icons.get(icon, b.fg, b.bg);
+
+    if (px && toDisplay) {
+        _tft.blit(x, y, icon.width, icon.height, px);
+        return;
+    }
+
+    if (px) {
+        g.drawRGBBitmap(x, y, px, icon.width, icon.height);
+        return;
     }
+
+    // Нестандартный размер — старый путь
+    g.drawBitmap(x, y, icon.data, icon.width, icon.height, b.fg);
 }
 
 // ============================================================================
 // rows at x offset
 // ============================================================================
 void ForecastScreen::drawRowDayAtX(
+    Adafruit_GFX& g,
     const ThemeBlend& b,
     const ForecastDay* d,
-    int xOff
+    int xOff,
+    int y0
 ) {
-    const int y = _layout.contentY() + 18;
-    _tft.fillRect(xOff, y, _tft.width(), 16, b.bg);
+    const int y = y0 + 18;
 
     // Иконка дня
     WeatherIcon icon = getWeatherIcon(d->weatherCode, false);
@@ -357,29 +513,14 @@ void ForecastScreen::drawRowDayAtX(
     // ВАЖНО:
     // Экран не решает "ночь/день". Цвет иконки берём из ThemeBlend (уже
     // обработанного ColorTemperatureService'ом).
-    const uint16_t iconColor = b.fg;
-
-    _tft.drawBitmap(
-        xOff + 4, y + 1,
-        icon.data,
-        icon.width,
-        icon.height,
-        iconColor
-    );
+    drawIconAtX(g, b, icon, xOff + 4, y + 1);
 
     // Псевдо-fade для текста (в анимации выглядит мягче):
     // вычисляем "видимую яркость" по положению на экране
-    float k = 1.0f;
-    // если уезжаем далеко — немного приглушаем
-    if (xOff != 0) {
-        k = 1.0f - (fabsf((float)xOff) / (float)_tft.width());
-        k = clamp01(k);
-    }
-
-    const uint16_t tc = fadeTextColor(b, k);
+    const uint16_t tc = fadeTextColor(b, xOff, g.width());
 
-    _tft.setTextColor(tc, b.bg);
-    _tft.setCursor(xOff + 32, y + 6);
+    g.setTextColor(tc, b.bg);
+    g.setCursor(xOff + 32, y + 6);
 
     float temp =
         !isnan(d->tempDay)   ? d->tempDay :
@@ -387,90 +528,74 @@ void ForecastScreen::drawRowDayAtX(
                                NAN;
 
     if (isnan(temp)) {
-        _tft.print("Day:   --");
+        g.print("Day:   --");
         return;
     }
 
     int tInt = (int)lround(temp);
     char buf[16];
     snprintf(buf, sizeof(buf), "Day:   %d", tInt);
-    _tft.print(buf);
+    g.print(buf);
 
     int x = xOff + 32 + (int)strlen(buf) * 6;
 
-    drawDegreeDot(_tft, x + 6, y + 4, tc);
-    _tft.setCursor(x + 10, y + 6);
-    _tft.print("C");
+    drawDegreeDot(g, x + 6, y + 4, tc);
+    g.setCursor(x + 10, y + 6);
+    g.print("C");
 }
 
 void ForecastScreen::drawRowNightAtX(
+    Adafruit_GFX& g,
     const ThemeBlend& b,
     const ForecastDay* d,
-    int xOff
+    int xOff,
+    int y0
 ) {
-    const int y = _layout.contentY() + 38;
-    _tft.fillRect(xOff, y, _tft.width(), 16, b.bg);
+    const int y = y0 + 38;
 
     // Иконка ночи
     WeatherIcon icon = getWeatherIcon(d->weatherCode, true);
-    const uint16_t iconColor = b.fg;
-
-    _tft.drawBitmap(
-        xOff + 4, y + 1,
-        icon.data,
-        icon.width,
-        icon.height,
-        iconColor
-    );
+    drawIconAtX(g, b, icon, xOff + 4, y + 1);
 
-    float k = 1.0f;
-    if (xOff != 0) {
-        k = 1.0f - (fabsf((float)xOff) / (float)_tft.width());
-        k = clamp01(k);
-    }
-    const uint16_t tc = fadeTextColor(b, k);
+    const uint16_t tc = fadeTextColor(b, xOff, g.width());
 
-    _tft.setTextColor(tc, b.bg);
-    _tft.setCursor(xOff + 32, y + 6);
+    g.setTextColor(tc, b.bg);
+    g.setCursor(xOff + 32, y + 6);
 
     if (isnan(d->tempNight)) {
-        _tft.print("Night: --");
+        g.print("Night: --");
         return;
     }
 
     int tInt = (int)lround(d->tempNight);
     char buf[16];
     snprintf(buf, sizeof(buf), "Night: %d", tInt);
-    _tft.print(buf);
+    g.print(buf);
 
     int x = xOff + 32 + (int)strlen(buf) * 6;
 
-    drawDegreeDot(_tft, x + 6, y + 4, tc);
-    _tft.setCursor(x + 10, y + 6);
-    _tft.print("C");
+    drawDegreeDot(g, x + 6, y + 4, tc);
+    g.setCursor(x + 10, y + 6);
+    g.print("C");
 }
 
 void ForecastScreen::drawRowHumAtX(
+    Adafruit_GFX& g,
     const ThemeBlend& b,
     int hum,
-    int xOff
+    int xOff,
+    int y0
 ) {
-    const int y = _layout.contentY() + 56;
-    _tft.fillRect(xOff, y, _tft.width(), 16, b.bg);
+    const int y = y0 + 56;
 
-    float k = 1.0f;
-    if (xOff != 0) {
-        k = 1.0f - (fabsf((float)xOff) / (float)_tft.width());
-        k = clamp01(k);
-    }
-    const uint16_t tc = (k < 0.55f) ? b.muted : b.muted;
+    const uint16_t tc = b.muted;
 
-    _tft.setTextColor(tc, b.bg);
-    _tft.setCursor(xOff + 32, y + 6);
+    g.setTextColor(tc, b.bg);
+    g.setCursor(xOff + 32, y + 6);
 
     char buf[16];
     snprintf(buf, sizeof(buf), "Hum:   %d%%", hum);
-    _tft.print(buf);
+    g.print(buf);
 }
 
 // ============================================================================
@@ -478,8 +603,7 @@ void ForecastScreen::drawRowHumAtX(
 // ============================================================================
 void ForecastScreen::drawLoading(const ThemeBlend& b) {
 
-    const int y = _layout.contentY() + 36;
-    _tft.fillRect(0, y, _tft.width(), 20, b.bg);
+    const int y = _layout.current().contentY + 36;
 
     _tft.setCursor(30, y + 4);
     _tft.setTextColor(b.muted, b.bg);
@@ -488,8 +612,7 @@ void ForecastScreen::drawLoading(const ThemeBlend& b) {
 
 void ForecastScreen::drawError(const ThemeBlend& b) {
 
-    const int y = _layout.contentY() + 36;
-    _tft.fillRect(0, y, _tft.width(), 20, b.bg);
+    const int y = _layout.current().contentY + 36;
 
     _tft.setCursor(18, y + 6);
     _tft.setTextColor(b.warn, b.bg);
@@ -1,13 +1,16 @@
 #pragma once
-#include <Adafruit_ST7735.h>
 
 #include "core/Screen.h"
+#include "core/Timeline.h"
 #include "services/ThemeService.h"
 #include "services/ForecastService.h"
 #include "services/LayoutService.h"
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 
+#include "ui/UiDisplay.h"
 #include "ui/weather/WeatherIcons.h"
+#include "ui/weather/WeatherIconCache.h"
+#include "ui/weather/ForecastCardCache.h"
 
 /*
  * ForecastScreen
@@ -17,29 +20,56 @@
  * ПРИНЦИП:
  *  - Экран НИЧЕГО не знает про Day/Night
  *  - Экран использует ТОЛЬКО ThemeBlend
- *  - Экран реагирует ТОЛЬКО на UiVersionService
+ *  - Экран реагирует ТОЛЬКО на EventBus (свой Subscriber)
  *
  * Все решения о цветах и плавности переходов
  * принимаются ВНЕ экрана (ThemeService + NightTransitionService + ColorTemp).
  *
  * UX:
  *  - перелистывание дней с анимацией (slide + лёгкий fade)
+ *
+ * КАДР:
+ *  - update() решает состояние / шаг анимации и помечает контент грязным
+ *  - draw() только рисует (фон контента + текущее состояние)
+ *
+ * ИКОНКИ:
+ *  - берутся из WeatherIconCache уже в цветах ThemeBlend (RGB565)
+ *  - уходят одним окном адреса (UiDisplay::blit), в slide — каждый кадр
+ *  - кеш сбрасывается при смене таблицы ThemeService (tableVersion)
+ *
+ * КАРТОЧКИ:
+ *  - READY-день рисуется в холст (ForecastCardCache) один раз на
+ *    версию данных / ThemeBlend
+ *  - кадр = blit карточки; slide = два blit со смещением, без очистки,
+ *    fade — смешивание карточки с bg по смещению (blitBlend)
+ *  - холсты живут, пока экран на дисплее: begin() выделяет, end() отдаёт
+ *  - нет памяти под карточки — старый путь (прямое рисование со сдвигом)
  */
 class ForecastScreen : public Screen {
 public:
     ForecastScreen(
-        Adafruit_ST7735&  tft,
+        UiDisplay&        tft,
         ThemeService&     theme,
         ForecastService&  forecast,
         LayoutService&    layout,
-        UiVersionService& ui
+        EventBus&         bus,
+        Timeline&         timeline
     );
 
     void begin() override;
-    void update() override;
+    void end() override;
+    void update(DirtyRegion& dirty) override;
+    void draw() override;
 
     bool hasStatusBar() const override { return true; }
 
+    UiTag uiTag() const override { return UiTag::FORECAST; }
+
+    bool redrawPending() const override {
+        return _dirty || _animActive ||
+               _state != _lastState || _dayIndex != _lastDayIndex;
+    }
+
     void onShortLeft();
     void onShortRight();
 
@@ -52,35 +82,49 @@ private:
 
 private:
     // ---- draw helpers ----
-    void redrawAll();
+    UiRect contentRect() const;
 
     // Рисование готового состояния (одного дня) с X-смещением.
     // xOff может быть отрицательным/положительным для slide-анимации.
-    void drawReadyAtX(const ThemeBlend& b, const ForecastDay* d,
-                      uint8_t idx, uint8_t total, int xOff);
+    // g — дисплей (y0 = contentY) или холст карточки (y0 = 0).
+    void drawReadyAtX(Adafruit_GFX& g, const ThemeBlend& b, const ForecastDay* d,
+                      uint8_t idx, uint8_t total, int xOff, int y0);
 
-    void drawHeaderAtX(const ThemeBlend& b,
+    void drawHeaderAtX(Adafruit_GFX& g,
+                       const ThemeBlend& b,
                        const ForecastDay* d,
                        uint8_t idx,
                        uint8_t total,
-                       int xOff);
+                       int xOff,
+                       int y0);
 
     void drawLoading(const ThemeBlend& b);
     void drawError(const ThemeBlend& b);
 
-    void drawRowDayAtX(const ThemeBlend& b, const ForecastDay* d, int xOff);
-    void drawRowNightAtX(const ThemeBlend& b, const ForecastDay* d, int xOff);
-    void drawRowHumAtX(const ThemeBlend& b, int hum, int xOff);
+    void drawRowDayAtX(Adafruit_GFX& g, const ThemeBlend& b, const ForecastDay* d, int xOff, int y0);
+    void drawRowNightAtX(Adafruit_GFX& g, const ThemeBlend& b, const ForecastDay* d, int xOff, int y0);
+    void drawRowHumAtX(Adafruit_GFX& g, const ThemeBlend& b, int hum, int xOff, int y0);
+
+    void drawIconAtX(Adafruit_GFX& g, const ThemeBlend& b, const WeatherIcon& icon, int x, int y);
+
+    // ---- cards ----
+    GFXcanvas16* cardFor(const ThemeBlend& b, uint8_t day, int keep);
+    bool drawReadyCards(const ThemeBlend& b);
 
     // ---- animation ----
     void startDayTransition(int dir);        // dir: -1 (left), +1 (right)
+    static void onAnimDone(void* ctx);       // колбэк Timeline
     void drawTransitionFrame(const ThemeBlend& b);
+    int  slideOffset() const;                // X старого дня в кадре
 
 private:
-    Adafruit_ST7735&  _tft;
+    UiDisplay&        _tft;
     ForecastService&  _forecast;
     LayoutService&    _layout;
-    UiVersionService& _ui;
+    Timeline&         _timeline;
+
+    // THEME / SCREEN / FORECAST — свой курсор, у других не крадём
+    EventBus::Subscriber _events;
 
     UiState _state     = UiState::LOADING;
     UiState _lastState = UiState::ERROR;
@@ -90,12 +134,17 @@ private:
 
     bool _dirty = true;
 
+    WeatherIconCache  _icons;
+    ForecastCardCache _cards;
+
     // ---- animation state ----
-    bool     _animActive   = false;
-    uint32_t _animStartMs  = 0;
-    uint8_t  _animFrom     = 0;
-    uint8_t  _animTo       = 0;
-    int      _animDir      = 0; // -1 or +1
+    // Время ведёт Timeline; конец — onAnimDone (в tick кадра)
+    bool         _animActive = false;
+    Timeline::Id _animTrack  = Timeline::NONE;
+    uint8_t      _animFrom   = 0;
+    uint8_t      _animTo     = 0;
+    int          _animDir    = 0;    // -1 or +1
+    q16_t        _animT      = 0;    // прогресс кадра после easing, Q16 (в update)
 
     // Длительность анимации (мс). 180..240 обычно выглядит отлично.
     static constexpr uint16_t ANIM_MS = 200;
@@ -11,14 +11,14 @@ constexpr SettingsScreen::MenuItem SettingsScreen::MENU[];
 // ctor
 // ============================================================================
 SettingsScreen::SettingsScreen(
-    Adafruit_ST7735& tft,
+    UiDisplay& tft,
     ThemeService& themeService,
     LayoutService& layoutService,
     NightService& nightService,
     TimeService& timeService,
     WifiService& wifiService,
     BrightnessService& brightnessService,
-    UiVersionService& uiVersion,
+    EventBus& bus,
     ButtonBar& buttonBar
 )
     : Screen(themeService)
@@ -28,8 +28,11 @@ SettingsScreen::SettingsScreen(
     , _time(timeService)
     , _wifi(wifiService)
     , _brightness(brightnessService)
-    , _ui(uiVersion)
+    , _bus(bus)
     , _buttons(buttonBar)
+    , _wifiEvents(
+          bus,
+          channelBit(UiChannel::WIFI_STATE) | channelBit(UiChannel::WIFI_LIST))
 {
 }
 
@@ -50,7 +53,6 @@ void SettingsScreen::begin() {
     _tmpBrightness = _brightness.get();
     _bakBrightness = _tmpBrightness;
 
-    _wifiListTop      = 0;
     _wifiListSelected = 0;
 
     memset(_wifiPass, 0, sizeof(_wifiPass));
@@ -71,8 +73,7 @@ void SettingsScreen::begin() {
     _bakTimeMode = _time.mode();
     _tmpTimeMode = _bakTimeMode;
 
-    _lastWifiListVersion  = _wifi.listVersion();
-    _lastWifiStateVersion = _wifi.stateVersion();
+    _wifiEvents.sync();
 
     updateButtonBarContext();
     _buttons.markDirty();
@@ -81,29 +82,66 @@ void SettingsScreen::begin() {
     _dirty          = true;
     _lastDrawnLevel = _level;
 
-    _ui.bump(UiChannel::SCREEN);
+    _bus.publish(UiChannel::SCREEN);
 }
 
 // ============================================================================
 // update
 // ============================================================================
-void SettingsScreen::update() {
+void SettingsScreen::update(DirtyRegion& dirty) {
 
-    if (_wifi.listVersion() != _lastWifiListVersion ||
-        _wifi.stateVersion() != _lastWifiStateVersion) {
+    if (_wifiEvents.poll()) {
 
-        _lastWifiListVersion  = _wifi.listVersion();
-        _lastWifiStateVersion = _wifi.stateVersion();
-        _dirty = true;
+        // Сети / состояние скана — список целиком
+        if (_level == Level::WIFI_LIST) {
+            _list.markAllDirty();
+            _dirty = true;
+        }
     }
 
     if (_hintFlash > 0)
         _hintFlash--;
 
-    if (_dirty) {
-        _dirty = false;
-        redrawAll();
+    if (!_dirty)
+        return;
+
+    _dirty = false;
+
+    // ------------------------------------------------------------------------
+    // Смена уровня / темы — вся рабочая область
+    // ------------------------------------------------------------------------
+    if (_needFullClear || _lastDrawnLevel != _level) {
+        _needFullClear  = false;
+        _lastDrawnLevel = _level;
+        _lastDrawnMode  = _mode;
+
+        configureList();
+        syncList();
+        _list.invalidate(dirty);
+
+        dirty.add(workRect());
+        return;
+    }
+
+    // Пароль — не список, перерисовываем целиком
+    if (_level == Level::WIFI_PASSWORD) {
+        dirty.add(workRect());
+        return;
     }
+
+    // ------------------------------------------------------------------------
+    // Списки — только изменившиеся строки (ANTI-FLICKER)
+    // ------------------------------------------------------------------------
+    syncList();
+
+    // Вход / выход из EDIT и само редактирование меняют цвета и значения
+    // соседних строк (Night: Mode гасит Start / End) — строк мало, берём все.
+    if (_mode == UiMode::EDIT || _mode != _lastDrawnMode) {
+        _list.markAllDirty();
+    }
+    _lastDrawnMode = _mode;
+
+    _list.invalidate(dirty);
 }
 
 // ============================================================================
@@ -181,13 +219,13 @@ void SettingsScreen::onLongOk() {
             prefs.setNightAutoRange(_tmpNightStart, _tmpNightEnd);
             prefs.save();
 
-            _ui.bump(UiChannel::THEME);
+            _bus.publish(UiChannel::THEME);
         }
 
         // ===== APPLY TIME =====
         if (_level == Level::TIME) {
             _time.setMode(_tmpTimeMode);
-            _ui.bump(UiChannel::TIME);
+            _bus.publish(UiChannel::TIME);
         }
 
         exitEdit(true);
@@ -278,13 +316,17 @@ void SettingsScreen::enterSubmenu(Level lvl) {
         _tmpTimeMode = _bakTimeMode;
     }
 
+    if (_level == Level::TIMEZONE) {
+        _bakTzSec  = prefs.tzGmtOffset();
+        _tmpTzSec  = _bakTzSec;
+
+        _bakDstSec = prefs.tzDstOffset();
+        _tmpDstSec = _bakDstSec;
+    }
+
     _needFullClear = true;
     _dirty         = true;
 
-    _lastWifiListTop      = -1;
-    _lastWifiListSelected = -1;
-    _lastWifiNetCount     = -1;
-
     updateButtonBarContext();
     _buttons.markDirty();
 }
\ No newline at end of file
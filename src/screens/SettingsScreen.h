@@ -5,35 +5,42 @@
 #include "core/Screen.h"
 #include "services/LayoutService.h"
 #include "services/NightService.h"
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 #include "services/TimeService.h"
 #include "services/PreferencesService.h"
 #include "services/BrightnessService.h"
 #include "services/WifiService.h"
 #include "ui/ButtonBar.h"
+#include "ui/ListView.h"
+#include "ui/UiDisplay.h"
 
 #include "screens/settings/SettingsTypes.h"
 
 class SettingsScreen : public Screen {
 public:
     SettingsScreen(
-        Adafruit_ST7735& tft,
+        UiDisplay& tft,
         ThemeService& themeService,
         LayoutService& layoutService,
         NightService& nightService,
         TimeService& timeService,
         WifiService& wifiService,
         BrightnessService& brightnessService,
-        UiVersionService& uiVersion,
+        EventBus& bus,
         ButtonBar& buttonBar
     );
 
     void begin() override;
-    void update() override;
+    void update(DirtyRegion& dirty) override;
+    void draw() override;
 
     bool hasStatusBar() const override { return true; }
     bool hasButtonBar() const override { return true; }
 
+    UiTag uiTag() const override { return UiTag::SETTINGS; }
+
+    bool redrawPending() const override { return _dirty; }
+
     void onThemeChanged() override;
 
     void onShortLeft();
@@ -57,7 +64,13 @@ public:
     bool handleWifiShortOk();
 
 protected:
-    void redrawAll();
+    // Рабочая область (между StatusBar и ButtonBar)
+    UiRect workRect() const;
+
+    // ListView текущего уровня: геометрия (смена уровня) и модель
+    void configureList();
+    void syncList();
+
     void drawBrightness();
     void drawRoot();
     void drawWifi();
@@ -95,13 +108,13 @@ private:
     void applyNightSettings();
 
 private:
-    Adafruit_ST7735&  _tft;
+    UiDisplay&        _tft;
     LayoutService&    _layout;
 
     NightService&     _night;
     TimeService&      _time;
     WifiService&      _wifi;
-    UiVersionService& _ui;
+    EventBus&         _bus;
     ButtonBar&        _buttons;
 
     bool   _dirty = true;
@@ -114,8 +127,7 @@ private:
     int _subSelected = 0;
 
     // ===== Wi-Fi list =====
-    int _wifiListTop      = 0;
-    int _wifiListSelected = 0;
+    int _wifiListSelected = 0;      // netCount == "Rescan"
 
     static constexpr int WIFI_PASS_MAX = 32;
     char _wifiPass[WIFI_PASS_MAX + 1]{};
@@ -172,18 +184,17 @@ private:
     // ===== Brightness =====
 int _tmpBrightness = 100;
 int _bakBrightness = 100;
-    // ===== Versions =====
-    uint32_t _lastWifiListVersion  = 0;
-    uint32_t _lastWifiStateVersion = 0;
+    // ===== Events =====
+    // Сети / состояние Wi-Fi (свой курсор, ничего не крадём у StatusBar)
+    EventBus::Subscriber _wifiEvents;
 
-    // ===== UI cache =====
-    int _lastWifiListTop      = -1;
-    int _lastWifiListSelected = -1;
-    int _lastWifiNetCount     = -1;
+    // ===== List (строки текущего уровня) =====
+    ListView _list;
 
     HintBtn _pressedBtn = HintBtn::NONE;
     uint8_t _hintFlash  = 0;
 
-    bool  _needFullClear  = true;
-    Level _lastDrawnLevel = Level::ROOT;
+    bool   _needFullClear  = true;
+    Level  _lastDrawnLevel = Level::ROOT;
+    UiMode _lastDrawnMode  = UiMode::NAV;
 };
\ No newline at end of file
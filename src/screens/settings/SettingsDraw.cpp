@@ -29,15 +29,33 @@
  *       setTextWrap(false)
  *       setTextSize(1)
  *   - reset делается:
- *       * в redrawAll()
- *       * в начале drawWifiList()
- *       * внутри drawRow() ПЕРЕД ЛЮБЫМ print()
+ *       * в draw()
+ *       * в начале каждого drawXxx() (заголовок size 2 → строки size 1)
+ *
+ * КАДР:
+ *   - фон рабочей области заливает ТОЛЬКО draw(), строки фон не льют
+ *   - строки уровней — ListView: что грязное, решает update()
+ *     (_list.invalidate), рисуются только видимые строки в clip
  */
 
 // ============================================================================
-// layout constants (НЕ тянем StatusBar.h)
+// layout constants — смещения от верха content (LayoutService::current())
 // ============================================================================
-static constexpr int STATUSBAR_H = 24;
+
+// Списки уровней (ListView)
+static constexpr int LIST_TOP        = 28;
+static constexpr int MENU_ROW_H      = 12;
+static constexpr int WIFI_MENU_ROW_H = 18;
+
+static constexpr int WIFI_ROW_H      = 12;
+static constexpr int WIFI_LIST_TOP   = LIST_TOP;
+
+// Поля редактирования (Time / Night / Timezone / Brightness)
+static constexpr int FIELD_ROW_H     = 14;
+static constexpr int TIME_LIST_TOP   = 32;
+static constexpr int FIELD_LIST_TOP  = 30;
+static constexpr int BRIGHT_TOP      = 40;
+static constexpr int BRIGHT_ROW_H    = 16;
 
 // ============================================================================
 // helpers
@@ -93,12 +111,94 @@ static void drawRssiBars(
 }
 
 // ============================================================================
-// REDRAW ALL
+// WORK AREA
+// ============================================================================
+UiRect SettingsScreen::workRect() const {
+    const UiLayout& L = _layout.current();
+    return UiRect{
+        0,
+        (int16_t)L.contentY,
+        (int16_t)L.width,
+        (int16_t)L.contentH
+    };
+}
+
+// ============================================================================
+// LIST — геометрия и модель текущего уровня
 // ============================================================================
-void SettingsScreen::redrawAll() {
+void SettingsScreen::configureList() {
+
+    const UiLayout& L = _layout.current();
+
+    int top  = LIST_TOP;
+    int rowH = MENU_ROW_H;
+
+    switch (_level) {
+        case Level::ROOT:                                                   break;
+        case Level::WIFI:       rowH = WIFI_MENU_ROW_H;                     break;
+        case Level::WIFI_LIST:  top = WIFI_LIST_TOP;  rowH = WIFI_ROW_H;    break;
+        case Level::TIME:       top = TIME_LIST_TOP;  rowH = FIELD_ROW_H;   break;
+        case Level::NIGHT:
+        case Level::TIMEZONE:   top = FIELD_LIST_TOP; rowH = FIELD_ROW_H;   break;
+        case Level::BRIGHTNESS: top = BRIGHT_TOP;     rowH = BRIGHT_ROW_H;  break;
+
+        case Level::WIFI_PASSWORD:
+            _list.configure(UiRect{ 0, 0, 0, 0 }, 1);
+            return;
+    }
+
+    top += L.contentY;
+
+    _list.configure(
+        UiRect{
+            0,
+            (int16_t)top,
+            (int16_t)L.width,
+            (int16_t)(L.bottomY - top)
+        },
+        (int16_t)rowH
+    );
+}
+
+void SettingsScreen::syncList() {
+
+    int count = 0;
+    int sel   = 0;
+
+    switch (_level) {
+        case Level::ROOT:
+            count = sizeof(MENU) / sizeof(MENU[0]);
+            sel   = _selected;
+            break;
+
+        case Level::WIFI:      count = 2; sel = _subSelected; break;
+        case Level::TIME:      count = 2; sel = _subSelected; break;
+        case Level::NIGHT:     count = 3; sel = _subSelected; break;
+        case Level::TIMEZONE:  count = 2; sel = _subSelected; break;
+        case Level::BRIGHTNESS: count = 1; break;
+
+        case Level::WIFI_LIST:
+            // Пока идёт скан — вместо строк сообщение
+            if (_wifi.scanState() != WifiService::ScanState::SCANNING) {
+                count = _wifi.networksCount() + 1;   // + Rescan
+            }
+            sel = _wifiListSelected;
+            break;
+
+        case Level::WIFI_PASSWORD:
+            break;
+    }
+
+    _list.setCount(count);
+    _list.setSelected(sel);
+}
+
+// ============================================================================
+// DRAW
+// ============================================================================
+void SettingsScreen::draw() {
 
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
 
     // ------------------------------------------------------------------------
     // 🔒 ГЛОБАЛЬНЫЙ RESET GFX СОСТОЯНИЯ (обязателен)
@@ -108,18 +208,10 @@ void SettingsScreen::redrawAll() {
     _tft.setTextSize(1);
 
     // ------------------------------------------------------------------------
-    // Полный клир рабочей области
+    // Фон рабочей области (clip оставит только грязную часть)
     // ------------------------------------------------------------------------
-    if (_needFullClear || _lastDrawnLevel != _level) {
-        _tft.fillRect(0, y0, _tft.width(), _tft.height() - y0, th.bg);
-        _needFullClear  = false;
-        _lastDrawnLevel = _level;
-
-        // сброс кешей Wi-Fi списка
-        _lastWifiListTop      = -1;
-        _lastWifiListSelected = -1;
-        _lastWifiNetCount     = -1;
-    }
+    const UiRect r = workRect();
+    _tft.fillRect(r.x, r.y, r.w, r.h, th.bg);
 
     switch (_level) {
         case Level::ROOT:          drawRoot();         break;
@@ -138,7 +230,7 @@ void SettingsScreen::redrawAll() {
 // ============================================================================
 void SettingsScreen::drawRoot() {
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     // --- TITLE ---
     _tft.setFont(nullptr);
@@ -151,21 +243,12 @@ void SettingsScreen::drawRoot() {
     // --- LIST ---
     _tft.setTextSize(1);
 
-    int top    = y0 + 28;
-    int count  = sizeof(MENU) / sizeof(MENU[0]);
-    constexpr int rowH = 12;
-
-    for (int i = 0; i < count; i++) {
-        int y = top + i * rowH;
-        bool sel = (i == _selected);
-
-        _tft.fillRect(0, y, _tft.width(), rowH, th.bg);
+    _list.draw(_tft, [&](int i, const UiRect& row, bool sel) {
         _tft.setTextColor(sel ? th.select : th.textPrimary, th.bg);
-        const int textY = y + (rowH - 8) / 2;
-        _tft.setCursor(12, textY);
+        _tft.setCursor(12, row.y + (row.h - 8) / 2);
         _tft.print(sel ? "> " : "  ");
         _tft.print(MENU[i].label);
-    }
+    });
 }
 
 // ============================================================================
@@ -173,7 +256,7 @@ void SettingsScreen::drawRoot() {
 // ============================================================================
 void SettingsScreen::drawWifi() {
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     // --- TITLE ---
     _tft.setFont(nullptr);
@@ -186,17 +269,9 @@ void SettingsScreen::drawWifi() {
     // --- LIST ---
     _tft.setTextSize(1);
 
-    int top  = y0 + 28;
-    int rowH = 18;
-
-    for (int i = 0; i < 2; i++) {
-        int y = top + i * rowH;
-        bool sel = (_subSelected == i);
-
-        _tft.fillRect(0, y, _tft.width(), rowH, th.bg);
+    _list.draw(_tft, [&](int i, const UiRect& row, bool sel) {
         _tft.setTextColor(sel ? th.select : th.textPrimary, th.bg);
-        const int textY = y + (rowH - 8) / 2;
-        _tft.setCursor(12, textY);
+        _tft.setCursor(12, row.y + (row.h - 8) / 2);
         _tft.print(sel ? "> " : "  ");
 
         if (i == 0) {
@@ -205,7 +280,7 @@ void SettingsScreen::drawWifi() {
         } else {
             _tft.print("Scan");
         }
-    }
+    });
 }
 
 // ============================================================================
@@ -215,30 +290,18 @@ void SettingsScreen::drawWifiList() {
 
     const Theme& th = theme();
 
-    constexpr int ROW_H = 12;
-    constexpr int VISIBLE_ROWS = 4;
     constexpr int ICON_W = 12;
 
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
     const int TITLE_Y  = y0 + 6;
-    const int LIST_TOP = y0 + 28;
 
     // ------------------------------------------------------------------------
     // 🔒 RESET ПЕРЕД СПИСКОМ (обязательно)
     // ------------------------------------------------------------------------
     _tft.setFont(nullptr);
     _tft.setTextWrap(false);
-    _tft.setTextSize(1);
-
-    int netCount = _wifi.networksCount();
-
-    bool full =
-        _lastWifiListTop  != _wifiListTop ||
-        _lastWifiNetCount != netCount ||
-        _lastWifiListTop  < 0;
 
     // --- HEADER ---
-    _tft.fillRect(0, y0, _tft.width(), LIST_TOP - y0, th.bg);
     _tft.setTextSize(2);
     _tft.setCursor(18, TITLE_Y);
     _tft.setTextColor(th.textPrimary, th.bg);
@@ -247,66 +310,40 @@ void SettingsScreen::drawWifiList() {
     // ⚠️ ОБЯЗАТЕЛЬНЫЙ возврат!
     _tft.setTextSize(1);
 
-    if (full) {
-        int listH = _layout.buttonBarY() - LIST_TOP;
-        _tft.fillRect(0, LIST_TOP, _tft.width(), listH, th.bg);
-    }
-
     if (_wifi.scanState() == WifiService::ScanState::SCANNING) {
-        if (full) {
-            _tft.setCursor(20, LIST_TOP + 14);
-            _tft.setTextColor(th.muted, th.bg);
-            _tft.print("Scanning...");
-        }
+        _tft.setCursor(20, y0 + WIFI_LIST_TOP + 14);
+        _tft.setTextColor(th.muted, th.bg);
+        _tft.print("Scanning...");
         return;
     }
 
-    // --- ROW DRAW ---
-    auto drawRow = [&](int idx) {
+    const int netCount = _wifi.networksCount();
 
-        // 🔒 САМЫЙ ВАЖНЫЙ FIX — reset ПЕРЕД КАЖДОЙ строкой
-        _tft.setFont(nullptr);
-        _tft.setTextWrap(false);
-        _tft.setTextSize(1);
+    // --- ROWS (сеть берётся прямо из WifiService, без копий) ---
+    _list.draw(_tft, [&](int idx, const UiRect& row, bool sel) {
 
-        if (idx < _wifiListTop || idx >= _wifiListTop + VISIBLE_ROWS) return;
-        if (idx >= netCount) return;
-
-        int i = idx - _wifiListTop;
-        int rowY = LIST_TOP + i * ROW_H;
+        _tft.setTextColor(sel ? th.select : th.textPrimary, th.bg);
+        _tft.setCursor(8, row.y + (row.h - 8) / 2);
+        _tft.print(sel ? "> " : "  ");
 
-        _tft.fillRect(0, rowY, _tft.width(), ROW_H, th.bg);
+        // последняя строка — Rescan
+        if (idx >= netCount) {
+            _tft.print("Rescan");
+            return;
+        }
 
         const WifiService::Network& net = _wifi.networkAt(idx);
-        bool sel = (idx == _wifiListSelected);
-
-        _tft.setTextColor(sel ? th.select : th.textPrimary, th.bg);
-        const int textY = rowY + (ROW_H - 8) / 2;
-        _tft.setCursor(8, textY);
-        _tft.print(sel ? "> " : "  ");
         _tft.print(net.ssid);
 
         int iconX = _tft.width() - ICON_W - 2;
-        int yMid  = rowY + ROW_H / 2;
+        int yMid  = row.y + row.h / 2;
         drawRssiBars(_tft, th, iconX, yMid, net.rssi);
 
         if (net.connected) {
             _tft.setTextColor(th.textSecondary, th.bg);
             _tft.print(" [connected]");
         }
-    };
-
-    if (full) {
-        for (int i = 0; i < VISIBLE_ROWS; i++)
-            drawRow(_wifiListTop + i);
-    } else if (_lastWifiListSelected != _wifiListSelected) {
-        drawRow(_lastWifiListSelected);
-        drawRow(_wifiListSelected);
-    }
-
-    _lastWifiListTop      = _wifiListTop;
-    _lastWifiListSelected = _wifiListSelected;
-    _lastWifiNetCount     = netCount;
+    });
 }
 
 // ============================================================================
@@ -314,10 +351,7 @@ void SettingsScreen::drawWifiList() {
 // ============================================================================
 void SettingsScreen::drawWifiPassword() {
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
-    const int h  = _layout.buttonBarY();
-
-    _tft.fillRect(0, y0, _tft.width(), h - y0, th.bg);
+    const int y0 = _layout.current().contentY;
 
     _tft.setFont(nullptr);
     _tft.setTextWrap(false);
@@ -347,7 +381,7 @@ void SettingsScreen::drawWifiPassword() {
 void SettingsScreen::drawTime() {
 
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     // ------------------------------------------------------------------------
     // TITLE
@@ -364,65 +398,53 @@ void SettingsScreen::drawTime() {
     // ------------------------------------------------------------------------
     _tft.setTextSize(1);
 
-    constexpr int ROW_H = 14;
-    const int top = y0 + 32;
-
-    // ============================================================
-    // Row 0 — Mode (editable)
-    // ============================================================
-    {
-        const bool selected = (_subSelected == 0);
-        const bool editing  = selected && (_mode == UiMode::EDIT);
-
-        const uint16_t color =
-            editing  ? th.warn :
-            selected ? th.select :
-                       th.textPrimary;
+    _list.draw(_tft, [&](int i, const UiRect& row, bool sel) {
 
-        _tft.fillRect(0, top, _tft.width(), ROW_H, th.bg);
-        _tft.setTextColor(color, th.bg);
-        _tft.setCursor(10, top + 3);
-        _tft.print("> Mode: ");
-
-        switch (_tmpTimeMode) {
-            case TimeService::AUTO:       _tft.print("AUTO");  break;
-            case TimeService::RTC_ONLY:   _tft.print("RTC");   break;
-            case TimeService::NTP_ONLY:   _tft.print("NTP");   break;
-            case TimeService::LOCAL_ONLY: _tft.print("LOCAL"); break;
+        // ============================================================
+        // Row 0 — Mode (editable)
+        // ============================================================
+        if (i == 0) {
+            const bool editing = sel && (_mode == UiMode::EDIT);
+
+            const uint16_t color =
+                editing ? th.warn :
+                sel     ? th.select :
+                          th.textPrimary;
+
+            _tft.setTextColor(color, th.bg);
+            _tft.setCursor(10, row.y + 3);
+            _tft.print("> Mode: ");
+
+            switch (_tmpTimeMode) {
+                case TimeService::AUTO:       _tft.print("AUTO");  break;
+                case TimeService::RTC_ONLY:   _tft.print("RTC");   break;
+                case TimeService::NTP_ONLY:   _tft.print("NTP");   break;
+                case TimeService::LOCAL_ONLY: _tft.print("LOCAL"); break;
+            }
+            return;
         }
-    }
 
-    // ============================================================
-    // Row 1 — Current source (read-only)
-    // ============================================================
-  // ============================================================
-// Row 1 — Current source + state (read-only)
-// ============================================================
-{
-    const int y = top + ROW_H;
+        // ============================================================
+        // Row 1 — Current source + state (read-only)
+        // ============================================================
+        _tft.setTextColor(th.muted, th.bg);
+        _tft.setCursor(10, row.y + 3);
 
-    _tft.fillRect(0, y, _tft.width(), ROW_H, th.bg);
-    _tft.setTextColor(th.muted, th.bg);
-    _tft.setCursor(10, y + 3);
+        _tft.print("  Now: ");
+        _tft.print(_time.sourceLabel());
 
-    _tft.print("  Now: ");
-    _tft.print(_time.sourceLabel());
-
-    _tft.setCursor(70, y + 3);
-    _tft.print(_time.stateLabel());
-}
+        _tft.setCursor(70, row.y + 3);
+        _tft.print(_time.stateLabel());
+    });
 }
 
-// ============================================================================
-// NIGHT MODE — FULL UI + EDIT HIGHLIGHT
-// ============================================================================
 // ============================================================================
 // NIGHT MODE
 // ============================================================================
 void SettingsScreen::drawNight() {
 
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     // ------------------------------------------------------------------------
     // TITLE
@@ -439,79 +461,45 @@ void SettingsScreen::drawNight() {
     // ------------------------------------------------------------------------
     _tft.setTextSize(1);
 
-    constexpr int ROW_H = 14;
-    int top = y0 + 30;
-
-    // ---------- Row 0: Mode ----------
-    {
-        bool selected = (_subSelected == 0);
-        bool editing  = selected && (_mode == UiMode::EDIT);
+    _list.draw(_tft, [&](int i, const UiRect& row, bool sel) {
 
-        uint16_t color = editing
-            ? th.warn        // 🔴 EDIT = RED
-            : (selected ? th.select : th.textPrimary);
+        const bool editing = sel && (_mode == UiMode::EDIT);
 
-        _tft.fillRect(0, top, _tft.width(), ROW_H, th.bg);
-        _tft.setTextColor(color, th.bg);
-        _tft.setCursor(10, top + 3);
-        _tft.print("> Mode: ");
-
-        switch (_tmpMode) {
-            case NightService::Mode::AUTO: _tft.print("AUTO"); break;
-            case NightService::Mode::ON:   _tft.print("ON");   break;
-            case NightService::Mode::OFF:  _tft.print("OFF");  break;
+        // ---------- Row 0: Mode ----------
+        if (i == 0) {
+            uint16_t color = editing
+                ? th.warn        // 🔴 EDIT = RED
+                : (sel ? th.select : th.textPrimary);
+
+            _tft.setTextColor(color, th.bg);
+            _tft.setCursor(10, row.y + 3);
+            _tft.print("> Mode: ");
+
+            switch (_tmpMode) {
+                case NightService::Mode::AUTO: _tft.print("AUTO"); break;
+                case NightService::Mode::ON:   _tft.print("ON");   break;
+                case NightService::Mode::OFF:  _tft.print("OFF");  break;
+            }
+            return;
         }
-    }
-
-    // ---------- Row 1: Start ----------
-    {
-        int y = top + ROW_H;
-        bool enabled  = (_tmpMode == NightService::Mode::AUTO);
-        bool selected = (_subSelected == 1);
-        bool editing  = selected && (_mode == UiMode::EDIT);
-
-        uint16_t color =
-            !enabled ? th.muted :
-            editing  ? th.warn :
-            selected ? th.select :
-                       th.textPrimary;
-
-        _tft.fillRect(0, y, _tft.width(), ROW_H, th.bg);
-        _tft.setTextColor(color, th.bg);
-        _tft.setCursor(10, y + 3);
-        _tft.print("  Start: ");
 
-        char buf[6];
-        snprintf(buf, sizeof(buf), "%02d:%02d",
-                 _tmpNightStart / 60,
-                 _tmpNightStart % 60);
-        _tft.print(buf);
-    }
-
-    // ---------- Row 2: End ----------
-    {
-        int y = top + ROW_H * 2;
-        bool enabled  = (_tmpMode == NightService::Mode::AUTO);
-        bool selected = (_subSelected == 2);
-        bool editing  = selected && (_mode == UiMode::EDIT);
+        // ---------- Row 1 / 2: Start / End ----------
+        const bool enabled = (_tmpMode == NightService::Mode::AUTO);
 
         uint16_t color =
             !enabled ? th.muted :
             editing  ? th.warn :
-            selected ? th.select :
+            sel      ? th.select :
                        th.textPrimary;
 
-        _tft.fillRect(0, y, _tft.width(), ROW_H, th.bg);
         _tft.setTextColor(color, th.bg);
-        _tft.setCursor(10, y + 3);
-        _tft.print("  End:   ");
+        _tft.setCursor(10, row.y + 3);
+        _tft.print(i == 1 ? "  Start: " : "  End:   ");
 
         char buf[6];
-        snprintf(buf, sizeof(buf), "%02d:%02d",
-                 _tmpNightEnd / 60,
-                 _tmpNightEnd % 60);
+        formatHMFromMin(i == 1 ? _tmpNightStart : _tmpNightEnd, buf, sizeof(buf));
         _tft.print(buf);
-    }
+    });
 
     // ------------------------------------------------------------------------
     // ❌ НИКАКИХ ПОДПИСЕЙ КНОПОК ТУТ БОЛЬШЕ НЕТ
@@ -522,7 +510,7 @@ void SettingsScreen::drawNight() {
 // ============================================================================
 void SettingsScreen::drawTimezone() {
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     _tft.setFont(nullptr);
     _tft.setTextWrap(false);
@@ -531,13 +519,33 @@ void SettingsScreen::drawTimezone() {
     _tft.setTextColor(th.textPrimary, th.bg);
     _tft.print("Timezone");
 
-    // (позже сделаем как Night: поля + highlight)
+    _tft.setTextSize(1);
+
+    // Поля как в Night: GMT / DST + подсветка редактирования
+    _list.draw(_tft, [&](int i, const UiRect& row, bool sel) {
+
+        const bool editing = sel && (_mode == UiMode::EDIT);
+
+        const uint16_t color =
+            editing ? th.warn :
+            sel     ? th.select :
+                      th.textPrimary;
+
+        _tft.setTextColor(color, th.bg);
+        _tft.setCursor(10, row.y + 3);
+        _tft.print(sel ? "> " : "  ");
+        _tft.print(i == 0 ? "GMT: " : "DST: ");
+
+        char buf[8];
+        formatOffsetHM(i == 0 ? _tmpTzSec : _tmpDstSec, buf, sizeof(buf));
+        _tft.print(buf);
+    });
 }
 
 void SettingsScreen::drawBrightness() {
 
     const Theme& th = theme();
-    const int y0 = STATUSBAR_H;
+    const int y0 = _layout.current().contentY;
 
     _tft.setFont(nullptr);
     _tft.setTextWrap(false);
@@ -549,15 +557,15 @@ void SettingsScreen::drawBrightness() {
 
     _tft.setTextSize(1);
 
-    int y = y0 + 40;
-    bool editing = (_mode == UiMode::EDIT);
+    _list.draw(_tft, [&](int, const UiRect& row, bool) {
+        bool editing = (_mode == UiMode::EDIT);
 
-    uint16_t color = editing ? th.warn : th.select;
+        uint16_t color = editing ? th.warn : th.select;
 
-    _tft.fillRect(0, y, _tft.width(), 18, th.bg);
-    _tft.setTextColor(color, th.bg);
-    _tft.setCursor(20, y + 4);
-    _tft.print("> Level: ");
-    _tft.print(_tmpBrightness);
-    _tft.print("%");
-}
\ No newline at end of file
+        _tft.setTextColor(color, th.bg);
+        _tft.setCursor(20, row.y + 4);
+        _tft.print("> Level: ");
+        _tft.print(_tmpBrightness);
+        _tft.print("%");
+    });
+}
@@ -84,7 +84,7 @@ void SettingsScreen::exitEdit(bool apply) {
     // 🔥 ВАЖНО: Brightness = глобальное визуальное изменение
     if (_level == Level::BRIGHTNESS) {
         // ❗ сообщаем системе: нужен полный redraw экрана
-        _ui.bump(UiChannel::SCREEN);
+        _bus.publish(UiChannel::SCREEN);
     }
 }
 
@@ -168,7 +168,7 @@ void SettingsScreen::editDec() {
             _tmpBrightness--;
             _brightness.set(_tmpBrightness);
             //_brightness.apply();   // live preview
-            _ui.bump(UiChannel::SCREEN);
+            _bus.publish(UiChannel::SCREEN);
 _needFullClear = true;
 _dirty = true;
         }
@@ -56,18 +56,12 @@ void SettingsScreen::navLeft() {
             // только Rescan
             if (count == 0) {
                 _wifiListSelected = 0;
-                _wifiListTop = 0;
                 break;
             }
 
+            // Скролл держит ListView (syncList)
             int maxIdx = count; // + Rescan
             _wifiListSelected = clampI(_wifiListSelected - 1, 0, maxIdx);
-
-            constexpr int VISIBLE_ROWS = 4;
-
-            if (_wifiListSelected < _wifiListTop)
-                _wifiListTop = _wifiListSelected;
-
             break;
         }
 
@@ -135,18 +129,11 @@ void SettingsScreen::navRight() {
 
             if (count == 0) {
                 _wifiListSelected = 0;
-                _wifiListTop = 0;
                 break;
             }
 
             int maxIdx = count; // + Rescan
             _wifiListSelected = clampI(_wifiListSelected + 1, 0, maxIdx);
-
-            constexpr int VISIBLE_ROWS = 4;
-
-            if (_wifiListSelected >= _wifiListTop + VISIBLE_ROWS)
-                _wifiListTop = _wifiListSelected - (VISIBLE_ROWS - 1);
-
             break;
         }
 
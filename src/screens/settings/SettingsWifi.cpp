@@ -16,7 +16,6 @@ bool SettingsScreen::handleWifiShortOk() {
         if (_subSelected == 1) {
             _wifi.startScan();
             _wifiListSelected = 0;
-            _wifiListTop      = 0;
             enterSubmenu(Level::WIFI_LIST);
         }
 
@@ -1,4 +1,5 @@
 #include "services/BrightnessService.h"
+#include "ui/ColorUtil.h"
 
 // ------------------------------------------------------------
 // helpers
@@ -9,19 +10,10 @@ static float clamp01(float v) {
     return v;
 }
 
-// RGB565 → scale → RGB565
+// RGB565 → scale → RGB565 (целочисленно, SWAR)
 uint16_t BrightnessService::scale(uint16_t c, float k) {
     k = clamp01(k);
-
-    uint8_t r = (c >> 11) & 0x1F;
-    uint8_t g = (c >> 5)  & 0x3F;
-    uint8_t b =  c        & 0x1F;
-
-    r = uint8_t(r * k);
-    g = uint8_t(g * k);
-    b = uint8_t(b * k);
-
-    return (r << 11) | (g << 5) | b;
+    return scale565(c, (uint8_t)(k * 255.0f + 0.5f));
 }
 
 // ------------------------------------------------------------
@@ -30,10 +22,14 @@ uint16_t BrightnessService::scale(uint16_t c, float k) {
 void BrightnessService::begin() {
     // позже: загрузка из PreferencesService
     _value = 1.0f;
+    _version++;
 }
 
 void BrightnessService::set(float value) {
-    _value = clamp01(value);
+    value = clamp01(value);
+    if (value == _value) return;
+    _value = value;
+    _version++;
 }
 
 float BrightnessService::get() const {
@@ -41,7 +37,7 @@ float BrightnessService::get() const {
 }
 
 ThemeBlend BrightnessService::apply(const ThemeBlend& in) const {
-    ThemeBlend out;
+    ThemeBlend out = in;
     out.bg       = scale(in.bg,       _value);
     out.fg       = scale(in.fg,       _value);
     out.accent   = scale(in.accent,   _value);
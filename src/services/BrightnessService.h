@@ -26,8 +26,12 @@ public:
     // применить текущую яркость к ThemeBlend
     ThemeBlend apply(const ThemeBlend& in) const;
 
+    // Растёт при реальной смене яркости (ThemeService пересобирает таблицу)
+    uint32_t version() const { return _version; }
+
 private:
-    float _value = 1.0f;
+    float    _value   = 1.0f;
+    uint32_t _version = 0;
 
     static uint16_t scale(uint16_t rgb565, float k);
 };
\ No newline at end of file
@@ -26,7 +26,9 @@ ColorTemperatureService::ColorTemperatureService()
 // control
 // ============================================================================
 void ColorTemperatureService::set(ColorTemp t) {
+    if (_current == t) return;
     _current = t;
+    _version++;
 }
 
 ColorTemp ColorTemperatureService::current() const {
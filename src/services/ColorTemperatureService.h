@@ -51,6 +51,9 @@ public:
     void set(ColorTemp t);
     ColorTemp current() const;
 
+    // Растёт при реальной смене температуры (ThemeService пересобирает таблицу)
+    uint32_t version() const { return _version; }
+
     // ------------------------------------------------------------------------
     // MAIN API (post-process over ThemeBlend)
     // ------------------------------------------------------------------------
@@ -81,6 +84,7 @@ public:
 
 private:
     ColorTemp _current;
+    uint32_t  _version = 0;
 
     // ------------------------------------------------------------------------
     // helpers
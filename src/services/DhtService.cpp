@@ -9,15 +9,19 @@ void DhtService::begin() {
     _dht.begin();
 }
 
+void DhtService::sample() {
+    Reading r;
+    r.hum  = _dht.readHumidity();
+    r.temp = _dht.readTemperature();
+    _reading.publish(r);
+}
+
 void DhtService::update() {
-    uint32_t now = millis();
-    if (now - _lastReadMs < READ_INTERVAL_MS)
+    if (!_reading.fetch())
         return;
 
-    _lastReadMs = now;
-
-    float h = _dht.readHumidity();
-    float t = _dht.readTemperature();
+    const float h = _reading.get().hum;
+    const float t = _reading.get().temp;
 
     if (isnan(h) || isnan(t))
         return;
@@ -2,18 +2,30 @@
 #include <Arduino.h>
 #include <DHT.h>
 #include "core/ServiceVersion.h"
+#include "core/Snapshot.h"
 
 /*
  * DhtService
  * ----------
  * Периодически читает DHT и хранит значения.
  * Реактивный сервис (через versioning)
+ *
+ * Ядра:
+ *  - sample() — ядро сервисов (ServiceCore): одно чтение датчика
+ *    (~5 мс bit-bang с запретом прерываний), звать раз в
+ *    READ_INTERVAL_MS
+ *  - update() — ядро UI: забирает последний снимок, фильтрует
+ *    мелкие колебания, bump версии. I/O нет — можно звать часто
  */
 class DhtService {
 public:
+    // DHT22 не чаще раза в 2 с; берём с запасом
+    static constexpr uint32_t READ_INTERVAL_MS = 3000;
+
     DhtService(uint8_t pin, uint8_t type);
 
     void begin();
+    void sample();
     void update();
 
     bool   isValid() const;
@@ -24,13 +36,18 @@ public:
     const ServiceVersion& version() const;
 
 private:
+    struct Reading {
+        float temp;   // NaN — чтение не удалось
+        float hum;
+    };
+
     DHT _dht;
 
+    // Писатель — sample(), читатель — update()
+    Snapshot<Reading> _reading;
+
     float _temp = NAN;
     float _hum  = NAN;
 
-    uint32_t _lastReadMs = 0;
-    static constexpr uint32_t READ_INTERVAL_MS = 3000;
-
     ServiceVersion _version;
 };
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <math.h>
 
 #include "services/ForecastService.h"
+#include "core/ServiceCore.h"
 
 /*
  * ForecastService.cpp
@@ -18,8 +19,12 @@
  *
  * АРХИТЕКТУРА:
  *  - HTTP + JSON выполняются в отдельной FreeRTOS задаче
+ *    на ядре сервисов (ServiceCore::CORE) — парсинг не отнимает
+ *    ядро UI у кадров
  *  - update() НЕ блокирует
  *  - UI и кнопки всегда живые
+ *  - задача пишет только _work и публикует его в Snapshot;
+ *    модель UI меняется только в update(), между кадрами
  *
  * ФИКСЫ:
  *  - защита от старта задачи без Wi-Fi
@@ -31,12 +36,14 @@
 // ctor
 // ============================================================================
 ForecastService::ForecastService(
+    EventBus&   bus,
     const char* apiKey,
     const char* city,
     const char* units,
     const char* lang
 )
-    : _apiKey(apiKey)
+    : _bus(bus)
+    , _apiKey(apiKey)
     , _city(city)
     , _units(units)
     , _lang(lang)
@@ -48,7 +55,7 @@ ForecastService::ForecastService(
 // ============================================================================
 void ForecastService::begin() {
 
-    _model.reset();
+    _work.reset();
 
     _lastAttemptMs = 0;
     _lastUpdateMs  = 0;
@@ -69,6 +76,15 @@ void ForecastService::update() {
 
     const uint32_t now = millis();
 
+    // Результат ForecastTask — в модель UI
+    if (_model.fetch()) {
+        const ForecastModel& m = _model.get();
+        if (m.ready) _lastUpdateMs = m.updatedAtMs;
+
+        _version.bump();
+        _bus.publish(UiChannel::FORECAST);
+    }
+
     // FIX: если нет Wi-Fi — просто ждём
     if (WiFi.status() != WL_CONNECTED)
         return;
@@ -82,7 +98,7 @@ void ForecastService::update() {
             this,
             1,
             &_task,
-            1
+            ServiceCore::CORE
         );
     }
 
@@ -99,6 +115,9 @@ void ForecastService::update() {
 
     _lastAttemptMs = now;
     _needUpdate = true;
+
+    // Задача спит без таймаута — будим только когда есть работа
+    xTaskNotifyGive(_task);
 }
 
 // ============================================================================
@@ -113,6 +132,8 @@ void ForecastService::taskEntry(void* arg) {
 // ============================================================================
 void ForecastService::taskLoop() {
 
+    _awake.begin();
+
     for (;;) {
 
         if (_needUpdate && !_updating) {
@@ -120,50 +141,66 @@ void ForecastService::taskLoop() {
             _updating = true;
 
             if (fetchForecast()) {
-                _lastUpdateMs = millis();
-                _model.updatedAtMs = _lastUpdateMs;
-                _model.ready = true;
+                _work.updatedAtMs = millis();
+                _work.ready = true;
                 setError("");
-                Serial.printf("[Forecast] OK, days=%d\n", _model.daysCount);
+                Serial.printf("[Forecast] OK, days=%d\n", _work.daysCount);
             } else {
-                Serial.printf("[Forecast] FAIL: %s\n", lastError());
+                Serial.printf("[Forecast] FAIL: %s\n", _work.lastError);
             }
 
+            // Снимок — до сброса _updating: увидевший !isUpdating()
+            // update() уже найдёт результат
+            _model.publish(_work);
+
             _updating   = false;
             _needUpdate = false;
+
+            // Версию и FORECAST для экранов выставит update(), когда
+            // заберёт снимок; loop() не будим — "forecast" раз в 1 с
         }
 
-        // FIX: не жрём CPU
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        // Без опроса: спим до xTaskNotifyGive() из update()
+        _awake.sleep();
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        _awake.wake();
     }
 }
 
+// ============================================================================
+// diagnostics
+// ============================================================================
+uint32_t ForecastService::taskStackHighWater() const {
+    if (_task == nullptr) return 0;
+    return (uint32_t)uxTaskGetStackHighWaterMark(_task);
+}
+
 // ============================================================================
 // state helpers
 // ============================================================================
 bool ForecastService::shouldUpdate() const {
-    if (!_model.ready) return true;
+    if (!_model.get().ready) return true;
     return (millis() - _lastUpdateMs) >= UPDATE_INTERVAL_MS;
 }
 
 bool ForecastService::isReady() const {
-    return _model.ready;
+    return _model.get().ready;
 }
 
 const ForecastDay* ForecastService::today() const {
-    return _model.today();
+    return _model.get().today();
 }
 
 const ForecastDay* ForecastService::day(uint8_t index) const {
-    return _model.day(index);
+    return _model.get().day(index);
 }
 
 uint8_t ForecastService::daysCount() const {
-    return _model.daysCount;
+    return _model.get().daysCount;
 }
 
 const char* ForecastService::lastError() const {
-    return _model.lastError;
+    return _model.get().lastError;
 }
 
 // ============================================================================
@@ -217,7 +254,7 @@ bool ForecastService::fetchForecast() {
         return false;
     }
 
-    _model.reset();
+    _work.reset();
 
     time_t nowTs = time(nullptr);
     tm nowLocal{};
@@ -292,7 +329,7 @@ bool ForecastService::fetchForecast() {
         if (!acc[i].used)
             continue;
 
-        ForecastDay& d = _model.days[_model.daysCount];
+        ForecastDay& d = _work.days[_work.daysCount];
 
         d.dt = acc[i].dayMidnightDt;
         d.weekday = acc[i].weekday;
@@ -302,18 +339,18 @@ bool ForecastService::fetchForecast() {
         d.humidity  = acc[i].hum;
         d.weatherCode = acc[i].hasCode ? acc[i].weatherCode : 800;
 
-        _model.daysCount++;
-        if (_model.daysCount >= FORECAST_MAX_DAYS)
+        _work.daysCount++;
+        if (_work.daysCount >= FORECAST_MAX_DAYS)
             break;
     }
 
-    return _model.daysCount > 0;
+    return _work.daysCount > 0;
 }
 
 // ============================================================================
 // error
 // ============================================================================
 void ForecastService::setError(const char* msg) {
-    strncpy(_model.lastError, msg, sizeof(_model.lastError) - 1);
-    _model.lastError[sizeof(_model.lastError) - 1] = '\0';
+    strncpy(_work.lastError, msg, sizeof(_work.lastError) - 1);
+    _work.lastError[sizeof(_work.lastError) - 1] = '\0';
 }
\ No newline at end of file
@@ -3,6 +3,10 @@
 #include <Arduino.h>
 #include <WiFi.h>
 
+#include "core/EventBus.h"
+#include "core/PowerManager.h"
+#include "core/ServiceVersion.h"
+#include "core/Snapshot.h"
 #include "models/ForecastModel.h"
 
 /*
@@ -23,11 +27,14 @@
  *  - update() НЕ блокирует
  *  - HTTP + JSON выполняются в отдельной FreeRTOS задаче
  *  - UI никогда не фризится
+ *  - задача собирает СВОЮ модель и публикует её снимком;
+ *    update() (ядро UI) забирает снимок — экраны читают только его
  * ============================================================
  */
 class ForecastService {
 public:
     ForecastService(
+        EventBus&   bus,
         const char* apiKey,
         const char* city,
         const char* units,
@@ -38,7 +45,7 @@ public:
     // lifecycle
     // --------------------------------------------------------------------
     void begin();
-    void update();          // лёгкий, неблокирующий
+    void update();          // лёгкий, неблокирующий; забирает снимок задачи
 
     // --------------------------------------------------------------------
     // state
@@ -52,6 +59,13 @@ public:
 
     const char* lastError() const;
 
+    // Меняется, когда update() забрал результат попытки загрузки
+    uint32_t version() const { return _version.get(); }
+
+    // Минимум свободного стека ForecastTask за всё время, байт
+    // (0 — задача ещё не запущена)
+    uint32_t taskStackHighWater() const;
+
 private:
     // --------------------------------------------------------------------
     // FREE API
@@ -69,6 +83,7 @@ private:
     // --------------------------------------------------------------------
     // config
     // --------------------------------------------------------------------
+    EventBus&   _bus;
     const char* _apiKey;
     const char* _city;
     const char* _units;
@@ -78,14 +93,21 @@ private:
     // --------------------------------------------------------------------
     // model
     // --------------------------------------------------------------------
-    ForecastModel _model;
+    // Модель задачи: только ForecastTask (и begin() до её старта)
+    ForecastModel _work;
+
+    // Писатель — ForecastTask, читатель — update(); get() — модель UI
+    Snapshot<ForecastModel> _model;
 
+    // Только ядро UI
     uint32_t _lastUpdateMs  = 0;
     uint32_t _lastAttemptMs = 0;
 
     volatile bool _updating   = false;
     volatile bool _needUpdate = false;
 
+    ServiceVersion _version;
+
 private:
     // --------------------------------------------------------------------
     // FreeRTOS task
@@ -95,6 +117,9 @@ private:
 
     TaskHandle_t _task = nullptr;
 
+    // TLS + JSON — на полной частоте, ожидание её отпускает
+    AwakeLock _awake{ "forecast" };
+
 private:
     // --------------------------------------------------------------------
     // internal helpers (вызываются ТОЛЬКО из задачи)
@@ -1,6 +1,8 @@
 #pragma once
 #include <Adafruit_ST7735.h>
 
+#include "ui/Layout.h"
+
 /*
  * LayoutService
  * -------------
@@ -15,6 +17,12 @@
  * ПРАВИЛО:
  *  - НИКАКИХ магических чисел в экранах
  *  - ВСЕ координаты и отступы — отсюда
+ *
+ * ТАБЛИЦА:
+ *  - сама геометрия посчитана при компиляции (ui/Layout.h)
+ *  - сервис лишь выбирает строку по флагам и ориентации,
+ *    геттеры — чтение поля, без арифметики
+ *  - в кадре берите current() один раз и читайте поля структуры
  */
 class LayoutService {
 public:
@@ -22,6 +30,9 @@ public:
 
     void begin();
 
+    // Весь layout текущего варианта (ссылка стабильна до смены флагов)
+    const UiLayout& current() const { return *_cur; }
+
     // ===== FLAGS =====
     void setHasStatusBar(bool v);
     void setHasBottomBar(bool v);
@@ -30,38 +41,38 @@ public:
     bool hasBottomBar() const;
 
     // ===== HEIGHTS =====
-    int statusBarH() const;
-    int bottomBarH() const;
-    int contentH() const;
+    int statusBarH() const { return _cur->statusH; }
+    int bottomBarH() const { return _cur->bottomH; }
+    int contentH()   const { return _cur->contentH; }
 
     // ===== Y POSITIONS =====
-    int statusBarY() const;
-    int contentY() const;
-    int bottomBarY() const;
+    int statusBarY() const { return _cur->statusY; }
+    int contentY()   const { return _cur->contentY; }
+    int bottomBarY() const { return _cur->bottomY; }
 
     // ===== HEADER (inside content) =====
-    int headerY() const;
-    int headerHeight() const;
-    int headerTextY() const;
+    int headerY()      const { return _cur->headerY; }
+    int headerHeight() const { return _cur->headerH; }
+    int headerTextY()  const { return _cur->headerTextY; }
 
     // ===== PADDING (ЕДИНЫЙ СТАНДАРТ) =====
-    int padL() const;
-    int padR() const;
-    int padT() const;
-    int padB() const;
+    int padL() const { return _cur->padL; }
+    int padR() const { return _cur->padR; }
+    int padT() const { return _cur->padT; }
+    int padB() const { return _cur->padB; }
 
     // ===== CONTENT BOUNDS =====
-    int contentLeft() const;
-    int contentRight() const;
-    int contentW() const;
+    int contentLeft()  const { return _cur->contentLeft; }
+    int contentRight() const { return _cur->contentRight; }
+    int contentW()     const { return _cur->contentW; }
 
     // ===== CONTENT FLOW =====
     // Реальная стартовая Y-точка контента (ПОСЛЕ header)
-    int contentTopY() const;
-    int contentBottomY() const;
+    int contentTopY()    const { return _cur->contentTopY; }
+    int contentBottomY() const { return _cur->contentBottomY; }
 
     // ===== TEXT METRICS =====
-    int lineH() const;
+    int lineH() const { return _cur->lineH; }
 
     // ===== LEGACY ALIAS (ВРЕМЕННО) =====
     int statusY() const { return statusBarY(); }
@@ -80,25 +91,15 @@ public:
 
     int clockY() const { return contentY(); }
 
+private:
+    // Строка таблицы по флагам и текущей ориентации TFT
+    void select();
+
 private:
     Adafruit_ST7735& _tft;
 
     bool _hasStatusBar = false;
     bool _hasBottomBar = false;
 
-    // ===== FIXED UI METRICS =====
-    static constexpr int STATUS_BAR_HEIGHT = 24;
-    static constexpr int BOTTOM_BAR_HEIGHT = 26;
-
-    static constexpr int HEADER_HEIGHT     = 20;
-    static constexpr int HEADER_TEXT_PAD_Y = 4;
-
-    // Padding — ЕДИНЫЙ ДЛЯ ВСЕГО UI
-    static constexpr int PAD_L = 6;
-    static constexpr int PAD_R = 6;
-    static constexpr int PAD_T = 4;
-    static constexpr int PAD_B = 4;
-
-    // Высота строки (menu/list/text)
-    static constexpr int LINE_HEIGHT = 14;
-};
\ No newline at end of file
+    const UiLayout* _cur = &UI_LAYOUTS[UI_LANDSCAPE][0];
+};
@@ -4,10 +4,10 @@
 // ctor
 // ============================================================================
 NightService::NightService(
-    UiVersionService& uiVersion,
+    EventBus& bus,
     PreferencesService& prefs
 )
-    : _uiVersion(uiVersion)
+    : _bus(bus)
     , _prefs(prefs)
 {
 }
@@ -33,7 +33,7 @@ void NightService::begin() {
     _isNight = false;
 
     // логическое событие
-    _uiVersion.bump(UiChannel::THEME);
+    _bus.publish(UiChannel::THEME);
 }
 
 // ============================================================================
@@ -44,7 +44,7 @@ void NightService::setMode(Mode m) {
         return;
 
     _mode = m;
-    _uiVersion.bump(UiChannel::THEME);
+    _bus.publish(UiChannel::THEME);
 }
 
 NightService::Mode NightService::mode() const {
@@ -66,7 +66,7 @@ void NightService::setAutoRange(int startMin, int endMin) {
     _autoEndMin   = endMin;
 
     if (_mode == Mode::AUTO) {
-        _uiVersion.bump(UiChannel::THEME);
+        _bus.publish(UiChannel::THEME);
     }
 }
 
@@ -108,7 +108,7 @@ void NightService::update(const TimeService& time) {
 
     if (night != _isNight) {
         _isNight = night;
-        _uiVersion.bump(UiChannel::THEME);
+        _bus.publish(UiChannel::THEME);
     }
 }
 
@@ -1,7 +1,7 @@
 #pragma once
 #include <stdint.h>
 
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 #include "services/TimeService.h"
 #include "services/PreferencesService.h"
 
@@ -31,7 +31,7 @@ public:
     };
 
     NightService(
-        UiVersionService& uiVersion,
+        EventBus& bus,
         PreferencesService& prefs
     );
 
@@ -57,7 +57,7 @@ private:
     bool computeAutoNight(const TimeService& time) const;
 
 private:
-    UiVersionService&    _uiVersion;
+    EventBus&    _bus;
     PreferencesService& _prefs;
 
     Mode _mode = Mode::AUTO;
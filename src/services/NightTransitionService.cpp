@@ -1,120 +1,66 @@
 #include "services/NightTransitionService.h"
 
-#include <math.h>
-
 // ============================================================================
 // ctor
 // ============================================================================
 
-NightTransitionService::NightTransitionService()
-    : _targetNight(false)
-    , _t(0.0f)
-    , _lastMs(0)
-    , _v(0.0f)
+NightTransitionService::NightTransitionService(Timeline& timeline)
+    : _timeline(timeline)
+    , _targetNight(false)
+    , _t(0)
+    , _started(false)
+    , _v(0)
     , _dirty(true)   // чтобы первый кадр гарантированно отрисовался
-    , _lastQ(255)    // заведомо "не равно" quantize8(0.0)
+    , _lastQ(255)    // заведомо "не равно" q16ToU8(0)
 {
 }
 
-// ============================================================================
-// helpers
-// ============================================================================
-
-float NightTransitionService::smoothstep(float t) {
-    if (t < 0.0f) t = 0.0f;
-    if (t > 1.0f) t = 1.0f;
-    return t * t * (3.0f - 2.0f * t);
-}
-
-uint8_t NightTransitionService::quantize8(float t) {
-    if (t < 0.0f) t = 0.0f;
-    if (t > 1.0f) t = 1.0f;
-    int v = (int)lroundf(t * 255.0f);
-    if (v < 0) v = 0;
-    if (v > 255) v = 255;
-    return (uint8_t)v;
-}
-
 // ============================================================================
 // control
 // ============================================================================
 
 void NightTransitionService::setTarget(bool night) {
-    _targetNight = night;
-    // Само по себе изменение цели не означает, что value() изменилось,
-    // поэтому dirty тут НЕ ставим. dirty ставится в update() при реальном
-    // изменении t/value.
-}
+    if (night == _targetNight) return;
 
-void NightTransitionService::update() {
-    const uint32_t now = millis();
+    _targetNight = night;
 
-    // Первый вызов: просто инициализируем таймер и синхронизируем _v.
-    if (_lastMs == 0) {
-        _lastMs = now;
+    // Новая дорожка от текущего t: разворот на полпути без скачка
+    const q16_t to   = night ? Q16_ONE : 0;
+    const q16_t path = (to > _t) ? (to - _t) : (_t - to);
 
-        // Сразу вычислим "готовое" значение, чтобы первый кадр был корректным.
-        const float eased = smoothstep(_t);
-        _v = eased;
+    _timeline.stop(_track);
+    _track = _timeline.start(Timeline::Spec{
+        _t, to,
+        (uint16_t)(((uint32_t)path * FULL_MS) >> 16),
+        0,
+        Timeline::Ease::LINEAR,
+        false
+    });
 
-        _dirty = true;
-        _lastQ = quantize8(_v);
-        return;
-    }
+    // dirty тут НЕ ставим: он ставится в update() при реальном изменении
+}
 
-    uint32_t dtMs = now - _lastMs;
-    _lastMs = now;
+void NightTransitionService::update() {
 
-    // Страховка: если dt вдруг огромный (пауза/зависание),
-    // ограничим шаг, чтобы не "телепортировать" переход.
-    if (dtMs > 250) dtMs = 250;
+    const q16_t prevV = _v;
 
-    const float prevV = _v;
+    // Дорожка закончилась (или её не было) — стоим на цели
+    _t = _timeline.value(_track, _targetNight ? Q16_ONE : 0);
+    _v = smoothstepQ16(_t);
 
-    // ------------------------------------------------------------------------
-    // 1) линейно двигаем _t к цели
-    // ------------------------------------------------------------------------
-    if (_targetNight) {
-        _t += (float)dtMs * SPEED;
-        if (_t >= 1.0f - SNAP_EPS) _t = 1.0f;
-    } else {
-        _t -= (float)dtMs * SPEED;
-        if (_t <= 0.0f + SNAP_EPS) _t = 0.0f;
+    // Первый вызов: первый кадр гарантированно отрисуется
+    if (!_started) {
+        _started = true;
+        _dirty   = true;
+        _lastQ   = q16ToU8(_v);
+        return;
     }
 
-    // ------------------------------------------------------------------------
-    // 2) easing
-    // ------------------------------------------------------------------------
-    const float eased = smoothstep(_t);
-
-    // ------------------------------------------------------------------------
-    // 3) inertia / smoothing: мягко догоняем eased
-    // ------------------------------------------------------------------------
-    //
-    // Экспоненциальное сглаживание:
-    //   v += (target - v) * alpha
-    //
-    // alpha зависит от dt, чтобы скорость была одинаковой при разных FPS.
-    //
-    // Простая практичная формула:
-    //   alpha = 1 - pow(1 - INERTIA, dtMs)
-    // где INERTIA ~ 0.03..0.05
-    //
-    float alpha = 1.0f - powf(1.0f - INERTIA, (float)dtMs);
-    if (alpha < 0.0f) alpha = 0.0f;
-    if (alpha > 1.0f) alpha = 1.0f;
-
-    _v += (eased - _v) * alpha;
-
-    // Прибиваем совсем к краям, чтобы не было вечного дрейфа _v.
-    if (_t <= 0.0f) _v = 0.0f;
-    if (_t >= 1.0f) _v = 1.0f;
-
     // ------------------------------------------------------------------------
     // dirty-логика: "заметное" изменение по квантованию 0..255 уже после
-    // easing + smoothing. Это ближе к тому, как глаз видит изменение.
+    // easing. Это ближе к тому, как глаз видит изменение.
     // ------------------------------------------------------------------------
-    const uint8_t q = quantize8(_v);
+    const uint8_t q = q16ToU8(_v);
 
     _dirty = (q != _lastQ) || (prevV != _v);
     _lastQ = q;
@@ -125,8 +71,7 @@ void NightTransitionService::update() {
 // ============================================================================
 
 bool NightTransitionService::transitioning() const {
-    return (_targetNight && _t < 1.0f)
-        || (!_targetNight && _t > 0.0f);
+    return _timeline.active(_track);
 }
 
 bool NightTransitionService::dirty() const {
@@ -142,7 +87,7 @@ bool NightTransitionService::targetNight() const {
 }
 
 float NightTransitionService::rawFactor() const {
-    return _t;
+    return (float)_t / (float)Q16_ONE;
 }
 
 float NightTransitionService::nightFactor() const {
@@ -151,5 +96,9 @@ float NightTransitionService::nightFactor() const {
 }
 
 float NightTransitionService::value() const {
-    return _v;
-}
\ No newline at end of file
+    return (float)_v / (float)Q16_ONE;
+}
+
+uint8_t NightTransitionService::value8() const {
+    return q16ToU8(_v);
+}
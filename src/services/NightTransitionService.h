@@ -2,6 +2,9 @@
 
 #include <Arduino.h>
 
+#include "core/FixedMath.h"
+#include "core/Timeline.h"
+
 /*
  * NightTransitionService
  * ----------------------
@@ -25,17 +28,22 @@
  *   NightTransitionService::update() в loop()
  *   UI/Theme берет NightTransitionService::value() и смешивает цвета
  *
- * ДОПОЛНЕНИЕ (UX):
- *  value() выдаёт "готовое" значение для UI:
- *   - линейный фактор t (0..1) → easing smoothstep
- *   - затем "мягкое догоняние" (экспоненциальное сглаживание), чтобы:
- *       * убрать микродёргание из-за неровного dt
- *       * получить более "дорогой" закат/рассвет
+ * ВРЕМЯ:
+ *  - линейный фактор t ведёт дорожка Timeline (часы кадра),
+ *    своего интегратора по millis() больше нет
+ *  - смена цели на полпути — новая дорожка от текущего t,
+ *    длительность пропорциональна оставшемуся пути
+ *  - value() = smoothstep(t); inertia-сглаживание не нужно:
+ *    t считается от абсолютного времени, а не суммой неровных dt
+ *
+ * ЧИСЛА:
+ *  - t и value хранятся в Q16 (core/FixedMath.h), update() каждый кадр
+ *    обходится без float; float-геттеры — только конверсия для логики
  */
 
 class NightTransitionService {
 public:
-    NightTransitionService();
+    explicit NightTransitionService(Timeline& timeline);
 
     // ------------------------------------------------------------------------
     // control
@@ -50,8 +58,7 @@ public:
     // ДОЛЖНО вызываться регулярно (обычно в loop()).
     //
     // Сервис сам:
-    //  - учитывает dt по millis()
-    //  - "прибивает" фактор к 0/1 (snap), чтобы не было вечного дрейфа
+    //  - берёт t с дорожки Timeline
     //  - ведёт флаг dirty, если значение заметно изменилось
     void update();
 
@@ -86,38 +93,26 @@ public:
     // Универсальное значение для UI и Theme.
     // Именно ЭТОТ метод используйте для blend'а цветов.
     //
-    // Здесь применяется:
-    //  - easing (smoothstep)
-    //  - сглаживание (inertia), чтобы переход выглядел "дороже"
+    // Здесь применяется easing (smoothstep)
     float value() const;
 
-private:
-    // easing: 3t^2 - 2t^3
-    static float smoothstep(float t);
-
-    // Квантование (0..255). Нужен для "заметного изменения" и dirty.
-    static uint8_t quantize8(float t);
+    // value() квантованное в 0..255 — индекс для ThemeService::at()
+    uint8_t value8() const;
 
 private:
+    Timeline&    _timeline;
+    Timeline::Id _track = Timeline::NONE;
+
     bool     _targetNight;   // к какому состоянию идём
-    float    _t;             // текущий фактор (0.0 .. 1.0), линейный "прогресс"
-    uint32_t _lastMs;        // время предыдущего update()
+    q16_t    _t;             // текущий фактор (Q16 0..1), линейный "прогресс"
+    bool     _started;       // первый update() уже был
 
-    // "Сглаженное" готовое значение для UI (после easing + inertia)
-    float    _v;
+    // Готовое значение для UI (после easing)
+    q16_t    _v;
 
     bool     _dirty;         // изменилось заметно с прошлого update()
     uint8_t  _lastQ;         // последний квант (0..255) для dirty
 
-    // Скорость изменения t в миллисекунду.
-    // 0.00025f ~= полный переход ~4 секунды.
-    static constexpr float SPEED = 0.00025f;
-
-    // Порог "прибивания" к краям.
-    static constexpr float SNAP_EPS = 0.0015f; // ~0.15%
-
-    // Сглаживание итогового value() (inertia).
-    // Чем больше — тем быстрее догоняем.
-    // 0.020..0.045 выглядит мягко на TFT.
-    static constexpr float INERTIA = 0.035f;
+    // Полный переход 0 → 1 (мс); частичный — пропорционально
+    static constexpr uint16_t FULL_MS = 4000;
 };
\ No newline at end of file
@@ -22,8 +22,9 @@ void NtpTimeProvider::update() {
         }
     }
 
+    // Без ожидания (по умолчанию getLocalTime ждёт до 5 с)
     tm t{};
-    if (!getLocalTime(&t)) {
+    if (!getLocalTime(&t, 0)) {
         return;
     }
 
@@ -4,20 +4,30 @@
 #include <math.h>
 
 #include "theme/Themes.h"
+#include "ui/ColorUtil.h"
 
 // ============================================================================
 // ctor / init
 // ============================================================================
 
-ThemeService::ThemeService(UiVersionService& uiVersion)
-    : _uiVersion(uiVersion)
+ThemeService::ThemeService(EventBus& bus)
+    : _bus(bus)
 {
 }
 
 void ThemeService::begin() {
     _theme = THEME_DAY;
     _night = false;
-    _cachedBlend = interpolate(0.0f);
+    rebuildTable();
+}
+
+void ThemeService::attachFilters(
+    const ColorTemperatureService& colorTemp,
+    const BrightnessService&       brightness
+) {
+    _colorTemp  = &colorTemp;
+    _brightness = &brightness;
+    _tableReady = false;
 }
 
 // ============================================================================
@@ -30,7 +40,7 @@ void ThemeService::setNight(bool night) {
     _night = night;
     _theme = _night ? THEME_NIGHT : THEME_DAY;
 
-    _uiVersion.bump(UiChannel::THEME);
+    _bus.publish(UiChannel::THEME);
 }
 
 bool ThemeService::isNight() const {
@@ -46,19 +56,11 @@ const Theme& ThemeService::current() const {
 // ============================================================================
 
 uint16_t ThemeService::blend565(uint16_t a, uint16_t b, float k) {
-    uint8_t ar = (a >> 11) & 0x1F;
-    uint8_t ag = (a >> 5)  & 0x3F;
-    uint8_t ab =  a        & 0x1F;
-
-    uint8_t br = (b >> 11) & 0x1F;
-    uint8_t bg = (b >> 5)  & 0x3F;
-    uint8_t bb =  b        & 0x1F;
-
-    uint8_t r = ar + (br - ar) * k;
-    uint8_t g = ag + (bg - ag) * k;
-    uint8_t b2 = ab + (bb - ab) * k;
+    if (k <= 0.0f) return a;
+    if (k >= 1.0f) return b;
 
-    return (r << 11) | (g << 5) | b2;
+    // целочисленное SWAR-ядро (ui/ColorUtil.h)
+    return ::blend565(a, b, (uint8_t)(k * 255.0f + 0.5f));
 }
 
 static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
@@ -76,41 +78,80 @@ static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
 
 const ThemeBlend& ThemeService::blend() const {
     // k = 0 для day, 1 для night
-    float k = _night ? 1.0f : 0.0f;
-    _cachedBlend = interpolate(k);
-    return _cachedBlend;
+    return at(_night ? 255 : 0);
 }
+
 // ============================================================================
-// interpolate → ThemeBlend (УСИЛЕННЫЙ КОНТРАСТ)
+// TABLE
 // ============================================================================
+bool ThemeService::filtersChanged() const {
+    return (_colorTemp  && _colorTemp->version()  != _colorTempVer)
+        || (_brightness && _brightness->version() != _brightnessVer);
+}
 
-ThemeBlend ThemeService::interpolate(float k) const {
+const ThemeBlend& ThemeService::at(uint8_t night8) const {
+    if (!_tableReady || filtersChanged()) {
+        rebuildTable();
+    }
+
+    // 0..255 → 0..BLEND_LEVELS-1 (с округлением)
+    const uint8_t idx =
+        (uint8_t)(((uint16_t)night8 * (BLEND_LEVELS - 1) + 127) / 255);
+
+    return _table[idx];
+}
+
+void ThemeService::rebuildTable() const {
+    for (uint8_t i = 0; i < BLEND_LEVELS; i++) {
+        ThemeBlend b = interpolate((float)i / (float)(BLEND_LEVELS - 1));
+
+        if (_colorTemp)  b = _colorTemp->apply(b);
+        if (_brightness) b = _brightness->apply(b);
+
+        _table[i] = b;
+    }
 
+    if (_colorTemp)  _colorTempVer  = _colorTemp->version();
+    if (_brightness) _brightnessVer = _brightness->version();
+
+    _tableReady = true;
+    _tableVersion++;
+}
+// ============================================================================
+// interpolate → ThemeBlend (УСИЛЕННЫЙ КОНТРАСТ)
+// ============================================================================
+
+// Крайние палитры (k = 0 / k = 1)
+static ThemeBlend endpoint(const Theme& t, bool night) {
     ThemeBlend out{};
 
     // background / foreground
-    out.bg = blend565(THEME_DAY.bg, THEME_NIGHT.bg, k);
-    out.fg = blend565(THEME_DAY.textPrimary, THEME_NIGHT.textPrimary, k);
+    out.bg = t.bg;
+    out.fg = t.textPrimary;
 
     // muted — вторичный, тёмный
-    out.muted = blend565(
-        rgb565(140, 140, 140),
-        rgb565(90,  90,  90),
-        k
-    );
+    out.muted = night ? rgb565(90, 90, 90) : rgb565(140, 140, 140);
 
     // accent — из темы
-    out.accent = blend565(THEME_DAY.accent, THEME_NIGHT.accent, k);
+    out.accent = t.accent;
 
     // success — ЯВНО зелёный
-    out.success = blend565(
-        rgb565(0, 200, 0),
-        rgb565(0, 120, 0),
-        k
-    );
+    out.success = night ? rgb565(0, 120, 0) : rgb565(0, 200, 0);
 
     // warn / error
-    out.warn = blend565(THEME_DAY.error, THEME_NIGHT.error, k);
+    out.warn = t.error;
 
     return out;
-}
\ No newline at end of file
+}
+
+ThemeBlend ThemeService::interpolate(float k) const {
+
+    static const ThemeBlend DAY   = endpoint(THEME_DAY,   false);
+    static const ThemeBlend NIGHT = endpoint(THEME_NIGHT, true);
+
+    if (k <= 0.0f) return DAY;
+    if (k >= 1.0f) return NIGHT;
+
+    // Все поля разом, в линейном свете (без "провала" посередине)
+    return blendPalette(DAY, NIGHT, (uint8_t)(k * 255.0f + 0.5f));
+}
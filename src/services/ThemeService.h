@@ -1,8 +1,10 @@
 #pragma once
 #include <stdint.h>
 
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
 #include "services/ThemeBlend.h"      // ✅ НОВОЕ: ThemeBlend для нового пайплайна
+#include "services/ColorTemperatureService.h"
+#include "services/BrightnessService.h"
 #include "theme/Theme.h"
 #include "theme/Themes.h"
 
@@ -35,18 +37,28 @@
  *  - UI больше не должен знать про THEME_DAY/THEME_NIGHT и blend565()
  *
  * blended(k) мы оставляем для совместимости со старым UI.
+ *
+ * ---------------------------------------------------------------------------
+ * ТАБЛИЦА (горячий путь UI):
+ *
+ *   const ThemeBlend& th = themeService.at(nightTransition.value8());
+ *
+ *  - BLEND_LEVELS готовых ThemeBlend (interpolate → colorTemp → brightness)
+ *  - строится один раз и пересобирается ТОЛЬКО при смене
+ *    цветовой температуры / яркости (по их version())
+ *  - at() — O(1), без float и без blend565 в кадре
  */
 
 class ThemeService {
 public:
-    explicit ThemeService(UiVersionService& uiVersion);
+    explicit ThemeService(EventBus& bus);
 // Упрощённый доступ для UI (без знания NightTransition)
 
     // Установить значения по умолчанию (день).
     void begin();
 
     // Жёстко установить режим темы (без анимации).
-    // Если значение реально изменилось — будет bump(UiChannel::THEME).
+    // Если значение реально изменилось — будет publish(UiChannel::THEME).
     void setNight(bool night);
 
     bool isNight() const;
@@ -82,6 +94,23 @@ public:
      */
     ThemeBlend interpolate(float k) const;
 
+    // ------------------------------------------------------------------------
+    // TABLE API
+    // ------------------------------------------------------------------------
+    static constexpr uint8_t BLEND_LEVELS = 64;
+
+    // Пост-фильтры, которые запекаются в таблицу
+    void attachFilters(
+        const ColorTemperatureService& colorTemp,
+        const BrightnessService&       brightness
+    );
+
+    // Готовый ThemeBlend для кванта ночи 0..255 (NightTransitionService::value8)
+    const ThemeBlend& at(uint8_t night8) const;
+
+    // Растёт при каждой пересборке таблицы (для кешей спрайтов / иконок)
+    uint32_t tableVersion() const { return _tableVersion; }
+
     // ------------------------------------------------------------------------
     // blending helpers
     // ------------------------------------------------------------------------
@@ -119,9 +148,22 @@ public:
     static uint16_t blend565(uint16_t a, uint16_t b, float k);
 
 private:
-    UiVersionService& _uiVersion;
-// кеш для blend()
-    mutable ThemeBlend _cachedBlend{};
+    void rebuildTable() const;
+    bool filtersChanged() const;
+
+private:
+    EventBus& _bus;
+
     bool  _night = false;
     Theme _theme;
+
+    // ---- table ----
+    const ColorTemperatureService* _colorTemp  = nullptr;
+    const BrightnessService*       _brightness = nullptr;
+
+    mutable ThemeBlend _table[BLEND_LEVELS];
+    mutable bool       _tableReady     = false;
+    mutable uint32_t   _tableVersion   = 0;
+    mutable uint32_t   _colorTempVer   = 0;
+    mutable uint32_t   _brightnessVer  = 0;
 };
\ No newline at end of file
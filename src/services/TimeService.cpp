@@ -5,8 +5,8 @@
 // ------------------------------------------------------------
 // ctor
 // ------------------------------------------------------------
-TimeService::TimeService(UiVersionService& uiVersion)
-    : _uiVersion(uiVersion)
+TimeService::TimeService(EventBus& bus)
+    : _bus(bus)
 {}
 
 // ------------------------------------------------------------
@@ -41,7 +41,7 @@ void TimeService::begin() {
         _syncState = NOT_STARTED;
     }
 
-    _uiVersion.bump(UiChannel::TIME);
+    _bus.publish(UiChannel::TIME);
 }
 
 // ------------------------------------------------------------
@@ -49,14 +49,70 @@ void TimeService::begin() {
 // ------------------------------------------------------------
 void TimeService::update() {
 
-    if (_mode == LOCAL_ONLY)
+    _clock.fetch();
+    const ClockSample& s = _clock.get();
+
+    if (_mode == LOCAL_ONLY) {
+        // Время providers в этом режиме не нужно и "на потом" не копится
+        // (снимок, взятый sample() до смены режима)
+        for (uint8_t i = 0; i < _providersCount; i++) {
+            _seenStamp[i] = s.providerStamp[i];
+        }
         return;
+    }
 
     // 1) provider stage (RTC first, NTP second)
-    tryConsumeProviders();
+    tryConsumeProviders(s);
 
     // 2) system clock tick (seconds should advance here)
-    updateFromSystemClock();
+    updateFromSystemClock(s);
+}
+
+// ------------------------------------------------------------
+// sample (ядро сервисов)
+// ------------------------------------------------------------
+void TimeService::sample() {
+
+    // Providers сами не блокируют (контракт TimeProvider),
+    // но RTC — это bit-bang DS1302: пусть он идёт не на ядре UI.
+    // LOCAL_ONLY: takeTime() не зовём — иначе разовое время RTC
+    // было бы взято и выброшено update()
+    const bool wantProviders =
+        _sampleMode.load(std::memory_order_relaxed) != LOCAL_ONLY;
+
+    bool fresh = false;
+
+    for (uint8_t i = 0; wantProviders && i < _providersCount; i++) {
+
+        TimeProvider* p = _providers[i];
+        if (!p) continue;
+
+        p->update();
+        if (!p->hasTime()) continue;
+
+        _sampling.provider[i] = p->takeTime();
+        _sampling.providerStamp[i]++;
+        fresh = true;
+    }
+
+    // Без ожидания: до первой синхронизации getLocalTime() по умолчанию
+    // ждёт до 5 с
+    tm t{};
+    _sampling.sysValid = getLocalTime(&t, 0);
+    if (_sampling.sysValid) {
+        _sampling.sys = t;
+    }
+
+    const int sec = _sampling.sysValid ? t.tm_sec : -1;
+    if (sec != _sampledSec) {
+        _sampledSec = sec;
+        fresh = true;
+    }
+
+    _clock.publish(_sampling);
+
+    // Будим update() только когда есть что показать
+    if (fresh) _bus.publish(UiChannel::CLOCK);
 }
 
 // ------------------------------------------------------------
@@ -67,6 +123,7 @@ void TimeService::setMode(Mode m) {
         return;
 
     _mode          = m;
+    _sampleMode.store((uint8_t)m, std::memory_order_relaxed);
     _syncState     = NOT_STARTED;
     _ntpConfirmed  = false;
     _rtcWritten    = false;
@@ -82,7 +139,7 @@ void TimeService::setMode(Mode m) {
         setSource(NONE);
     }
 
-    _uiVersion.bump(UiChannel::TIME);
+    _bus.publish(UiChannel::TIME);
 }
 
 TimeService::Mode TimeService::mode() const {
@@ -123,7 +180,7 @@ void TimeService::setFromRtc(const tm& t) {
 
     setSource(RTC);
 
-    _uiVersion.bump(UiChannel::TIME);
+    _bus.publish(UiChannel::TIME);
 }
 
 // ------------------------------------------------------------
@@ -155,7 +212,7 @@ void TimeService::applySystemTime(const tm& t) {
 // ------------------------------------------------------------
 // providers
 // ------------------------------------------------------------
-void TimeService::tryConsumeProviders() {
+void TimeService::tryConsumeProviders(const ClockSample& s) {
 
     // ВАЖНО: порядок providers = приоритет.
     // Ожидаем:
@@ -165,13 +222,11 @@ void TimeService::tryConsumeProviders() {
     // Это позволяет 100% отличать "кто дал время" без RTTI и без type field.
     for (uint8_t i = 0; i < _providersCount; i++) {
 
-        TimeProvider* p = _providers[i];
-        if (!p) continue;
-
-        p->update();
-        if (!p->hasTime()) continue;
+        // Новое время provider'а — ровно один раз, как takeTime()
+        if (s.providerStamp[i] == _seenStamp[i]) continue;
+        _seenStamp[i] = s.providerStamp[i];
 
-        TimeResult r = p->takeTime();
+        const TimeResult& r = s.provider[i];
         if (!r.valid) continue;
 
         if (!looksValid(r.time))
@@ -228,7 +283,7 @@ void TimeService::tryConsumeProviders() {
             }
         }
 
-        _uiVersion.bump(UiChannel::TIME);
+        _bus.publish(UiChannel::TIME);
         break;
     }
 }
@@ -236,19 +291,20 @@ void TimeService::tryConsumeProviders() {
 // ------------------------------------------------------------
 // system clock tick + DST + UX timeout
 // ------------------------------------------------------------
-void TimeService::updateFromSystemClock() {
+void TimeService::updateFromSystemClock(const ClockSample& s) {
 
     // UX: если долго SYNCING — считаем ошибкой
     if (_syncState == SYNCING && millis() - _syncStartedAt > 15000) {
         _syncState = ERROR;
-        _uiVersion.bump(UiChannel::TIME);
+        _bus.publish(UiChannel::TIME);
     }
 
-    tm t{};
-    if (!getLocalTime(&t)) {
+    if (!s.sysValid) {
         return;
     }
 
+    tm t = s.sys;
+
     // нормализуем wday/yday
     mktime(&t);
 
@@ -272,14 +328,14 @@ void TimeService::updateFromSystemClock() {
             _dstActive ? _daylightOffsetSec : 0,
             "pool.ntp.org"
         );
-        _uiVersion.bump(UiChannel::TIME);
+        _bus.publish(UiChannel::TIME);
     }
 
     // tick (это и должно заставлять секунды "идти")
     if (t.tm_min != _lastMinute || t.tm_sec != _lastSecond) {
         _lastMinute = t.tm_min;
         _lastSecond = t.tm_sec;
-        _uiVersion.bump(UiChannel::TIME);
+        _bus.publish(UiChannel::TIME);
     }
 }
 
@@ -289,7 +345,7 @@ void TimeService::updateFromSystemClock() {
 void TimeService::syncNtp() {
     _syncState = SYNCING;
     _syncStartedAt = millis();
-    _uiVersion.bump(UiChannel::TIME);
+    _bus.publish(UiChannel::TIME);
 }
 
 // ------------------------------------------------------------
@@ -298,7 +354,7 @@ void TimeService::syncNtp() {
 void TimeService::setSource(Source s) {
     if (_source == s) return;
     _source = s;
-    _uiVersion.bump(UiChannel::TIME);
+    _bus.publish(UiChannel::TIME);
 }
 
 // ------------------------------------------------------------
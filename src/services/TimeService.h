@@ -2,8 +2,10 @@
 
 #include <time.h>
 #include <stdint.h>
+#include <atomic>
 
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
+#include "core/Snapshot.h"
 #include "services/DstService.h"
 #include "services/TimeProvider.h"
 
@@ -18,6 +20,15 @@
  *   - ТОЛЬКО текст
  *   - БЕЗ цветов
  *   - БЕЗ логики UI
+ *
+ * Ядра:
+ * -----
+ * sample() — ядро сервисов (ServiceCore): providers (чтение RTC,
+ *   NTP) и getLocalTime() без ожидания → Snapshot<ClockSample>;
+ *   новая секунда или новое время provider — publish(CLOCK), по
+ *   нему loop() зовёт update() (без опроса по таймеру)
+ * update() и всё остальное — ядро UI: логика режимов / DST / UX
+ *   над последним снимком, без I/O
  */
 
 class TimeService {
@@ -42,11 +53,14 @@ public:
         NTP
     };
 
-    explicit TimeService(UiVersionService& uiVersion);
+    explicit TimeService(EventBus& bus);
 
     void begin();
     void update();
 
+    // Ядро сервисов: providers + системные часы → снимок для update()
+    void sample();
+
     void registerProvider(TimeProvider& p);
 
     bool shouldWriteRtc() const;
@@ -81,8 +95,17 @@ public:
     bool isDstActive() const { return _dstActive; }
 
 private:
-    void updateFromSystemClock();
-    void tryConsumeProviders();
+    static constexpr uint8_t MAX_PROVIDERS = 4;
+
+    struct ClockSample {
+        bool       sysValid;
+        tm         sys;
+        TimeResult provider[MAX_PROVIDERS];
+        uint32_t   providerStamp[MAX_PROVIDERS];   // +1 на каждое новое время
+    };
+
+    void updateFromSystemClock(const ClockSample& s);
+    void tryConsumeProviders(const ClockSample& s);
     void applySystemTime(const tm& t);
     void syncNtp();
     void setSource(Source s);
@@ -90,7 +113,7 @@ private:
     static bool looksValid(const tm& t);
 
 private:
-    UiVersionService& _uiVersion;
+    EventBus& _bus;
 
     Mode      _mode      = AUTO;
     SyncState _syncState = NOT_STARTED;
@@ -116,7 +139,16 @@ private:
 
     unsigned long _syncStartedAt = 0;
 
-    static constexpr uint8_t MAX_PROVIDERS = 4;
     TimeProvider* _providers[MAX_PROVIDERS]{};
     uint8_t _providersCount = 0;
+
+    // Копия _mode для sample(): в LOCAL_ONLY providers не опрашиваются
+    // и разовое время (RTC) остаётся у них до смены режима
+    std::atomic<uint8_t>  _sampleMode{ AUTO };
+
+    // Писатель — sample() (ядро сервисов), читатель — update()
+    ClockSample           _sampling{};
+    Snapshot<ClockSample> _clock;
+    int                   _sampledSec = -1;   // секунда последнего CLOCK
+    uint32_t              _seenStamp[MAX_PROVIDERS]{};
 };
\ No newline at end of file
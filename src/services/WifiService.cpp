@@ -48,24 +48,26 @@ static bool netLess(const WifiService::Network& a,
 // ctor
 // ============================================================================
 WifiService::WifiService(
-    UiVersionService& ui,
+    EventBus& bus,
     PreferencesService& prefs
 )
-    : _ui(ui)
+    : _bus(bus)
     , _prefs(prefs)
 {}
 
 // ============================================================================
-// UI version helpers
+// events (свои счётчики не держим — версии живут в EventBus)
 // ============================================================================
 void WifiService::bumpList() {
-    _listVersion++;
-    _ui.bump(UiChannel::WIFI);
+    _bus.publish(UiChannel::WIFI_LIST);
 }
 
 void WifiService::bumpState() {
-    _stateVersion++;
-    _ui.bump(UiChannel::WIFI);
+    _bus.publish(UiChannel::WIFI_STATE);
+}
+
+void WifiService::newLinkEpoch() {
+    _linkEpoch.fetch_add(1);
 }
 
 void WifiService::recomputeConnectedIndex() {
@@ -104,19 +106,23 @@ void WifiService::update() {
     if (!_enabled)
         return;
 
-    wl_status_t st = WiFi.status();
-    bool nowConnected = (st == WL_CONNECTED);
+    _link.fetch();
+    const Link& link = _link.get();
+
+    // Снимок снят до connect()/stop() — про новое подключение он не знает
+    const bool linkFresh    = (link.epoch == _linkEpoch.load());
+    const bool nowConnected = linkFresh && link.status == WL_CONNECTED;
 
     // ------------------------------------------------------------
     // ONLINE / ERROR transitions
     // ------------------------------------------------------------
     if (nowConnected && _state != State::ONLINE) {
         _state = State::ONLINE;
-        copySsid(_currentSsid, WiFi.SSID().c_str());
+        copySsid(_currentSsid, link.ssid);
         bumpState();
     }
 
-    if (!nowConnected && _state == State::ONLINE) {
+    if (linkFresh && !nowConnected && _state == State::ONLINE) {
         _state = State::ERROR;
         _currentSsid[0] = 0;
         bumpState();
@@ -129,6 +135,7 @@ void WifiService::update() {
         if (millis() - _connectStartMs > CONNECT_TIMEOUT_MS) {
             _state = State::ERROR;
             WiFi.disconnect(true);
+            newLinkEpoch();
             bumpState();
         }
     }
@@ -144,11 +151,10 @@ void WifiService::update() {
         // RSSI меняется часто, не хотим спамить UI каждый цикл.
         // Делаем bumpState() только если изменение заметное.
         static int16_t lastRssi = WifiService::RSSI_UNKNOWN;
-        int16_t rssiNow = (int16_t)WiFi.RSSI();
+        int16_t rssiNow = link.rssi;
 
         // Также обновляем current SSID (на случай роуминга/переподключения).
-        char ssidNow[33]{};
-        copySsid(ssidNow, WiFi.SSID().c_str());
+        const char* ssidNow = link.ssid;
 
         bool ssidChanged = !ssidEquals(_currentSsid, ssidNow);
         if (ssidChanged) {
@@ -224,7 +230,7 @@ void WifiService::update() {
                     changed = true;
                 }
                 // обновляем RSSI подключённой сети
-                int16_t r = (int16_t)WiFi.RSSI();
+                int16_t r = _link.get().rssi;
                 if (n.rssi != r) {
                     n.rssi = r;
                     // RSSI влияет на UI списка → это лист, но не надо сортить если не хотим.
@@ -246,6 +252,27 @@ void WifiService::update() {
     }
 }
 
+// ============================================================================
+// sample (ядро сервисов)
+// ============================================================================
+void WifiService::sample() {
+
+    Link l{};
+
+    // Эпоха — ДО запроса к стеку: connect() между ними сделает снимок
+    // устаревшим, а не "свежим со старым статусом"
+    l.epoch  = _linkEpoch.load();
+    l.status = WiFi.status();
+    l.rssi   = RSSI_UNKNOWN;
+
+    if (l.status == WL_CONNECTED) {
+        l.rssi = (int16_t)WiFi.RSSI();
+        copySsid(l.ssid, WiFi.SSID().c_str());
+    }
+
+    _link.publish(l);
+}
+
 // ============================================================================
 // ENABLE / DISABLE
 // ============================================================================
@@ -290,6 +317,7 @@ bool WifiService::isConnected() const {
 // ============================================================================
 void WifiService::start() {
 
+    newLinkEpoch();
     WiFi.mode(WIFI_STA);
 
     if (_prefs.hasWifiCredentials() && _prefs.wifiSsid()[0]) {
@@ -321,6 +349,7 @@ void WifiService::start() {
 }
 
 void WifiService::stop() {
+    newLinkEpoch();
     WiFi.disconnect(true);
     WiFi.mode(WIFI_OFF);
     _state = State::OFF;
@@ -345,6 +374,7 @@ void WifiService::connect(const char* ssid) {
         return;
     }
 
+    newLinkEpoch();
     WiFi.disconnect(true);
     WiFi.mode(WIFI_STA);
     WiFi.setAutoConnect(false);
@@ -364,6 +394,7 @@ void WifiService::connect(const char* ssid, const char* pass) {
     if (!_enabled || !ssid || !ssid[0])
         return;
 
+    newLinkEpoch();
     WiFi.disconnect(true);
     WiFi.mode(WIFI_STA);
     WiFi.setAutoConnect(false);
@@ -414,14 +445,6 @@ const WifiService::Network& WifiService::networkAt(int i) const {
     return _networks[i];
 }
 
-uint32_t WifiService::listVersion() const {
-    return _listVersion;
-}
-
-uint32_t WifiService::stateVersion() const {
-    return _stateVersion;
-}
-
 const char* WifiService::currentSsid() const {
     return (_state == State::ONLINE && _currentSsid[0])
         ? _currentSsid
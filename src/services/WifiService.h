@@ -1,10 +1,12 @@
 #pragma once
 
 #include <WiFi.h>
+#include <atomic>
 #include <cstdint>
 #include <vector>
 
-#include "services/UiVersionService.h"
+#include "core/EventBus.h"
+#include "core/Snapshot.h"
 #include "services/PreferencesService.h"
 
 class WifiService {
@@ -34,13 +36,17 @@ public:
     };
 
     WifiService(
-        UiVersionService& ui,
+        EventBus& bus,
         PreferencesService& prefs
     );
 
     void begin();
     void update();
 
+    // Ядро сервисов: WiFi.status() / RSSI() / SSID() → снимок для update().
+    // Всё остальное (connect, scan, список) — ядро UI.
+    void sample();
+
     void setEnabled(bool on);
     bool isEnabled() const;
 
@@ -59,9 +65,6 @@ public:
     int networksCount() const;
     const Network& networkAt(int i) const;
 
-    uint32_t listVersion() const;
-    uint32_t stateVersion() const;
-
 private:
     void start();
     void stop();
@@ -70,7 +73,17 @@ private:
     void bumpState();
     void recomputeConnectedIndex();
 
-    UiVersionService&    _ui;
+    // connect / disconnect / смена режима: снимки до этого — устарели
+    void newLinkEpoch();
+
+    struct Link {
+        wl_status_t status;
+        int16_t     rssi;
+        char        ssid[33];
+        uint32_t    epoch;      // _linkEpoch на момент снятия
+    };
+
+    EventBus&           _bus;
     PreferencesService& _prefs;
 
     State _state = State::OFF;
@@ -86,8 +99,9 @@ private:
 
     char _currentSsid[33] = {0};
 
-    uint32_t _listVersion  = 1;
-    uint32_t _stateVersion = 1;
+    // Писатель — sample(), читатель — update()
+    Snapshot<Link>        _link;
+    std::atomic<uint32_t> _linkEpoch{ 0 };
 
     static const Network DUMMY_NET;
 };
\ No newline at end of file
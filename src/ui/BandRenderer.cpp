@@ -0,0 +1,23 @@
+#include "ui/BandRenderer.h"
+
+// ============================================================================
+// ctor
+// ============================================================================
+BandRenderer::BandRenderer(UiDisplay& tft)
+    : _tft(tft)
+{
+}
+
+// ============================================================================
+// fill — фон полосы
+// ============================================================================
+void BandRenderer::fill(uint16_t* buf, uint16_t n, uint16_t color) {
+
+    // По два пикселя за запись (буфер выровнен по 4)
+    const uint32_t c2 = ((uint32_t)color << 16) | color;
+
+    uint32_t* p = reinterpret_cast<uint32_t*>(buf);
+    for (uint16_t i = 0; i < n / 2; i++) p[i] = c2;
+
+    if (n & 1) buf[n - 1] = color;
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <stdint.h>
+
+#include "ui/DirtyRegion.h"
+#include "ui/UiDisplay.h"
+
+/*
+ * BandRenderer
+ * ------------
+ * Крупные перерисовки (смена экрана, forceFullRedraw, полная очистка
+ * рабочей области) — горизонтальными полосами через RAM.
+ *
+ * Зачем:
+ *  - обычный flush шлёт каждый примитив своим окном адреса:
+ *    заливки, строки текста, иконки → сотни мелких SPI-транзакций
+ *  - в полосе все примитивы пишутся в буфер, полоса уходит ОДНИМ
+ *    окном адреса и одним потоком пикселей
+ *
+ * Два буфера:
+ *  - на ESP32 полоса уходит по DMA (UiDisplay::beginDma, spi_master):
+ *    pushBand() ставит её в очередь и возвращается, пока она идёт —
+ *    следующая растеризуется во второй буфер
+ *  - без DMA (env:native, драйвер не встал) pushBand() блокирует,
+ *    буферы просто чередуются
+ *
+ * ПАМЯТЬ:
+ *  - 2 * BAND_PX * 2 байт, статически (ScreenManager — глобальный
+ *    объект, .bss во внутренней DRAM — DMA-доступна)
+ */
+
+class BandRenderer {
+public:
+    // Пикселей в полосе: 16 строк во всю ширину 160
+    static constexpr uint16_t BAND_PX = 160 * 16;
+
+    static_assert(BAND_PX * sizeof(uint16_t) <= UiDisplay::DMA_MAX_BYTES,
+                  "BandRenderer: band exceeds the DMA transfer size");
+
+    explicit BandRenderer(UiDisplay& tft);
+
+    // Рисует area полосами: fn(band) должна нарисовать всё, что
+    // попадает в band (clip выставляет сама, как flushRect).
+    // Полоса заранее залита bg — непокрытые пиксели не "протекают".
+    template <typename DrawFn>
+    void render(const UiRect& area, uint16_t bg, DrawFn fn) {
+        render(area, bg, fn, [](const UiRect&, uint16_t*) {});
+    }
+
+    // То же + post(band, pixels) перед отправкой каждой полосы
+    // (например, смешивание со снимком в ScreenTransition).
+    template <typename DrawFn, typename PostFn>
+    void render(const UiRect& area, uint16_t bg, DrawFn fn, PostFn post) {
+
+        if (area.empty() || area.w > (int16_t)BAND_PX) return;
+
+        const uint32_t t0 = micros();
+
+        const int16_t rows = (int16_t)(BAND_PX / area.w);
+
+        _tft.beginBands();
+
+        uint8_t cur = 0;
+
+        for (int16_t y = area.y; y < area.bottom(); y += rows) {
+
+            const int16_t h = (area.bottom() - y < rows)
+                ? (int16_t)(area.bottom() - y)
+                : rows;
+
+            const UiRect band{ area.x, y, area.w, h };
+
+            // Второй буфер в это время может уходить по DMA
+            uint16_t* buf = _buf[cur];
+            cur ^= 1;
+
+            fill(buf, (uint16_t)(band.w * band.h), bg);
+
+            _tft.setBand(band, buf);
+            fn(band);
+            post(band, buf);
+            _tft.pushBand();
+
+            _bands++;
+        }
+
+        _tft.endBands();
+
+        _lastUs = micros() - t0;
+        _passes++;
+    }
+
+    // ===== STATS =====
+    uint32_t lastUs() const { return _lastUs; }   // последний проход, мкс
+    uint32_t passes() const { return _passes; }
+    uint32_t bands()  const { return _bands; }
+
+private:
+    static void fill(uint16_t* buf, uint16_t n, uint16_t color);
+
+private:
+    UiDisplay& _tft;
+
+    alignas(4) uint16_t _buf[2][BAND_PX];
+
+    uint32_t _lastUs = 0;
+    uint32_t _passes = 0;
+    uint32_t _bands  = 0;
+};
@@ -1,10 +1,11 @@
 #include "ui/ButtonBar.h"
 #include <Adafruit_GFX.h>
+#include <string.h>
 
 static constexpr int BASELINE_SHIFT = -2;
 
 ButtonBar::ButtonBar(
-    Adafruit_ST7735& tft,
+    UiDisplay& tft,
     ThemeService& themeService,
     LayoutService& layoutService
 )
@@ -13,10 +14,10 @@ ButtonBar::ButtonBar(
     , _layout(layoutService)
 {
     // SAFE DEFAULT — чтобы ButtonBar не была пустой
-    _labelLeft  = "<";
-    _labelOk    = "OK";
-    _labelRight = ">";
-    _labelBack  = "BACK";
+    _labels[(uint8_t)ButtonId::LEFT]  = "<";
+    _labels[(uint8_t)ButtonId::OK]    = "OK";
+    _labels[(uint8_t)ButtonId::RIGHT] = ">";
+    _labels[(uint8_t)ButtonId::BACK]  = "BACK";
 }
 
 // ============================================================================
@@ -32,20 +33,20 @@ void ButtonBar::setVisible(bool visible) {
     _dirty = true;
 }
 
+// Сеттеры только запоминают состояние: что именно изменилось,
+// update() выяснит сам, сравнив с нарисованным.
 void ButtonBar::setActions(bool left, bool ok, bool right, bool back) {
-    _hasLeft  = left;
-    _hasOk    = ok;
-    _hasRight = right;
-    _hasBack  = back;
-    _dirty = true;
+    _enabled[0] = left;
+    _enabled[1] = ok;
+    _enabled[2] = right;
+    _enabled[3] = back;
 }
 
 void ButtonBar::setHighlight(bool left, bool ok, bool right, bool back) {
-    _hiLeft  = left;
-    _hiOk    = ok;
-    _hiRight = right;
-    _hiBack  = back;
-    _dirty = true;
+    _highlight[0] = left;
+    _highlight[1] = ok;
+    _highlight[2] = right;
+    _highlight[3] = back;
 }
 
 void ButtonBar::setLabels(
@@ -54,130 +55,122 @@ void ButtonBar::setLabels(
     const char* right,
     const char* back
 ) {
-    _labelLeft  = left;
-    _labelOk    = ok;
-    _labelRight = right;
-    _labelBack  = back;
-    _dirty = true;
+    _labels[0] = left;
+    _labels[1] = ok;
+    _labels[2] = right;
+    _labels[3] = back;
 }
 
 void ButtonBar::flash(ButtonId id) {
-    switch (id) {
-        case ButtonId::LEFT:  _flashLeft  = FLASH_FRAMES; break;
-        case ButtonId::OK:    _flashOk    = FLASH_FRAMES; break;
-        case ButtonId::RIGHT: _flashRight = FLASH_FRAMES; break;
-        case ButtonId::BACK:  _flashBack  = FLASH_FRAMES; break;
+    _flash[(uint8_t)id] = FLASH_FRAMES;
+}
+
+ButtonBar::Cell ButtonBar::cellState(uint8_t i) const {
+    return Cell{ _labels[i], _enabled[i], _highlight[i], _flash[i] != 0 };
+}
+
+bool ButtonBar::sameCell(const Cell& a, const Cell& b) {
+    if (a.enabled != b.enabled || a.highlight != b.highlight || a.flash != b.flash) {
+        return false;
     }
-    _dirty = true;
+    if (a.label == b.label) return true;
+    if (!a.label || !b.label) return false;
+    return strcmp(a.label, b.label) == 0;
 }
 
-bool ButtonBar::anyFlashActive() const {
-    return _flashLeft || _flashOk || _flashRight || _flashBack;
+UiRect ButtonBar::barRect() const {
+    const UiLayout& L = _layout.current();
+    return UiRect{
+        0,
+        (int16_t)L.bottomY,
+        (int16_t)L.width,
+        (int16_t)L.bottomH
+    };
+}
+
+// последняя ячейка забирает остаток ширины (w % 4)
+UiRect ButtonBar::cellRect(const UiRect& bar, uint8_t i) const {
+    const int16_t cellW = bar.w / CELLS;
+    const int16_t x     = (int16_t)(bar.x + i * cellW);
+    const int16_t w     = (i == CELLS - 1) ? (int16_t)(bar.w - i * cellW) : cellW;
+    return UiRect{ x, bar.y, w, bar.h };
 }
 
 // ============================================================================
 // Update
 // ============================================================================
-void ButtonBar::update() {
-
-    const int h = _layout.buttonBarH();
-
-    if (h != _lastBarH) {
-        clear();
-        _dirty = true;
-        _wasVisible = false;
-        _lastBarH = h;
-    }
+void ButtonBar::update(DirtyRegion& dirty) {
 
-    if (h <= 0) {
-        _wasVisible = false;
-        return;
-    }
+    const UiRect r = barRect();
+    const bool show = _visible && !r.empty();
 
-    if (!_visible && _wasVisible) {
-        clear();
+    if (!show) {
+        // Старое место перекроют нижние слои
+        if (_wasVisible) dirty.add(_lastRect);
         _wasVisible = false;
-        return;
-    }
-
-    if (!_visible)
-        return;
-
-    if (_dirty || anyFlashActive() || !_wasVisible) {
-        clear();
-        draw();
-        _dirty = false;
+    } else {
+        const bool moved =
+            r.x != _lastRect.x || r.y != _lastRect.y ||
+            r.w != _lastRect.w || r.h != _lastRect.h;
+
+        const bool whole = _dirty || !_wasVisible || moved;
+
+        if (whole) {
+            if (_wasVisible && moved) dirty.add(_lastRect);
+            dirty.add(r);
+        }
+
+        // Ячейки: в кадр — только изменившиеся
+        for (uint8_t i = 0; i < CELLS; i++) {
+            const Cell now = cellState(i);
+            if (!whole && !sameCell(now, _drawn[i])) {
+                dirty.add(cellRect(r, i));
+            }
+            _drawn[i] = now;
+        }
+
+        _lastRect   = r;
         _wasVisible = true;
+        _dirty      = false;
     }
 
-    if (_flashLeft)  --_flashLeft;
-    if (_flashOk)    --_flashOk;
-    if (_flashRight) --_flashRight;
-    if (_flashBack)  --_flashBack;
+    for (uint8_t i = 0; i < CELLS; i++) {
+        if (_flash[i]) --_flash[i];
+    }
 }
 
 // ============================================================================
 // Drawing
 // ============================================================================
-void ButtonBar::clear() {
-    const Theme& th = _themeService.current();
-
-    const int h = _layout.buttonBarH();
-    if (h <= 0) return;
-
-    _tft.fillRect(
-        0,
-        _layout.buttonBarY(),
-        _tft.width(),
-        h,
-        th.bg
-    );
-}
-
 void ButtonBar::draw() {
 
-    const int y = _layout.buttonBarY();
-    const int h = _layout.buttonBarH();
-    const int w = _tft.width();
-    const int cellW = w / 4;
-
-    drawCell(0 * cellW, y, cellW, h, _labelLeft,
-             _hasLeft, _hiLeft, _flashLeft);
-
-    drawCell(1 * cellW, y, cellW, h, _labelOk,
-             _hasOk, _hiOk, _flashOk);
+    if (!_wasVisible) return;
 
-    drawCell(2 * cellW, y, cellW, h, _labelRight,
-             _hasRight, _hiRight, _flashRight);
-
-    drawCell(3 * cellW, y, cellW, h, _labelBack,
-             _hasBack, _hiBack, _flashBack);
+    for (uint8_t i = 0; i < CELLS; i++) {
+        const UiRect c = cellRect(_lastRect, i);
+        if (!_tft.clipIntersects(c.x, c.y, c.w, c.h)) continue;
+        drawCell(c, _drawn[i]);
+    }
 }
 
-void ButtonBar::drawCell(
-    int x, int y, int w, int h,
-    const char* label,
-    bool enabled,
-    bool highlight,
-    bool flash
-) {
+void ButtonBar::drawCell(const UiRect& r, const Cell& cell) {
     const Theme& th = _themeService.current();
 
     uint16_t bg = th.bg;
     uint16_t fg = th.textSecondary;
 
-    if (!enabled) {
+    if (!cell.enabled) {
         fg = th.textSecondary;
-    } else if (flash) {
+    } else if (cell.flash) {
         bg = th.accent;
         fg = th.bg;
-    } else if (highlight) {
+    } else if (cell.highlight) {
         fg = th.textPrimary;
     }
 
-    _tft.fillRect(x, y, w, h, bg);
+    _tft.fillRect(r.x, r.y, r.w, r.h, bg);
 
-    if (!label || !*label) return;
+    if (!cell.label || !*cell.label) return;
 
     _tft.setFont(nullptr);
     _tft.setTextSize(1);
@@ -186,11 +179,11 @@ void ButtonBar::drawCell(
 
     int16_t x1, y1;
     uint16_t tw, thh;
-    _tft.getTextBounds(label, 0, 0, &x1, &y1, &tw, &thh);
+    _tft.getTextBounds(cell.label, 0, 0, &x1, &y1, &tw, &thh);
 
-    const int textX = x + (w - (int)tw) / 2;
-    const int baselineY = y + (h / 2) + (thh / 2) - y1 + BASELINE_SHIFT;
+    const int textX = r.x + (r.w - (int)tw) / 2;
+    const int baselineY = r.y + (r.h / 2) + (thh / 2) - y1 + BASELINE_SHIFT;
 
     _tft.setCursor(textX, baselineY);
-    _tft.print(label);
-}
\ No newline at end of file
+    _tft.print(cell.label);
+}
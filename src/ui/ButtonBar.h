@@ -1,8 +1,8 @@
 #pragma once
-#include <Adafruit_ST7735.h>
-
 #include "services/ThemeService.h"
 #include "services/LayoutService.h"
+#include "ui/DirtyRegion.h"
+#include "ui/UiDisplay.h"
 
 /*
  * ButtonBar
@@ -13,6 +13,15 @@
  *  - ButtonBar НЕ знает смысла кнопок
  *  - Экран задаёт подписи и состояния
  *  - ButtonBar только рисует
+ *
+ * КАДР:
+ *  - update(dirty) — сравнивает каждую ячейку с нарисованной и отдаёт
+ *                    ТОЛЬКО прямоугольники изменившихся ячеек
+ *                    (вспышка OK не перерисовывает "<" и ">")
+ *  - draw()        — рисует ячейки, попавшие в clip (каждая сама льёт фон)
+ *
+ * Целиком панель уходит только при markDirty(), показе/скрытии
+ * и смене геометрии.
  */
 
 class ButtonBar {
@@ -25,12 +34,13 @@ public:
     };
 
     ButtonBar(
-        Adafruit_ST7735& tft,
+        UiDisplay& tft,
         ThemeService& themeService,
         LayoutService& layoutService
     );
 
-    void update();
+    void update(DirtyRegion& dirty);
+    void draw();
 
     // visibility / state
     void setVisible(bool visible);
@@ -49,47 +59,43 @@ public:
     void markDirty();
 
 private:
-    void clear();
-    void draw();
-    void drawCell(
-        int x, int y, int w, int h,
-        const char* label,
-        bool enabled,
-        bool highlight,
-        bool flash
-    );
+    static constexpr uint8_t CELLS = 4;
+
+    // Всё, от чего зависит вид ячейки
+    struct Cell {
+        const char* label;
+        bool        enabled;
+        bool        highlight;
+        bool        flash;
+    };
+
+    UiRect barRect() const;
+    UiRect cellRect(const UiRect& bar, uint8_t i) const;
+    Cell   cellState(uint8_t i) const;
+
+    static bool sameCell(const Cell& a, const Cell& b);
 
-    bool anyFlashActive() const;
+    void drawCell(const UiRect& r, const Cell& cell);
 
 private:
-    Adafruit_ST7735& _tft;
+    UiDisplay&       _tft;
     ThemeService&    _themeService;
     LayoutService&   _layout;
 
     bool _visible    = true;
     bool _wasVisible = false;
     bool _dirty      = true;
-    int  _lastBarH   = -1;
-
-    bool _hasLeft  = true;
-    bool _hasOk    = true;
-    bool _hasRight = true;
-    bool _hasBack  = true;
-
-    bool _hiLeft  = false;
-    bool _hiOk    = false;
-    bool _hiRight = false;
-    bool _hiBack  = false;
-
-    const char* _labelLeft  = nullptr;
-    const char* _labelOk    = nullptr;
-    const char* _labelRight = nullptr;
-    const char* _labelBack  = nullptr;
-
-    uint8_t _flashLeft  = 0;
-    uint8_t _flashOk    = 0;
-    uint8_t _flashRight = 0;
-    uint8_t _flashBack  = 0;
+
+    UiRect  _lastRect{ 0, 0, 0, 0 };   // где панель нарисована сейчас
+
+    // Заданное экраном состояние (индекс = ButtonId)
+    const char* _labels[CELLS]    = { nullptr, nullptr, nullptr, nullptr };
+    bool        _enabled[CELLS]   = { true, true, true, true };
+    bool        _highlight[CELLS] = { false, false, false, false };
+    uint8_t     _flash[CELLS]     = { 0, 0, 0, 0 };
+
+    // Что нарисовано сейчас (draw() рисует именно это)
+    Cell _drawn[CELLS] = {};
 
     static constexpr uint8_t FLASH_FRAMES = 6;
 };
\ No newline at end of file
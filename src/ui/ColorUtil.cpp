@@ -0,0 +1,146 @@
+#include "ui/ColorUtil.h"
+
+// ============================================================================
+// Gamma 2.2 LUT: канал RGB565 → линейный свет Q12 (0..4095)
+// ============================================================================
+static const uint16_t LIN5[32] = {
+       0,    2,   10,   24,   45,   74,  110,  155,
+     208,  270,  340,  419,  508,  605,  712,  829,
+     956, 1092, 1238, 1395, 1561, 1738, 1926, 2124,
+    2332, 2551, 2781, 3022, 3273, 3536, 3810, 4095
+};
+
+// Код 1 → 1, а не 0 (0.4 по формуле): LUT строго растёт, и обратный
+// переход возвращает тот же код — одинаковые каналы смешиваются точно
+static const uint16_t LIN6[64] = {
+       0,    1,    2,    5,   10,   16,   23,   33,
+      44,   57,   71,   88,  107,  127,  150,  174,
+     201,  229,  260,  293,  328,  365,  405,  446,
+     490,  536,  584,  635,  688,  743,  801,  860,
+     923,  987, 1054, 1124, 1196, 1270, 1347, 1426,
+    1507, 1592, 1678, 1767, 1859, 1953, 2050, 2149,
+    2251, 2356, 2463, 2573, 2685, 2800, 2917, 3037,
+    3160, 3286, 3414, 3545, 3678, 3814, 3953, 4095
+};
+
+// Линейный → код канала: v >> 4 → наибольший код с LUT <= 16 * k.
+// Дальше 0..4 шага вперёд и выбор ближайшего (ничья — младший).
+static const uint8_t INV5[256] = {
+     0,  2,  3,  4,  4,  5,  5,  6,  6,  6,  7,  7,  7,  8,  8,  8,
+     8,  9,  9,  9,  9,  9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14,
+    14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30
+};
+
+static const uint8_t INV6[256] = {
+     0,  5,  6,  8,  9, 10, 11, 12, 13, 13, 14, 15, 15, 16, 16, 17,
+    17, 18, 18, 19, 19, 20, 20, 21, 21, 21, 22, 22, 23, 23, 23, 24,
+    24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 27, 28, 28, 28, 28, 29,
+    29, 29, 29, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 33, 33,
+    33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 36, 36,
+    37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 39, 39, 39, 39, 39, 40,
+    40, 40, 40, 40, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 43,
+    43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 45, 45, 45, 45, 45,
+    45, 46, 46, 46, 46, 46, 46, 47, 47, 47, 47, 47, 47, 48, 48, 48,
+    48, 48, 48, 48, 49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50,
+    50, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52, 52, 52, 52, 53,
+    53, 53, 53, 53, 53, 53, 53, 54, 54, 54, 54, 54, 54, 54, 55, 55,
+    55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 57, 57,
+    57, 57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 59, 59,
+    59, 59, 59, 59, 59, 59, 60, 60, 60, 60, 60, 60, 60, 60, 60, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62
+};
+
+static uint8_t fromLinear(const uint16_t* lut, const uint8_t* inv, uint8_t n, uint16_t v) {
+    uint8_t c = inv[v >> 4];
+
+    while (c + 1 < n && lut[c + 1] <= v) c++;
+
+    if (c + 1 < n && (uint16_t)(lut[c + 1] - v) < (uint16_t)(v - lut[c])) {
+        c++;
+    }
+    return c;
+}
+
+// ============================================================================
+// SWAR в линейном свете: R / G / B — дорожки по 21 бит в uint64_t
+// (12 бит значения + 8 бит alpha + запас под округление)
+// ============================================================================
+static constexpr uint64_t LANE_MASK = 0xFFFull | (0xFFFull << 21) | (0xFFFull << 42);
+static constexpr uint64_t LANE_HALF = 128ull   | (128ull << 21)   | (128ull << 42);
+
+static inline uint64_t toLinear(uint16_t c) {
+    return  (uint64_t)LIN5[(c >> 11) & 0x1F]
+         | ((uint64_t)LIN6[(c >> 5)  & 0x3F] << 21)
+         | ((uint64_t)LIN5[ c        & 0x1F] << 42);
+}
+
+static inline uint16_t fromLinear565(uint64_t l) {
+    const uint8_t r = fromLinear(LIN5, INV5, 32, (uint16_t)( l        & 0xFFF));
+    const uint8_t g = fromLinear(LIN6, INV6, 64, (uint16_t)((l >> 21) & 0xFFF));
+    const uint8_t b = fromLinear(LIN5, INV5, 32, (uint16_t)((l >> 42) & 0xFFF));
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// ============================================================================
+// Batch
+// ============================================================================
+void blendPalette565(
+    const uint16_t* a,
+    const uint16_t* b,
+    uint16_t*       out,
+    uint8_t         n,
+    uint8_t         alpha
+) {
+    // 0..255 → 0..256: концы точные, середина — ровно половина
+    const uint64_t a8 = (uint64_t)alpha + (alpha >> 7);
+
+    for (uint8_t i = 0; i < n; i++) {
+        const uint64_t la = toLinear(a[i]);
+        const uint64_t lb = toLinear(b[i]);
+
+        // a * (256 - k) + b * k: слагаемые неотрицательные, максимум
+        // дорожки 4095 * 256 + 128 < 2^21 — переносов между каналами нет
+        const uint64_t l = ((la * (256 - a8) + lb * a8 + LANE_HALF) >> 8) & LANE_MASK;
+
+        out[i] = fromLinear565(l);
+    }
+}
+
+uint16_t blend565Gamma(uint16_t bg, uint16_t fg, uint8_t a) {
+    uint16_t out;
+    blendPalette565(&bg, &fg, &out, 1, a);
+    return out;
+}
+
+ThemeBlend blendPalette(const ThemeBlend& a, const ThemeBlend& b, uint8_t alpha) {
+
+    const uint16_t pa[8] = { a.bg, a.fg, a.accent, a.muted, a.warn, a.success, a.fgWarm, a.fgCool };
+    const uint16_t pb[8] = { b.bg, b.fg, b.accent, b.muted, b.warn, b.success, b.fgWarm, b.fgCool };
+    uint16_t       po[8];
+
+    blendPalette565(pa, pb, po, 8, alpha);
+
+    ThemeBlend out;
+    out.bg      = po[0];
+    out.fg      = po[1];
+    out.accent  = po[2];
+    out.muted   = po[3];
+    out.warn    = po[4];
+    out.success = po[5];
+    out.fgWarm  = po[6];
+    out.fgCool  = po[7];
+    return out;
+}
@@ -1,19 +1,87 @@
 #pragma once
 #include <Arduino.h>
 
+#include "services/ThemeBlend.h"
+
+/*
+ * ColorUtil
+ * ---------
+ * Целочисленное смешивание RGB565.
+ *
+ * Два пути:
+ *  - blend565()      — SWAR: R/G/B смешиваются ОДНОЙ 32-битной операцией
+ *                      (в гамма-пространстве, как было). Для горячих мест:
+ *                      пиксели, спрайты, пульсации.
+ *  - blend565Gamma() — в линейном свете (гамма 2.2, LUT Q12).
+ *                      Для палитр: переход день/ночь не "проваливается"
+ *                      в тёмное посередине.
+ *
+ * Линейный путь — тоже SWAR, но в uint64_t: 12 бит канала + 8 бит
+ * alpha на дорожку, три дорожки по 21 биту. В 32 бита это не
+ * помещается. Туда и обратно — по одной LUT на канал (обратная —
+ * по старшим битам и 0..4 шага уточнения, без бинарного поиска).
+ *
+ * Точность SWAR против float (round(bg + (fg - bg) * a / 255)):
+ * не больше 1 LSB в каждом канале (test/test_color).
+ *
+ * alpha: 0 -> bg, 255 -> fg
+ */
+
+// ============================================================================
+// SWAR
+// ============================================================================
+// RGB565 → 0b00000GGGGGG00000RRRRR000000BBBBB: у каждого канала 5+ бит запаса
+static constexpr uint32_t RGB565_SPREAD_MASK = 0x07E0F81F;
+
+static inline uint32_t spread565(uint16_t c) {
+    return ((uint32_t)c | ((uint32_t)c << 16)) & RGB565_SPREAD_MASK;
+}
+
+static inline uint16_t pack565(uint32_t s) {
+    s &= RGB565_SPREAD_MASK;
+    return (uint16_t)(s | (s >> 16));
+}
+
+// Половина младшего бита в каждом канале: округление перед >> 5
+static constexpr uint32_t RGB565_SPREAD_HALF = 0x02008010;
+
 static inline uint16_t blend565(uint16_t bg, uint16_t fg, uint8_t a /*0..255*/) {
     // a=0 -> bg, a=255 -> fg
-    uint8_t bg_r = (bg >> 11) & 0x1F;
-    uint8_t bg_g = (bg >> 5)  & 0x3F;
-    uint8_t bg_b =  bg        & 0x1F;
+    // Запас между каналами — 5 бит, поэтому alpha сжимаем до 0..32.
+    const uint32_t a5 = ((uint32_t)a + 4) >> 3;
+
+    const uint32_t b = spread565(bg);
+    const uint32_t f = spread565(fg);
+
+    // bg * (32 - a) + fg * a: слагаемые неотрицательные, заёмов между
+    // каналами нет. Максимум G: 63 * 32 + 16 < 2^11 — влезает в запас.
+    // Без округления G (6 бит) терял до 2 LSB, с ним — не больше 1.
+    return pack565((b * (32 - a5) + f * a5 + RGB565_SPREAD_HALF) >> 5);
+}
+
+// Яркость: k=0 -> чёрный, k=255 -> как есть
+static inline uint16_t scale565(uint16_t c, uint8_t k) {
+    const uint32_t k5 = ((uint32_t)k + 4) >> 3;
+    return pack565((spread565(c) * k5 + RGB565_SPREAD_HALF) >> 5);
+}
 
-    uint8_t fg_r = (fg >> 11) & 0x1F;
-    uint8_t fg_g = (fg >> 5)  & 0x3F;
-    uint8_t fg_b =  fg        & 0x1F;
+// ============================================================================
+// Gamma-aware
+// ============================================================================
+uint16_t blend565Gamma(uint16_t bg, uint16_t fg, uint8_t a /*0..255*/);
 
-    uint8_t r = (uint16_t(bg_r) * (255 - a) + uint16_t(fg_r) * a) / 255;
-    uint8_t g = (uint16_t(bg_g) * (255 - a) + uint16_t(fg_g) * a) / 255;
-    uint8_t b = (uint16_t(bg_b) * (255 - a) + uint16_t(fg_b) * a) / 255;
+// ============================================================================
+// Batch (палитры)
+// ============================================================================
+// out[i] = blend565Gamma(a[i], b[i], alpha) для n цветов: alpha
+// готовится один раз на палитру. out может совпадать с a.
+void blendPalette565(
+    const uint16_t* a,
+    const uint16_t* b,
+    uint16_t*       out,
+    uint8_t         n,
+    uint8_t         alpha
+);
 
-    return (uint16_t(r) << 11) | (uint16_t(g) << 5) | uint16_t(b);
-}
\ No newline at end of file
+// Все поля ThemeBlend за один вызов (в линейном свете)
+ThemeBlend blendPalette(const ThemeBlend& a, const ThemeBlend& b, uint8_t alpha);
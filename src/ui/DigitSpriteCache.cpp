@@ -0,0 +1,146 @@
+#include "ui/DigitSpriteCache.h"
+
+#include <string.h>
+
+#include "ui/ColorUtil.h"
+#include "ui/fonts/aa_digits.h"
+
+// Суперсэмплинг при масштабировании мастера: SS x SS выборок на пиксель
+static constexpr uint8_t SS = 4;
+
+// ============================================================================
+// begin — масштабируем мастер под высоту
+// ============================================================================
+void DigitSpriteCache::begin(int16_t digitH) {
+
+    if (digitH < MIN_H) digitH = MIN_H;
+    if (digitH > MAX_H) digitH = MAX_H;
+
+    if (digitH == _h) return;
+
+    _h      = digitH;
+    _digitW = (int16_t)((digitH * 10 + 8) / 16);
+    _colonW = (int16_t)((digitH * 5  + 8) / 16);
+
+    for (uint8_t g = 0; g < GLYPHS; g++) {
+        scaleGlyph(g);
+    }
+
+    for (uint8_t i = 0; i < SLOTS; i++) {
+        _slots[i].used = false;
+    }
+}
+
+// Каждый пиксель цели — среднее SS x SS точек мастера (box-фильтр).
+void DigitSpriteCache::scaleGlyph(uint8_t glyph) {
+
+    const uint8_t* src = aa_digits[glyph];
+
+    const int16_t  mw      = (glyph == COLON) ? AA_COLON_MASTER_W : AA_DIGIT_MASTER_W;
+    const int16_t  mh      = AA_DIGIT_MASTER_H;
+    const uint16_t mStride = (uint16_t)((mw + 1) / 2);
+
+    const int16_t w = glyphW(glyph);
+
+    uint8_t* out = _alpha[glyph];
+    memset(out, 0, ALPHA_BYTES);
+
+    for (int16_t y = 0; y < _h; y++) {
+        for (int16_t x = 0; x < w; x++) {
+
+            uint16_t sum = 0;
+
+            for (uint8_t j = 0; j < SS; j++) {
+                const int16_t sy = (int16_t)(((y * SS + j) * 2 + 1) * mh / (_h * SS * 2));
+
+                for (uint8_t i = 0; i < SS; i++) {
+                    const int16_t sx = (int16_t)(((x * SS + i) * 2 + 1) * mw / (w * SS * 2));
+                    const uint8_t b  = pgm_read_byte(&src[sy * mStride + (sx >> 1)]);
+                    sum += (sx & 1) ? (b & 0x0F) : (b >> 4);
+                }
+            }
+
+            const uint8_t  a = (uint8_t)((sum + SS * SS / 2) / (SS * SS));
+            const uint16_t p = (uint16_t)(y * w + x);
+
+            out[p >> 1] |= (p & 1) ? a : (uint8_t)(a << 4);
+        }
+    }
+}
+
+// ============================================================================
+// blend table — 16 цветов на пару fg/bg
+// ============================================================================
+void DigitSpriteCache::updateLut(uint16_t fg, uint16_t bg) {
+
+    if (_lutValid && fg == _lutFg && bg == _lutBg) return;
+
+    // Линейный свет: края цифр не темнеют на светлом фоне.
+    // 16 вызовов на пару цветов — на пиксель остаётся только выборка.
+    for (uint8_t a = 0; a < 16; a++) {
+        _lut[a] = blend565Gamma(bg, fg, (uint8_t)(a * 17));
+    }
+
+    _lutFg    = fg;
+    _lutBg    = bg;
+    _lutValid = true;
+}
+
+// ============================================================================
+// sprite (LRU)
+// ============================================================================
+const uint16_t* DigitSpriteCache::sprite(uint8_t glyph, uint16_t fg, uint16_t bg) {
+
+    if (_h == 0 || glyph >= GLYPHS) return nullptr;
+
+    _tick++;
+
+    uint8_t victim = 0;
+
+    for (uint8_t i = 0; i < SLOTS; i++) {
+        Slot& s = _slots[i];
+
+        if (s.used && s.glyph == glyph && s.fg == fg && s.bg == bg) {
+            s.lastUse = _tick;
+            _hits++;
+            return _pixels[i];
+        }
+
+        // пустой слот — лучший кандидат, иначе самый старый
+        if (!_slots[victim].used) continue;
+        if (!s.used || s.lastUse < _slots[victim].lastUse) victim = i;
+    }
+
+    _misses++;
+    render(victim, glyph, fg, bg);
+    return _pixels[victim];
+}
+
+// ============================================================================
+// render — alpha → RGB565 через таблицу
+// ============================================================================
+void DigitSpriteCache::render(uint8_t slot, uint8_t glyph, uint16_t fg, uint16_t bg) {
+
+    Slot& s = _slots[slot];
+    s.glyph   = glyph;
+    s.fg      = fg;
+    s.bg      = bg;
+    s.lastUse = _tick;
+    s.used    = true;
+
+    updateLut(fg, bg);
+
+    const uint8_t* a   = _alpha[glyph];
+    uint16_t*      out = _pixels[slot];
+
+    const uint16_t n = (uint16_t)(glyphW(glyph) * _h);
+
+    for (uint16_t p = 0; p + 1 < n; p += 2) {
+        const uint8_t b = a[p >> 1];
+        *out++ = _lut[b >> 4];
+        *out++ = _lut[b & 0x0F];
+    }
+    if (n & 1) {
+        *out = _lut[a[n >> 1] >> 4];
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * DigitSpriteCache
+ * ----------------
+ * Заранее растеризованные глифы крупных часов: '0'..'9' и ':'.
+ *
+ * Зачем:
+ *  - Adafruit_GFX рисует крупный шрифт как fillRect на каждую точку
+ *    глифа, каждый — отдельный setAddrWindow по SPI
+ *  - спрайт уходит ОДНИМ окном адреса (UiDisplay::blit); ClockScreen
+ *    перерисовывает только сменившиеся глифы
+ *
+ * Шрифт:
+ *  - сглаженный (4bpp alpha), мастер-растр во flash
+ *    (ui/fonts/aa_digits.h), а не увеличенный 5x7
+ *
+ * Как устроено:
+ *  - begin(h) один раз масштабирует мастер под высоту h (любую
+ *    в пределах MIN_H..MAX_H) → alpha-плоскости 0..15 в RAM
+ *  - sprite(glyph, fg, bg) отдаёт RGB565 спрайт из маленького LRU,
+ *    ключ — (глиф, fg, bg), т.е. цвета ThemeBlend
+ *  - пиксель спрайта = одна выборка из таблицы 16 цветов fg/bg
+ *    (таблица считается в линейном свете один раз на пару цветов)
+ *
+ * ПАМЯТЬ:
+ *  - фиксированная, без heap:
+ *    GLYPHS * MAX_W * MAX_H / 2 (alpha) + SLOTS * MAX_W * MAX_H * 2 байт
+ */
+
+class DigitSpriteCache {
+public:
+    static constexpr uint8_t GLYPHS  = 11;               // 0..9 + ':'
+    static constexpr uint8_t COLON   = 10;
+
+    static constexpr uint8_t SLOTS   = 6;                // HH MM ':' + запас
+
+    // Пропорции мастера: цифра 10x16, ':' 5x16
+    static constexpr int16_t MIN_H   = 12;
+    static constexpr int16_t MAX_H   = 44;
+    static constexpr int16_t MAX_W   = (MAX_H * 10 + 8) / 16;
+
+    // Высота цифр в пикселях (ширина — по пропорции). Повторный вызов
+    // с тем же размером — no-op, с другим — пересчёт и сброс LRU.
+    void begin(int16_t digitH);
+
+    int16_t digitW() const { return _digitW; }
+    int16_t digitH() const { return _h; }
+    int16_t colonW() const { return _colonW; }
+
+    int16_t glyphW(uint8_t glyph) const {
+        return glyph == COLON ? _colonW : _digitW;
+    }
+
+    // RGB565 спрайт glyphW(glyph) x digitH() (nullptr — неизвестный глиф)
+    const uint16_t* sprite(uint8_t glyph, uint16_t fg, uint16_t bg);
+
+    uint32_t hits()   const { return _hits; }
+    uint32_t misses() const { return _misses; }
+
+private:
+    struct Slot {
+        uint16_t fg;
+        uint16_t bg;
+        uint32_t lastUse;
+        uint8_t  glyph;
+        bool     used;
+    };
+
+    void scaleGlyph(uint8_t glyph);
+    void updateLut(uint16_t fg, uint16_t bg);
+    void render(uint8_t slot, uint8_t glyph, uint16_t fg, uint16_t bg);
+
+private:
+    static constexpr uint16_t ALPHA_BYTES = (MAX_W * MAX_H + 1) / 2;
+
+    int16_t  _h      = 0;
+    int16_t  _digitW = 0;
+    int16_t  _colonW = 0;
+
+    // Alpha текущего размера: 2 пикселя на байт, строки подряд
+    uint8_t  _alpha[GLYPHS][ALPHA_BYTES] = {};
+
+    // fg/bg → 16 цветов (alpha 0..15)
+    uint16_t _lut[16] = {};
+    uint16_t _lutFg = 0;
+    uint16_t _lutBg = 0;
+    bool     _lutValid = false;
+
+    Slot     _slots[SLOTS] = {};
+    uint16_t _pixels[SLOTS][MAX_W * MAX_H];
+
+    uint32_t _tick   = 0;
+    uint32_t _hits   = 0;
+    uint32_t _misses = 0;
+};
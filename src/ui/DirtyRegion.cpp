@@ -0,0 +1,152 @@
+#include "ui/DirtyRegion.h"
+
+// ============================================================================
+// UiRect
+// ============================================================================
+bool UiRect::intersects(const UiRect& o) const {
+    if (empty() || o.empty()) return false;
+    return x < o.right() && o.x < right()
+        && y < o.bottom() && o.y < bottom();
+}
+
+// Пустой o содержится в любом
+bool UiRect::contains(const UiRect& o) const {
+    if (o.empty()) return true;
+    if (empty()) return false;
+    return x <= o.x && o.right() <= right()
+        && y <= o.y && o.bottom() <= bottom();
+}
+
+UiRect UiRect::intersect(const UiRect& o) const {
+    const int16_t l = x > o.x ? x : o.x;
+    const int16_t t = y > o.y ? y : o.y;
+    const int16_t r = right()  < o.right()  ? right()  : o.right();
+    const int16_t b = bottom() < o.bottom() ? bottom() : o.bottom();
+
+    if (r <= l || b <= t) {
+        return UiRect{ 0, 0, 0, 0 };
+    }
+    return UiRect{ l, t, (int16_t)(r - l), (int16_t)(b - t) };
+}
+
+UiRect UiRect::unite(const UiRect& o) const {
+    if (empty())   return o;
+    if (o.empty()) return *this;
+
+    const int16_t l = x < o.x ? x : o.x;
+    const int16_t t = y < o.y ? y : o.y;
+    const int16_t r = right()  > o.right()  ? right()  : o.right();
+    const int16_t b = bottom() > o.bottom() ? bottom() : o.bottom();
+
+    return UiRect{ l, t, (int16_t)(r - l), (int16_t)(b - t) };
+}
+
+// ============================================================================
+// DirtyRegion
+// ============================================================================
+void DirtyRegion::clear() {
+    _count = 0;
+}
+
+void DirtyRegion::add(int x, int y, int w, int h) {
+    add(UiRect{ (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h });
+}
+
+void DirtyRegion::add(const UiRect& r) {
+    if (r.empty()) return;
+
+    // Уже целиком покрыт — ничего не делаем
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_rects[i].intersect(r).area() == r.area()) return;
+    }
+
+    if (_count < MAX_RECTS) {
+        _rects[_count++] = r;
+        absorb(_count - 1);
+        return;
+    }
+
+    // Переполнение: сливаем с самым "дешёвым" соседом
+    uint8_t best      = 0;
+    int32_t bestWaste = mergeWaste(_rects[0], r);
+
+    for (uint8_t i = 1; i < _count; i++) {
+        const int32_t w = mergeWaste(_rects[i], r);
+        if (w < bestWaste) {
+            bestWaste = w;
+            best      = i;
+        }
+    }
+
+    _rects[best] = _rects[best].unite(r);
+    absorb(best);
+}
+
+void DirtyRegion::clip(const UiRect& bounds) {
+    uint8_t out = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        const UiRect c = _rects[i].intersect(bounds);
+        if (!c.empty()) {
+            _rects[out++] = c;
+        }
+    }
+    _count = out;
+}
+
+uint32_t DirtyRegion::area() const {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        sum += (uint32_t)_rects[i].area();
+    }
+    return sum;
+}
+
+// ============================================================================
+// helpers
+// ============================================================================
+
+// Сколько пикселей union(a, b) НЕ принадлежат ни a, ни b.
+int32_t DirtyRegion::mergeWaste(const UiRect& a, const UiRect& b) {
+    const int32_t covered =
+        a.area() + b.area() - a.intersect(b).area();
+    return a.unite(b).area() - covered;
+}
+
+// Каскадно сливаем прямоугольник idx со всеми "близкими" соседями.
+void DirtyRegion::absorb(uint8_t idx) {
+    bool merged = true;
+
+    while (merged) {
+        merged = false;
+
+        for (uint8_t j = 0; j < _count; j++) {
+            if (j == idx) continue;
+
+            bool take = mergeWaste(_rects[idx], _rects[j]) <= MERGE_SLACK;
+
+            if (!take && _rects[idx].intersects(_rects[j])) {
+                // "Крест" / буква L: union дорогой, но и дважды слать
+                // общую часть не хотим. Сливаем, если общая часть заметна.
+                const int32_t common = _rects[idx].intersect(_rects[j]).area();
+                take = common * 4 >= _rects[j].area()
+                    || common * 4 >= _rects[idx].area();
+            }
+
+            if (!take) continue;
+
+            _rects[idx] = _rects[idx].unite(_rects[j]);
+            removeAt(j);
+            if (j < idx) idx--;
+
+            merged = true;
+            break;
+        }
+    }
+}
+
+void DirtyRegion::removeAt(uint8_t idx) {
+    for (uint8_t i = idx; i + 1 < _count; i++) {
+        _rects[i] = _rects[i + 1];
+    }
+    _count--;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * DirtyRegion
+ * -----------
+ * Набор "грязных" прямоугольников одного кадра.
+ *
+ * Идея:
+ *  - экраны и overlays в update() НЕ рисуют, а только сообщают,
+ *    какие прямоугольники изменились (add)
+ *  - DirtyRegion сливает пересекающиеся / соседние прямоугольники,
+ *    чтобы один и тот же пиксель не отправлялся по SPI несколько раз
+ *  - ScreenManager перерисовывает ТОЛЬКО итоговые регионы (flush)
+ *
+ * ВАЖНО:
+ *  - фиксированная ёмкость, без heap
+ *  - при переполнении ближайшие прямоугольники сливаются принудительно
+ */
+
+struct UiRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+
+    bool empty() const { return w <= 0 || h <= 0; }
+
+    int16_t right()  const { return x + w; }
+    int16_t bottom() const { return y + h; }
+
+    int32_t area() const {
+        return empty() ? 0 : (int32_t)w * (int32_t)h;
+    }
+
+    bool intersects(const UiRect& o) const;
+    bool contains(const UiRect& o) const;
+    UiRect intersect(const UiRect& o) const;
+    UiRect unite(const UiRect& o) const;
+};
+
+class DirtyRegion {
+public:
+    static constexpr uint8_t MAX_RECTS = 8;
+
+    void clear();
+
+    void add(const UiRect& r);
+    void add(int x, int y, int w, int h);
+
+    // Обрезать все прямоугольники по границам (обычно — экран).
+    void clip(const UiRect& bounds);
+
+    bool    empty() const { return _count == 0; }
+    uint8_t count() const { return _count; }
+
+    const UiRect& at(uint8_t i) const { return _rects[i]; }
+
+    // Сумма площадей (регионы после merge не пересекаются "по-крупному",
+    // поэтому это хорошая оценка пикселей на flush).
+    uint32_t area() const;
+
+private:
+    // Сколько "лишних" пикселей допускаем при слиянии двух прямоугольников.
+    static constexpr int32_t MERGE_SLACK = 64;
+
+    static int32_t mergeWaste(const UiRect& a, const UiRect& b);
+
+    void absorb(uint8_t idx);
+    void removeAt(uint8_t idx);
+
+    UiRect  _rects[MAX_RECTS];
+    uint8_t _count = 0;
+};
@@ -1,10 +1,199 @@
 #pragma once
 
 /*
- * Layout constants
- * ----------------
- * Единые размеры UI-зон.
- * Используются экранами и UI-компонентами.
+ * Layout
+ * ------
+ * Геометрия UI, посчитанная при компиляции.
+ *
+ * Зачем:
+ *  - LayoutService раньше складывал высоты из двух флагов в КАЖДОМ
+ *    геттере, а экраны зовут их много раз за кадр
+ *  - экраны держали свои копии чисел (24 статус-бара в SettingsDraw,
+ *    отступ строки DHT в ClockScreen) — теперь всё здесь
+ *
+ * Как устроено:
+ *  - UiLayout — все зоны и отступы одного варианта экрана
+ *  - UI_LAYOUTS[ориентация][статус-бар | нижняя панель << 1] —
+ *    constexpr таблица, строится makeLayout() при компиляции
+ *  - static_assert ниже: зоны лежат в экране и не перекрываются
+ *  - LayoutService только выбирает строку; экран берёт
+ *    const UiLayout& один раз за кадр (LayoutService::current())
  */
 
-static constexpr int STATUS_BAR_H = 24;
\ No newline at end of file
+// ============================================================================
+// Метрики (единые для всего UI)
+// ============================================================================
+static constexpr int STATUS_BAR_H = 24;
+static constexpr int BOTTOM_BAR_H = 26;
+
+static constexpr int HEADER_H          = 20;
+static constexpr int HEADER_TEXT_PAD_Y = 4;
+
+static constexpr int PAD_L = 6;
+static constexpr int PAD_R = 6;
+static constexpr int PAD_T = 4;
+static constexpr int PAD_B = 4;
+
+// Высота строки (menu/list/text)
+static constexpr int LINE_H = 14;
+
+// ClockScreen: строка DHT сверху, под ней HH:MM, под цифрами секунды
+static constexpr int CLOCK_DHT_OFFSET = 4;
+static constexpr int CLOCK_DHT_H      = 16;   // текст size 2
+static constexpr int CLOCK_TIME_PAD_Y = 2;
+static constexpr int CLOCK_SEC_GAP    = 4;
+static constexpr int CLOCK_SEC_H      = 12;
+
+// Нативная матрица ST7735 (BLACKTAB), rotation 0
+static constexpr int PANEL_W = 128;
+static constexpr int PANEL_H = 160;
+
+// ============================================================================
+// UiLayout
+// ============================================================================
+struct UiLayout {
+    int width;
+    int height;
+
+    int statusY;
+    int statusH;
+    int contentY;
+    int contentH;
+    int bottomY;
+    int bottomH;
+
+    // Header внутри content, сверху
+    int headerY;
+    int headerH;
+    int headerTextY;
+
+    int padL;
+    int padR;
+    int padT;
+    int padB;
+
+    int contentLeft;
+    int contentRight;
+    int contentW;
+
+    // Поток контента: после header + padding, до нижней панели - padding
+    int contentTopY;
+    int contentBottomY;
+
+    int lineH;
+
+    // ClockScreen: строка DHT и полоса под HH:MM (секунды — под ней)
+    int clockDhtY;
+    int clockDhtH;
+    int clockDigitsY;
+    int clockDigitsH;
+};
+
+enum UiOrientation : unsigned char {
+    UI_PORTRAIT = 0,    // rotation 0 / 2
+    UI_LANDSCAPE,       // rotation 1 / 3
+    UI_ORIENT_COUNT
+};
+
+static constexpr int UI_BAR_COMBOS = 4;
+
+static constexpr int layoutIndex(bool statusBar, bool bottomBar) {
+    return (statusBar ? 1 : 0) | (bottomBar ? 2 : 0);
+}
+
+// C++11: constexpr-функция — одно выражение, поэтому высоты зон
+// передаются параметрами, а не считаются локальными переменными
+static constexpr UiLayout makeLayoutZones(int w, int h, int sH, int bH) {
+    return UiLayout{
+        w, h,
+
+        0,  sH,
+        sH, h - sH - bH,
+        h - bH, bH,
+
+        sH, HEADER_H, sH + HEADER_TEXT_PAD_Y,
+
+        PAD_L, PAD_R, PAD_T, PAD_B,
+
+        PAD_L, w - PAD_R, w - PAD_R - PAD_L,
+
+        sH + HEADER_H + PAD_T,
+        h - bH - PAD_B,
+
+        LINE_H,
+
+        sH + CLOCK_DHT_OFFSET,
+        CLOCK_DHT_H,
+        sH + CLOCK_DHT_OFFSET + CLOCK_DHT_H + CLOCK_TIME_PAD_Y,
+        (h - sH - bH)
+            - (CLOCK_DHT_OFFSET + CLOCK_DHT_H)
+            - (CLOCK_SEC_GAP + CLOCK_SEC_H)
+            - 2 * CLOCK_TIME_PAD_Y
+    };
+}
+
+static constexpr UiLayout makeLayout(UiOrientation o, bool statusBar, bool bottomBar) {
+    return makeLayoutZones(
+        o == UI_LANDSCAPE ? PANEL_H : PANEL_W,
+        o == UI_LANDSCAPE ? PANEL_W : PANEL_H,
+        statusBar ? STATUS_BAR_H : 0,
+        bottomBar ? BOTTOM_BAR_H : 0
+    );
+}
+
+// ============================================================================
+// Таблица
+// ============================================================================
+static constexpr UiLayout UI_LAYOUTS[UI_ORIENT_COUNT][UI_BAR_COMBOS] = {
+    {
+        makeLayout(UI_PORTRAIT,  false, false),
+        makeLayout(UI_PORTRAIT,  true,  false),
+        makeLayout(UI_PORTRAIT,  false, true),
+        makeLayout(UI_PORTRAIT,  true,  true)
+    },
+    {
+        makeLayout(UI_LANDSCAPE, false, false),
+        makeLayout(UI_LANDSCAPE, true,  false),
+        makeLayout(UI_LANDSCAPE, false, true),
+        makeLayout(UI_LANDSCAPE, true,  true)
+    }
+};
+
+// ============================================================================
+// Проверки при компиляции
+// ============================================================================
+static constexpr bool layoutValid(const UiLayout& l) {
+    return
+        // зоны по вертикали: status → content → bottom, внутри экрана
+        l.statusY >= 0
+     && l.statusY + l.statusH <= l.contentY
+     && l.contentH > 0
+     && l.contentY + l.contentH <= l.bottomY
+     && l.bottomY + l.bottomH <= l.height
+
+        // header и поток контента — внутри content
+     && l.headerY >= l.contentY
+     && l.headerY + l.headerH <= l.contentY + l.contentH
+     && l.contentTopY < l.contentBottomY
+     && l.contentBottomY <= l.bottomY
+
+        // поля по горизонтали
+     && l.contentLeft >= 0
+     && l.contentLeft < l.contentRight
+     && l.contentRight <= l.width
+
+        // часы: DHT → цифры → секунды, не вылезая из content
+     && l.clockDhtY >= l.contentY
+     && l.clockDhtY + l.clockDhtH <= l.clockDigitsY
+     && l.clockDigitsH > 0
+     && l.clockDigitsY + l.clockDigitsH + CLOCK_TIME_PAD_Y
+            + CLOCK_SEC_GAP + CLOCK_SEC_H <= l.contentY + l.contentH;
+}
+
+static constexpr bool layoutsValidFrom(int i) {
+    return i >= UI_ORIENT_COUNT * UI_BAR_COMBOS
+        || (layoutValid(UI_LAYOUTS[i / UI_BAR_COMBOS][i % UI_BAR_COMBOS])
+            && layoutsValidFrom(i + 1));
+}
+
+static_assert(layoutsValidFrom(0), "UI_LAYOUTS: zones overlap or leave the panel");
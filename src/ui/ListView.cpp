@@ -0,0 +1,97 @@
+#include "ui/ListView.h"
+
+// ============================================================================
+// geometry
+// ============================================================================
+void ListView::configure(const UiRect& area, int16_t rowH) {
+
+    _area = area;
+    _rowH = (rowH > 0) ? rowH : 1;
+
+    const int rows = _area.h / _rowH;
+    _visible = (uint8_t)(rows > MAX_VISIBLE ? MAX_VISIBLE : (rows < 0 ? 0 : rows));
+
+    scrollToSelected();
+    markAllDirty();
+}
+
+UiRect ListView::rowRect(int index) const {
+
+    const int i = index - _top;
+    if (i < 0 || i >= _visible)
+        return UiRect{ 0, 0, 0, 0 };
+
+    return UiRect{
+        _area.x,
+        (int16_t)(_area.y + i * _rowH),
+        _area.w,
+        _rowH
+    };
+}
+
+// ============================================================================
+// model
+// ============================================================================
+void ListView::setCount(int count) {
+    _count = (count > 0) ? count : 0;
+    setSelected(_selected);
+}
+
+void ListView::setSelected(int index) {
+
+    if (index >= _count) index = _count - 1;
+    if (index < 0)       index = 0;
+
+    _selected = index;
+    scrollToSelected();
+}
+
+void ListView::scrollToSelected() {
+
+    if (_selected < _top)
+        _top = _selected;
+
+    if (_visible > 0 && _selected >= _top + _visible)
+        _top = _selected - (_visible - 1);
+
+    // список укоротился — не оставляем пустой хвост
+    const int maxTop = (_count > _visible) ? _count - _visible : 0;
+    if (_top > maxTop) _top = maxTop;
+    if (_top < 0)      _top = 0;
+}
+
+// ============================================================================
+// invalidation
+// ============================================================================
+void ListView::markRowDirty(int index) {
+    const int i = index - _top;
+    if (i < 0 || i >= _visible) return;
+    _rowMask |= (uint16_t)(1u << i);
+}
+
+void ListView::markAllDirty() {
+    _allDirty = true;
+}
+
+void ListView::invalidate(DirtyRegion& dirty) {
+
+    // Скролл / число строк — сдвинулось всё, что видно
+    if (_allDirty || _top != _drawnTop || _count != _drawnCount) {
+        dirty.add(_area);
+    } else {
+        if (_selected != _drawnSelected) {
+            dirty.add(rowRect(_drawnSelected));
+            dirty.add(rowRect(_selected));
+        }
+
+        for (uint8_t i = 0; i < _visible; i++) {
+            if (_rowMask & (1u << i)) dirty.add(rowRect(_top + i));
+        }
+    }
+
+    _drawnTop      = _top;
+    _drawnSelected = _selected;
+    _drawnCount    = _count;
+    _allDirty      = false;
+    _rowMask       = 0;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <stdint.h>
+
+#include "ui/DirtyRegion.h"
+#include "ui/UiDisplay.h"
+
+/*
+ * ListView
+ * --------
+ * Виртуальный вертикальный список фиксированной высоты строки.
+ *
+ * Что делает:
+ *  - знает только геометрию, число элементов, выделение и скролл
+ *  - данные НЕ хранит: строку рисует колбэк (index, rect, selected),
+ *    поэтому источник (меню, WifiService::networkAt) ничего не копирует
+ *  - рисует только видимые строки, невидимые в clip пропускает
+ *
+ * КАДР:
+ *  - update-фаза: invalidate(dirty) сравнивает с тем, что нарисовано,
+ *    и добавляет ТОЛЬКО изменившиеся строки:
+ *      * сменилось выделение   → старая + новая строка
+ *      * скролл / число строк  → вся область списка
+ *      * markRowDirty / markAllDirty — по запросу владельца
+ *  - draw-фаза: draw(tft, fn) — фон строк НЕ льётся (это делает экран)
+ *
+ * ПАМЯТЬ:
+ *  - без heap, видимых строк не больше MAX_VISIBLE
+ */
+
+class ListView {
+public:
+    static constexpr uint8_t MAX_VISIBLE = 16;
+
+    // Геометрия: area — где живут строки, rowH — высота строки.
+    // Сбрасывает "нарисованное" (следующий invalidate — вся область).
+    void configure(const UiRect& area, int16_t rowH);
+
+    // Число элементов и выделение (скролл подстраивается сам)
+    void setCount(int count);
+    void setSelected(int index);
+
+    int count()    const { return _count; }
+    int selected() const { return _selected; }
+    int top()      const { return _top; }
+
+    int visibleRows() const { return _visible; }
+
+    UiRect area() const { return _area; }
+    UiRect rowRect(int index) const;      // пустой, если строка не видна
+
+    // Содержимое поменялось без смены выделения
+    void markRowDirty(int index);
+    void markAllDirty();
+
+    // update-фаза
+    void invalidate(DirtyRegion& dirty);
+
+    // draw-фаза: fn(int index, const UiRect& row, bool selected)
+    template <typename RowFn>
+    void draw(UiDisplay& tft, RowFn fn) const {
+        const int end = (_top + _visible < _count) ? _top + _visible : _count;
+
+        for (int i = _top; i < end; i++) {
+            const UiRect r = rowRect(i);
+            if (!tft.clipIntersects(r.x, r.y, r.w, r.h)) continue;
+            fn(i, r, i == _selected);
+        }
+    }
+
+private:
+    void scrollToSelected();
+
+private:
+    UiRect  _area{ 0, 0, 0, 0 };
+    int16_t _rowH    = 1;
+    uint8_t _visible = 0;
+
+    int _count    = 0;
+    int _selected = 0;
+    int _top      = 0;
+
+    // Что нарисовано (или уже помечено грязным)
+    int      _drawnTop      = -1;
+    int      _drawnSelected = -1;
+    int      _drawnCount    = -1;
+    bool     _allDirty      = true;
+    uint16_t _rowMask       = 0;      // бит i — видимая строка i
+};
@@ -0,0 +1,95 @@
+#include "ui/ScreenTransition.h"
+
+#include <Arduino.h>
+
+#include "ui/ColorUtil.h"
+
+// ============================================================================
+// reserve / release — снимок только на время перехода
+// ============================================================================
+bool ScreenTransition::reserve(const UiRect& area) {
+
+    const uint32_t bytes = (uint32_t)area.area() * sizeof(uint16_t);
+
+    if (bytes == 0 || bytes > BUDGET_BYTES) return false;
+
+    release();
+
+    // Снимок не должен отнять у TLS последний крупный блок
+    if (ESP.getMaxAllocHeap() < bytes + TLS_RESERVE_BYTES) {
+        _skipped++;
+        return false;
+    }
+
+    _snap = static_cast<uint16_t*>(malloc(bytes));
+    if (!_snap) {
+        _skipped++;
+        return false;
+    }
+    return true;
+}
+
+void ScreenTransition::release() {
+    free(_snap);
+    _snap = nullptr;
+}
+
+void ScreenTransition::start(const UiRect& area) {
+    _area   = area;
+    _step   = 1;
+    _active = true;
+}
+
+void ScreenTransition::cancel() {
+    _active = false;
+    release();
+}
+
+// ============================================================================
+// blend
+// ============================================================================
+void ScreenTransition::blendBand(const UiRect& band, uint16_t* px) const {
+
+    if (!_active) return;
+
+    const UiRect r = band.intersect(_area);
+    if (r.empty()) return;
+
+    // Доля нового кадра на этом шаге (последний шаг — уже почти он)
+    const uint8_t a = (uint8_t)((uint16_t)_step * 255u / (STEPS + 1));
+
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+
+        const uint16_t* old = _snap
+                            + (int32_t)(y - _area.y) * _area.w
+                            + (r.x - _area.x);
+        uint16_t*       cur = px
+                            + (int32_t)(y - band.y) * band.w
+                            + (r.x - band.x);
+
+        for (int16_t i = 0; i < r.w; i++) {
+            cur[i] = blend565(old[i], cur[i], a);
+        }
+    }
+}
+
+// ============================================================================
+// advance
+// ============================================================================
+void ScreenTransition::advance(uint32_t frameUs) {
+
+    if (!_active) return;
+
+    if (frameUs > FRAME_CAP_US) {
+        _active = false;
+        _aborted++;
+        release();
+        return;
+    }
+
+    if (++_step > STEPS) {
+        _active = false;
+        _completed++;
+        release();
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <stdint.h>
+
+#include "ui/DirtyRegion.h"
+
+/*
+ * ScreenTransition
+ * ----------------
+ * Crossfade контента при смене экрана (ScreenManager::set).
+ *
+ * Как устроено:
+ *  - перед сменой старый контент рисуется offscreen в снимок (RGB565)
+ *  - STEPS кадров подряд новый контент растеризуется полосами
+ *    (BandRenderer) и перед отправкой смешивается со снимком:
+ *    blend565 (SWAR, alpha 0..255 → 0..32), без float
+ *  - StatusBar / ButtonBar не фейдятся — они общие для всех экранов
+ *
+ * ОГРАНИЧЕНИЯ:
+ *  - RAM: снимок не больше BUDGET_BYTES и живёт только пока идёт
+ *    переход — конец, обрыв или отмена освобождают его сразу
+ *  - heap: после снимка в куче должен остаться непрерывный блок
+ *    TLS_RESERVE_BYTES (рукопожатие ForecastService); иначе, как и
+ *    при ошибке malloc, — мгновенная смена без crossfade
+ *  - время: кадр перехода дольше FRAME_CAP_US → переход обрывается,
+ *    следующий кадр уже обычный (кнопки не ждут анимацию)
+ *  - новый set() во время перехода — мгновенная смена
+ */
+
+class ScreenTransition {
+public:
+    static constexpr uint8_t  STEPS         = 6;
+    static constexpr uint32_t BUDGET_BYTES  = 26 * 1024;   // 160x80 RGB565
+    static constexpr uint32_t FRAME_CAP_US  = 30000;
+
+    // Непрерывный блок, который снимок обязан оставить свободным:
+    // буферы mbedTLS (2 x 16 КБ) + сертификат и контекст рукопожатия
+    static constexpr uint32_t TLS_RESERVE_BYTES = 48 * 1024;
+
+    // Буфер снимка под area. false — не влезает в бюджет, съел бы
+    // резерв TLS или нет heap.
+    bool reserve(const UiRect& area);
+
+    uint16_t* snapshot() { return _snap; }
+
+    // Снимок готов — следующий кадр начинает переход
+    void start(const UiRect& area);
+    void cancel();
+
+    bool active() const { return _active; }
+    const UiRect& area() const { return _area; }
+
+    // Смешать полосу нового кадра со снимком (на месте)
+    void blendBand(const UiRect& band, uint16_t* px) const;
+
+    // Кадр перехода отправлен: шаг вперёд, проверка лимита времени
+    void advance(uint32_t frameUs);
+
+    // ===== STATS =====
+    uint32_t completed() const { return _completed; }
+    uint32_t aborted()   const { return _aborted; }
+    uint32_t skipped()   const { return _skipped; }   // нет блока под снимок
+
+private:
+    void release();
+
+private:
+    uint16_t* _snap = nullptr;
+
+    UiRect  _area{ 0, 0, 0, 0 };
+    bool    _active = false;
+    uint8_t _step   = 0;         // 1..STEPS — кадр, который рисуется
+
+    uint32_t _completed = 0;
+    uint32_t _aborted   = 0;
+    uint32_t _skipped   = 0;
+};
@@ -10,7 +10,7 @@
 // ============================================================================
 
 StatusBar::StatusBar(
-    Adafruit_ST7735& tft,
+    UiDisplay& tft,
     ThemeService& theme,
     TimeService& time,
     WifiService& wifi
@@ -27,60 +27,104 @@ StatusBar::StatusBar(
 // ============================================================================
 
 void StatusBar::markDirty() {
-    _dirty = true;
+    _dirtyMask = (1 << SEG_COUNT) - 1;
 }
 
-void StatusBar::update() {
+void StatusBar::update(DirtyRegion& dirty) {
 
-    Status newWifi = mapWifiStatus();
-    Status newTime = mapTimeStatus();
-
-    if (newWifi != _wifiSt || newTime != _timeSt) {
+    // ------------------------------------------------------------------------
+    // WIFI
+    // ------------------------------------------------------------------------
+    const Status newWifi = mapWifiStatus();
+    if (newWifi != _wifiSt) {
         _wifiSt = newWifi;
-        _timeSt = newTime;
-        _dirty  = true;
+        _dirtyMask |= 1 << SEG_WIFI;
     }
 
-    if (_dirty) {
-        _dirty = false;
+    // ------------------------------------------------------------------------
+    // TIME SOURCE
+    // ------------------------------------------------------------------------
+    const uint8_t tk = timeKey();
+    if (tk != _timeKey) {
+        _timeKey = tk;
+        _timeSt  = mapTimeStatus();
+        _dirtyMask |= 1 << SEG_TIME;
+    }
 
-        // ❗ ТОЛЬКО стабильный ThemeBlend
-        const ThemeBlend& th = _theme.blend();
-        drawStatic(th);
+    // ------------------------------------------------------------------------
+    // DATE — раз в сутки (или когда время стало/перестало быть валидным)
+    // ------------------------------------------------------------------------
+    const int32_t dk = dayKey();
+    if (dk != _dayKey) {
+        _dayKey = dk;
+        formatDate();
+        _dirtyMask |= 1 << SEG_DATE;
     }
-}
 
-// ============================================================================
-// drawing
-// ============================================================================
+    if (!_dirtyMask) return;
 
-void StatusBar::drawStatic(const ThemeBlend& th) {
+    for (uint8_t i = 0; i < SEG_COUNT; i++) {
+        if (_dirtyMask & (1 << i)) dirty.add(segmentRect(i));
+    }
+    _dirtyMask = 0;
+}
 
-    // ------------------------------------------------------------------------
-    // BACKGROUND
-    // ------------------------------------------------------------------------
-    _tft.fillRect(0, 0, _tft.width(), HEIGHT, th.bg);
+void StatusBar::draw() {
+    // ❗ ТОЛЬКО стабильный ThemeBlend
+    const ThemeBlend& th = _theme.blend();
 
     _tft.setFont(nullptr);
     _tft.setTextSize(1);
     _tft.setTextWrap(false);
 
-    // ------------------------------------------------------------------------
-    // STATUS DOTS
-    // ------------------------------------------------------------------------
-    drawDot(4, 8,  statusDotColor(_wifiSt, th));
-    drawDot(4, 18, statusDotColor(_timeSt, th));
+    // Сегмент вне clip не трогаем вовсе (ни фон, ни текст)
+    for (uint8_t i = 0; i < SEG_COUNT; i++) {
+        const UiRect r = segmentRect(i);
+        if (!_tft.clipIntersects(r.x, r.y, r.w, r.h)) continue;
+
+        _tft.fillRect(r.x, r.y, r.w, r.h, th.bg);
+
+        switch (i) {
+            case SEG_WIFI: drawWifi(th); break;
+            case SEG_TIME: drawTime(th); break;
+            case SEG_DATE: drawDate(th); break;
+            default: break;
+        }
+    }
+}
+
+// ============================================================================
+// segments
+// ============================================================================
+
+UiRect StatusBar::segmentRect(uint8_t seg) const {
+    const int16_t half = HEIGHT / 2;
+
+    switch (seg) {
+        case SEG_WIFI: return UiRect{ 0, 0,    LEFT_W, half };
+        case SEG_TIME: return UiRect{ 0, half, LEFT_W, (int16_t)(HEIGHT - half) };
+        case SEG_DATE:
+        default:
+            return UiRect{
+                LEFT_W, 0,
+                (int16_t)(_tft.width() - LEFT_W),
+                (int16_t)HEIGHT
+            };
+    }
+}
+
+void StatusBar::drawWifi(const ThemeBlend& th) {
+    drawDot(4, 8, statusDotColor(_wifiSt, th));
 
-    // ------------------------------------------------------------------------
-    // WIFI LABEL
-    // ------------------------------------------------------------------------
     _tft.setTextColor(th.muted, th.bg);
     _tft.setCursor(10, 4);
     _tft.print("WiFi");
+}
+
+// RTC / NTP / NTP… / ERR
+void StatusBar::drawTime(const ThemeBlend& th) {
+    drawDot(4, 18, statusDotColor(_timeSt, th));
 
-    // ------------------------------------------------------------------------
-    // TIME SOURCE (RTC / NTP / NTP… / ERR)
-    // ------------------------------------------------------------------------
     char src[6] = {0};
 
     if (_time.syncState() == TimeService::ERROR) {
@@ -101,39 +145,53 @@ void StatusBar::drawStatic(const ThemeBlend& th) {
     _tft.setTextColor(srcColor, th.bg);
     _tft.setCursor(10, 14);
     _tft.print(src);
+}
 
-    // ------------------------------------------------------------------------
-    // DATE / WEEKDAY (РИСУЕТСЯ ТОЛЬКО ТУТ)
-    // ------------------------------------------------------------------------
-    if (_time.isValid()) {
-
-        tm t{};
-        if (_time.getTm(t)) {
-
-            mktime(&t);
-
-            char buf[32];
-            snprintf(
-                buf,
-                sizeof(buf),
-                "%s  %02d.%02d.%04d",
-                weekdayEnFromTm(t),
-                t.tm_mday,
-                t.tm_mon + 1,
-                t.tm_year + 1900
-            );
-
-            _tft.setTextColor(th.muted, th.bg);
-            _tft.setCursor(42, 4);
-            _tft.print(buf);
-        }
-    }
+void StatusBar::drawDate(const ThemeBlend& th) {
+    if (!_dateStr[0]) return;
+
+    _tft.setTextColor(th.muted, th.bg);
+    _tft.setCursor(42, 4);
+    _tft.print(_dateStr);
 }
 
 // ============================================================================
 // helpers
 // ============================================================================
 
+uint8_t StatusBar::timeKey() const {
+    return (uint8_t)(
+        ((uint8_t)_time.syncState())
+      | ((uint8_t)_time.source() << 2)
+      | (_time.isValid() ? 0x10 : 0)
+    );
+}
+
+int32_t StatusBar::dayKey() const {
+    if (!_time.isValid()) return -1;
+    return (int32_t)_time.year() * 512 + _time.month() * 32 + _time.day();
+}
+
+// Единственное место с mktime/snprintf для даты — раз в сутки
+void StatusBar::formatDate() {
+    _dateStr[0] = '\0';
+
+    tm t{};
+    if (_dayKey < 0 || !_time.getTm(t)) return;
+
+    mktime(&t);
+
+    snprintf(
+        _dateStr,
+        sizeof(_dateStr),
+        "%s  %02d.%02d.%04d",
+        weekdayEnFromTm(t),
+        t.tm_mday,
+        t.tm_mon + 1,
+        t.tm_year + 1900
+    );
+}
+
 StatusBar::Status StatusBar::mapWifiStatus() const {
     if (!_wifi.isEnabled())
         return OFFLINE;
@@ -176,4 +234,4 @@ const char* StatusBar::weekdayEnFromTm(const tm& t) const {
         "Sunday","Monday","Tuesday","Wednesday","Thursday","Friday","Saturday"
     };
     return (t.tm_wday >= 0 && t.tm_wday <= 6) ? NAMES[t.tm_wday] : "";
-}
\ No newline at end of file
+}
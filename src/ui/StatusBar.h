@@ -1,10 +1,11 @@
 #pragma once
-#include <Adafruit_ST7735.h>
-
 #include "services/ThemeService.h"
 #include "services/ThemeBlend.h"
 #include "services/TimeService.h"
 #include "services/WifiService.h"
+#include "ui/DirtyRegion.h"
+#include "ui/Layout.h"
+#include "ui/UiDisplay.h"
 
 /*
  * StatusBar
@@ -15,11 +16,24 @@
  *  - StatusBar работает ТОЛЬКО с ThemeBlend
  *  - NightTransition → коэффициент
  *  - ColorTemperature → пост-фильтр
+ *
+ * СЕГМЕНТЫ:
+ *  - WIFI — точка + "WiFi"               (левый столбец, верх)
+ *  - TIME — точка + источник RTC/NTP/ERR  (левый столбец, низ)
+ *  - DATE — день недели и дата            (всё справа)
+ *  - каждый сегмент помнит, что нарисовано, и в кадр отдаёт
+ *    ТОЛЬКО свой прямоугольник: мигание Wi-Fi/NTP не трогает дату
+ *  - строка даты форматируется раз в сутки (при смене дня),
+ *    а не на каждой перерисовке
+ *
+ * КАДР:
+ *  - update(dirty) — следит за статусами, помечает изменившиеся сегменты
+ *  - draw()        — рисует сегменты, попавшие в clip (каждый льёт свой фон)
  */
 
 class StatusBar {
 public:
-    static constexpr int HEIGHT = 24;
+    static constexpr int HEIGHT = STATUS_BAR_H;   // ui/Layout.h
 
     enum Status {
         OFFLINE,
@@ -29,35 +43,58 @@ public:
     };
 
     StatusBar(
-        Adafruit_ST7735& tft,
+        UiDisplay& tft,
         ThemeService& theme,
         TimeService& time,
         WifiService& wifi
     );
 
-    void update();
+    void update(DirtyRegion& dirty);
+    void draw();
     void markDirty();
-    //void drawTimeOnly();
 
 private:
-    void drawStatic(const ThemeBlend& th);
+    enum Segment : uint8_t {
+        SEG_WIFI = 0,
+        SEG_TIME,
+        SEG_DATE,
+        SEG_COUNT
+    };
+
+    // Ширина левого столбца (точки + подписи)
+    static constexpr int16_t LEFT_W = 40;
+
+    UiRect segmentRect(uint8_t seg) const;
+
+    void drawWifi(const ThemeBlend& th);
+    void drawTime(const ThemeBlend& th);
+    void drawDate(const ThemeBlend& th);
     void drawDot(int cx, int cy, uint16_t color);
 
     Status mapWifiStatus() const;
     Status mapTimeStatus() const;
+    uint8_t timeKey() const;
+    int32_t dayKey() const;
+    void formatDate();
+
     uint16_t statusDotColor(Status s, const ThemeBlend& th) const;
     const char* weekdayEnFromTm(const tm& t) const;
 
 private:
-    Adafruit_ST7735&         _tft;
+    UiDisplay&               _tft;
     ThemeService&            _theme;
     TimeService&             _time;
     WifiService&             _wifi;
 
     Status _wifiSt = OFFLINE;
     Status _timeSt = OFFLINE;
-private:
-    bool _timeDirty = true;
-    char _lastTimeStr[32] = {0};
-    bool _dirty = true;
-};
\ No newline at end of file
+
+    // syncState / source / valid — всё, от чего зависит сегмент TIME
+    uint8_t _timeKey = 0xFF;
+
+    // Дата: ключ дня (-1 — времени нет) и готовая строка
+    int32_t _dayKey = -2;
+    char    _dateStr[32] = {0};
+
+    uint8_t _dirtyMask = (1 << SEG_COUNT) - 1;
+};
@@ -0,0 +1,67 @@
+#include "ui/TextRenderer.h"
+
+#include <Adafruit_GFX.h>
+
+// ============================================================================
+// begin — снимаем маски тем же шрифтом, что и print()
+// ============================================================================
+void TextRenderer::begin() {
+
+    if (_ready) return;
+
+    GFXcanvas1 canvas(CELL_W, CELL_H);
+
+    for (uint16_t c = 0; c < 256; c++) {
+
+        canvas.fillScreen(0);
+        canvas.drawChar(0, 0, (unsigned char)c, 1, 0, 1);
+
+        for (int16_t y = 0; y < CELL_H; y++) {
+            uint8_t row = 0;
+            for (int16_t x = 0; x < CELL_W; x++) {
+                if (canvas.getPixel(x, y)) row |= (uint8_t)(1u << x);
+            }
+            _mask[c][y] = row;
+        }
+    }
+
+    _ready = true;
+}
+
+// ============================================================================
+// render — строка масок → RGB565
+// ============================================================================
+void TextRenderer::render(
+    const uint8_t* s,
+    uint16_t       n,
+    uint8_t        sx,
+    uint8_t        sy,
+    uint16_t       fg,
+    uint16_t       bg,
+    uint16_t*      out
+) const {
+
+    const uint32_t w = (uint32_t)n * CELL_W * sx;
+
+    for (uint8_t y = 0; y < CELL_H; y++) {
+
+        // одна строка пикселей через все символы
+        uint16_t* line = out;
+        for (uint16_t i = 0; i < n; i++) {
+            const uint8_t row = _mask[s[i]][y];
+            for (uint8_t x = 0; x < CELL_W; x++) {
+                const uint16_t c = (row & (1u << x)) ? fg : bg;
+                for (uint8_t k = 0; k < sx; k++) *line++ = c;
+            }
+        }
+
+        // остальные sy-1 строк — копии
+        for (uint8_t k = 1; k < sy; k++) {
+            for (uint32_t x = 0; x < w; x++) {
+                out[k * w + x] = out[x];
+            }
+        }
+
+        out += sy * w;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * TextRenderer
+ * ------------
+ * Растеризация строки классического шрифта GFX (5x7 в ячейке 6x8)
+ * в RGB565 буфер целиком — "спан" текста.
+ *
+ * Зачем:
+ *  - Adafruit_GFX рисует непрозрачный глиф по пикселю (40+ writePixel
+ *    и отдельная линия фона на символ)
+ *  - строка, собранная в буфер, уходит ОДНИМ окном адреса (UiDisplay::blit)
+ *
+ * Метрики:
+ *  - маски снимаются тем же шрифтом GFX (drawChar на GFXcanvas1),
+ *    ячейка 6*size x 8*size — layout не сдвигается ни на пиксель
+ *
+ * ПАМЯТЬ:
+ *  - маски 256 x 8 байт, без heap (canvas нужен только в begin)
+ */
+
+class TextRenderer {
+public:
+    static constexpr uint8_t CELL_W = 6;
+    static constexpr uint8_t CELL_H = 8;
+
+    void begin();
+    bool ready() const { return _ready; }
+
+    // Пикселей в одном символе при масштабе sx x sy
+    static uint32_t cellPixels(uint8_t sx, uint8_t sy) {
+        return (uint32_t)CELL_W * sx * CELL_H * sy;
+    }
+
+    // n символов → out (строки подряд, ширина n * CELL_W * sx).
+    // Символ c рисуется как drawChar(c) при cp437(false).
+    void render(
+        const uint8_t* s,
+        uint16_t       n,
+        uint8_t        sx,
+        uint8_t        sy,
+        uint16_t       fg,
+        uint16_t       bg,
+        uint16_t*      out
+    ) const;
+
+private:
+    // Маска: строка ячейки → биты столбцов (bit 0 = x 0)
+    uint8_t _mask[256][CELL_H] = {};
+    bool    _ready = false;
+};
@@ -1,41 +1,164 @@
 #include "ui/UiDebugOverlay.h"
 #include <Arduino.h>
+#include <string.h>
 
-bool UiDebugOverlay::_enabled = false;
+// ============================================================================
+// ctor
+// ============================================================================
+UiDebugOverlay::UiDebugOverlay(UiDisplay& tft, ForecastService& forecast)
+    : _tft(tft)
+    , _forecast(forecast)
+{
+}
 
 void UiDebugOverlay::setEnabled(bool e) {
+    if (e == _enabled) return;
+
     _enabled = e;
+
+    // Свежее окно: старые накопления не смешиваем с новым показом
+    if (_enabled) resetWindow(millis());
 }
 
-bool UiDebugOverlay::isEnabled() {
-    return _enabled;
+// ============================================================================
+// сбор
+// ============================================================================
+void UiDebugOverlay::onFrame(uint32_t frameUs, uint32_t pixels) {
+    if (!_enabled) return;
+
+    _frames++;
+    _frameUsSum += frameUs;
+    _pixelsSum  += pixels;
+
+    uint32_t b = frameUs / HIST_STEP_US;
+    if (b >= HIST_BUCKETS) b = HIST_BUCKETS - 1;
+    if (_hist[b] < 0xFFFF) _hist[b]++;
+}
+
+void UiDebugOverlay::onInput(uint32_t latencyUs, const char* label) {
+    if (!_enabled) return;
+
+    _inputUs = latencyUs;
+    strncpy(_inputLabel, label, sizeof(_inputLabel) - 1);
+    _inputLabel[sizeof(_inputLabel) - 1] = 0;
+
+    if (latencyUs > _inputMaxUs) _inputMaxUs = latencyUs;
 }
 
-void UiDebugOverlay::draw(Adafruit_ST7735& tft) {
+void UiDebugOverlay::onInputHist(char screen, const uint16_t hist[InputLatency::BUCKETS],
+                                 uint32_t noReaction) {
+    if (!_enabled) return;
+
+    _histScreen = screen;
+    for (uint8_t b = 0; b < InputLatency::BUCKETS; b++) {
+        const uint16_t n = hist[b];
+        _histRow[b] = n == 0 ? '.' : n > 9 ? '+' : (char)('0' + n);
+    }
+    _histRow[InputLatency::BUCKETS] = 0;
+    _noReaction = noReaction;
+}
+
+void UiDebugOverlay::resetWindow(uint32_t nowMs) {
+    _windowStartMs = nowMs;
+    _loops      = 0;
+    _frames     = 0;
+    _frameUsSum = 0;
+    _pixelsSum  = 0;
+    _inputMaxUs = 0;
+    memset(_hist, 0, sizeof(_hist));
+}
+
+// Верхняя граница корзины, в которую попал 99-й перцентиль
+uint32_t UiDebugOverlay::p99Us() const {
+    if (_frames == 0) return 0;
+
+    const uint32_t target = _frames - _frames / 100;
+
+    uint32_t acc = 0;
+    for (uint8_t i = 0; i < HIST_BUCKETS; i++) {
+        acc += _hist[i];
+        if (acc >= target) return (uint32_t)(i + 1) * HIST_STEP_US;
+    }
+    return (uint32_t)HIST_BUCKETS * HIST_STEP_US;
+}
+
+// ============================================================================
+// refresh — снимок раз в REFRESH_MS
+// ============================================================================
+bool UiDebugOverlay::refresh(uint32_t nowMs) {
+    if (!_enabled) return false;
+
+    const uint32_t elapsed = nowMs - _windowStartMs;
+    if (elapsed < REFRESH_MS) return false;
+
+    _loopsPerSec = (uint32_t)((uint64_t)_loops * 1000u / elapsed);
+    _frameUs     = _frames ? (uint32_t)(_frameUsSum / _frames) : 0;
+    _frameP99Us  = p99Us();
+    _pxPerFrame  = _frames ? (uint32_t)(_pixelsSum / _frames) : 0;
+
+    _freeHeap = ESP.getFreeHeap();
+    _minHeap  = ESP.getMinFreeHeap();
+    _stackHwm = _forecast.taskStackHighWater();
+
+    _inputWorstUs = _inputMaxUs;
+
+    resetWindow(nowMs);
+    return true;
+}
+
+// ============================================================================
+// draw
+// ============================================================================
+void UiDebugOverlay::draw() {
     if (!_enabled)
         return;
 
-    // небольшая подложка в левом верхнем углу
-    constexpr int W = 128;
-    constexpr int H = 48;
+    _tft.fillRect(0, 0, W, H, ST7735_BLACK);
 
-    tft.fillRect(0, 0, W, H, ST7735_BLACK);
-
-    tft.setFont(nullptr);
-    tft.setTextSize(1);
-    tft.setTextWrap(false);
-    tft.setTextColor(ST7735_GREEN, ST7735_BLACK);
+    _tft.setFont(nullptr);
+    _tft.setTextSize(1);
+    _tft.setTextWrap(false);
+    _tft.setTextColor(ST7735_GREEN, ST7735_BLACK);
 
     int y = 4;
 
-    tft.setCursor(4, y);
-    tft.print("DEBUG");
+    _tft.setCursor(4, y);
+    _tft.printf("it/s %-5u fr %2u.%ums",
+                (unsigned)_loopsPerSec,
+                (unsigned)(_frameUs / 1000),
+                (unsigned)(_frameUs % 1000 / 100));
+    y += 10;
+
+    _tft.setCursor(4, y);
+    _tft.printf("p99 <%2ums px %u",
+                (unsigned)(_frameP99Us / 1000),
+                (unsigned)_pxPerFrame);
+    y += 10;
+
+    // RGB565 — 2 байта на пиксель
+    _tft.setCursor(4, y);
+    _tft.printf("B/fr %-5u stk %u",
+                (unsigned)(_pxPerFrame * 2),
+                (unsigned)_stackHwm);
+    y += 10;
+
+    _tft.setCursor(4, y);
+    _tft.printf("heap %uk min %uk",
+                (unsigned)(_freeHeap / 1024),
+                (unsigned)(_minHeap / 1024));
     y += 10;
 
-    tft.setCursor(4, y);
-    tft.printf("Heap: %u", ESP.getFreeHeap());
+    _tft.setCursor(4, y);
+    _tft.printf("in %-5s %3ums max %u",
+                _inputLabel,
+                (unsigned)(_inputUs / 1000),
+                (unsigned)(_inputWorstUs / 1000));
     y += 10;
 
-    tft.setCursor(4, y);
-    tft.printf("Uptime: %lus", millis() / 1000);
-}
\ No newline at end of file
+    // Корзины <4 .. >=1024 мс текущего экрана
+    _tft.setCursor(4, y);
+    _tft.printf("%c %s nr %u",
+                _histScreen,
+                _histRow[0] ? _histRow : "-",
+                (unsigned)_noReaction);
+}
@@ -1,19 +1,101 @@
 #pragma once
-#include <Adafruit_ST7735.h>
+#include <stdint.h>
+
+#include "core/InputLatency.h"
+#include "ui/DirtyRegion.h"
+#include "ui/UiDisplay.h"
+#include "services/ForecastService.h"
 
 /*
  * UiDebugOverlay
  * --------------
- * Полупрозрачный debug-overlay поверх UI.
- * Рисуется ПОСЛЕДНИМ.
+ * Performance HUD поверх UI.
+ * Рисуется ПОСЛЕДНИМ (ScreenManager::update, после кадра).
+ *
+ * Показывает:
+ *  - итераций loop() в секунду
+ *  - время кадра: среднее и p99 за окно
+ *  - пикселей / байт в дисплей за кадр
+ *  - свободный heap и минимум за всё время
+ *  - минимум свободного стека ForecastTask
+ *  - задержку ввода: последнее действие ("F:R.s" — экран, кнопка,
+ *    тип) и худшую за окно (InputLatency)
+ *  - гистограмму задержки текущего экрана: символ на корзину
+ *    <4 .. <1024, >=1024 мс ('.' пусто, 1..9, '+' — больше 9) и
+ *    счётчик событий без реакции
+ *
+ * ЧТОБЫ НЕ ИСКАЖАТЬ ЗАМЕР:
+ *  - значения пересчитываются и перерисовываются раз в REFRESH_MS
+ *  - отрисовка HUD не входит ни во время кадра, ни в его пиксели
+ *  - между обновлениями HUD перерисовывается, только если кадр
+ *    затёр его область
+ *
+ * Включение: аккорд LEFT+RIGHT (AppController → ScreenManager).
  */
 class UiDebugOverlay {
 public:
-    static void setEnabled(bool e);
-    static bool isEnabled();
+    static constexpr uint32_t REFRESH_MS = 1000;
+
+    UiDebugOverlay(UiDisplay& tft, ForecastService& forecast);
+
+    void setEnabled(bool e);
+    bool isEnabled() const { return _enabled; }
+    void toggle() { setEnabled(!_enabled); }
+
+    // ===== сбор (дёшево, без отрисовки) =====
+    void onLoop() { _loops++; }
+    void onFrame(uint32_t frameUs, uint32_t pixels);
+    void onInput(uint32_t latencyUs, const char* label);
+    void onInputHist(char screen, const uint16_t hist[InputLatency::BUCKETS],
+                     uint32_t noReaction);
 
-    static void draw(Adafruit_ST7735& tft);
+    // true — значения обновлены, HUD надо перерисовать
+    bool refresh(uint32_t nowMs);
+
+    UiRect rect() const { return UiRect{ 0, 0, W, H }; }
+
+    void draw();
 
 private:
-    static bool _enabled;
-};
\ No newline at end of file
+    // Гистограмма времени кадра: корзины по 1 мс, последняя — "и дольше"
+    static constexpr uint8_t  HIST_BUCKETS = 32;
+    static constexpr uint32_t HIST_STEP_US = 1000;
+
+    static constexpr int16_t W = 136;
+    static constexpr int16_t H = 64;
+
+    void resetWindow(uint32_t nowMs);
+    uint32_t p99Us() const;
+
+private:
+    UiDisplay&       _tft;
+    ForecastService& _forecast;
+
+    bool _enabled = false;
+
+    // ---- окно измерения ----
+    uint32_t _windowStartMs = 0;
+    uint32_t _loops         = 0;
+    uint32_t _frames        = 0;
+    uint64_t _frameUsSum    = 0;
+    uint64_t _pixelsSum     = 0;
+    uint16_t _hist[HIST_BUCKETS] = {};
+    uint32_t _inputMaxUs    = 0;
+
+    // ---- показываемый снимок ----
+    uint32_t _loopsPerSec = 0;
+    uint32_t _frameUs     = 0;
+    uint32_t _frameP99Us  = 0;
+    uint32_t _pxPerFrame  = 0;
+    uint32_t _freeHeap    = 0;
+    uint32_t _minHeap     = 0;
+    uint32_t _stackHwm    = 0;
+
+    uint32_t _inputUs      = 0;
+    uint32_t _inputWorstUs = 0;
+    char     _inputLabel[8] = "-";
+
+    char     _histScreen = '-';
+    char     _histRow[InputLatency::BUCKETS + 1] = {};
+    uint32_t _noReaction = 0;
+};
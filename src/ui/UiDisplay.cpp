@@ -0,0 +1,536 @@
+#include "ui/UiDisplay.h"
+
+#include <string.h>
+
+#include "ui/ColorUtil.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#endif
+
+// ============================================================================
+// ctor
+// ============================================================================
+UiDisplay::UiDisplay(int8_t cs, int8_t dc, int8_t rst)
+    : Adafruit_ST7735(cs, dc, rst)
+    , _dcPin(dc)
+{
+}
+
+// ============================================================================
+// clip
+// ============================================================================
+void UiDisplay::setClip(const UiRect& r) {
+    _clip   = r;
+    _clipOn = true;
+}
+
+void UiDisplay::resetClip() {
+    _clipOn = false;
+}
+
+bool UiDisplay::clipIntersects(int16_t x, int16_t y, int16_t w, int16_t h) const {
+    const UiRect r{ x, y, w, h };
+    if (_bandBuf && !_band.intersects(r)) return false;
+    if (!_clipOn) return true;
+    return _clip.intersects(r);
+}
+
+bool UiDisplay::clipPoint(int16_t x, int16_t y) const {
+    if (x < 0 || y < 0 || x >= width() || y >= height()) return false;
+    if (_bandBuf &&
+        (x < _band.x || x >= _band.right() ||
+         y < _band.y || y >= _band.bottom())) return false;
+    if (!_clipOn) return true;
+    return x >= _clip.x && x < _clip.right()
+        && y >= _clip.y && y < _clip.bottom();
+}
+
+bool UiDisplay::clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+    if (w < 0) { x += w + 1; w = -w; }
+    if (h < 0) { y += h + 1; h = -h; }
+
+    UiRect r{ x, y, w, h };
+    r = r.intersect(UiRect{ 0, 0, width(), height() });
+    if (_clipOn)  r = r.intersect(_clip);
+    if (_bandBuf) r = r.intersect(_band);
+
+    if (r.empty()) return false;
+
+    x = r.x;
+    y = r.y;
+    w = r.w;
+    h = r.h;
+    return true;
+}
+
+// ============================================================================
+// GFX primitives
+// ============================================================================
+void UiDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!clipPoint(x, y)) return;
+    if (_bandBuf) { bandFill(x, y, 1, 1, color); return; }
+    account(1);
+    Adafruit_ST7735::drawPixel(x, y, color);
+}
+
+void UiDisplay::writePixel(int16_t x, int16_t y, uint16_t color) {
+    if (!clipPoint(x, y)) return;
+    if (_bandBuf) { bandFill(x, y, 1, 1, color); return; }
+    account(1);
+    Adafruit_ST7735::writePixel(x, y, color);
+}
+
+void UiDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)w * (uint32_t)h);
+    Adafruit_ST7735::fillRect(x, y, w, h, color);
+}
+
+void UiDisplay::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)w * (uint32_t)h);
+    Adafruit_ST7735::writeFillRect(x, y, w, h, color);
+}
+
+void UiDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    int16_t h = 1;
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)w);
+    Adafruit_ST7735::drawFastHLine(x, y, w, color);
+}
+
+void UiDisplay::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    int16_t h = 1;
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)w);
+    Adafruit_ST7735::writeFastHLine(x, y, w, color);
+}
+
+void UiDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    int16_t w = 1;
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)h);
+    Adafruit_ST7735::drawFastVLine(x, y, h, color);
+}
+
+void UiDisplay::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    int16_t w = 1;
+    if (!clipRect(x, y, w, h)) return;
+    if (_bandBuf) { bandFill(x, y, w, h, color); return; }
+    account((uint32_t)h);
+    Adafruit_ST7735::writeFastVLine(x, y, h, color);
+}
+
+void UiDisplay::startWrite() {
+    // Проход полосами уже держит транзакцию
+    if (_writeHeld) return;
+    _traffic[(uint8_t)_tag].transactions++;
+    Adafruit_ST7735::startWrite();
+}
+
+void UiDisplay::endWrite() {
+    if (_writeHeld) return;
+    Adafruit_ST7735::endWrite();
+}
+
+void UiDisplay::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    _traffic[(uint8_t)_tag].windows++;
+    Adafruit_ST7735::setAddrWindow(x, y, w, h);
+}
+
+// ============================================================================
+// blit
+// ============================================================================
+void UiDisplay::blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels) {
+    if (!pixels) return;
+
+    int16_t cx = x, cy = y, cw = w, ch = h;
+    if (!clipRect(cx, cy, cw, ch)) return;
+
+    if (_bandBuf) {
+        // в полосу — построчное копирование
+        for (int16_t r = 0; r < ch; r++) {
+            const uint16_t* s = pixels + (int32_t)(cy - y + r) * w + (cx - x);
+            uint16_t*       d = _bandBuf
+                              + (int32_t)(cy - _band.y + r) * _band.w
+                              + (cx - _band.x);
+            memcpy(d, s, (size_t)cw * sizeof(uint16_t));
+        }
+        return;
+    }
+
+    account((uint32_t)cw * (uint32_t)ch);
+
+    // writePixels() буфер не меняет (ESP32 свапает байты на лету),
+    // const_cast только ради старой сигнатуры Adafruit_SPITFT.
+    uint16_t* src = const_cast<uint16_t*>(pixels)
+                  + (int32_t)(cy - y) * w + (cx - x);
+
+    startWrite();
+    setAddrWindow(cx, cy, cw, ch);
+
+    if (cw == w) {
+        // строки идут подряд — один поток
+        writePixels(src, (uint32_t)cw * (uint32_t)ch);
+    } else {
+        // обрезано по X — то же окно, строки кусками
+        for (int16_t r = 0; r < ch; r++) {
+            writePixels(src + (int32_t)r * w, (uint32_t)cw);
+        }
+    }
+
+    endWrite();
+}
+
+void UiDisplay::blitBlend(int16_t x, int16_t y, int16_t w, int16_t h,
+                          const uint16_t* pixels, uint16_t bg, uint8_t a) {
+    if (!pixels) return;
+    if (a == 255) { blit(x, y, w, h, pixels); return; }
+
+    int16_t cx = x, cy = y, cw = w, ch = h;
+    if (!clipRect(cx, cy, cw, ch)) return;
+
+    if (_bandBuf) {
+        // смешиваем прямо в полосу
+        for (int16_t r = 0; r < ch; r++) {
+            const uint16_t* s = pixels + (int32_t)(cy - y + r) * w + (cx - x);
+            uint16_t*       d = _bandBuf
+                              + (int32_t)(cy - _band.y + r) * _band.w
+                              + (cx - _band.x);
+            for (int16_t i = 0; i < cw; i++) d[i] = blend565(bg, s[i], a);
+        }
+        return;
+    }
+
+    account((uint32_t)cw * (uint32_t)ch);
+
+    // Исходник не трогаем: строка уходит кусками через буфер на стеке
+    static constexpr int16_t CHUNK = 32;
+    uint16_t tmp[CHUNK];
+
+    startWrite();
+    setAddrWindow(cx, cy, cw, ch);
+
+    for (int16_t r = 0; r < ch; r++) {
+        const uint16_t* s = pixels + (int32_t)(cy - y + r) * w + (cx - x);
+
+        for (int16_t i = 0; i < cw; i += CHUNK) {
+            const int16_t n = (cw - i < CHUNK) ? (int16_t)(cw - i) : CHUNK;
+            for (int16_t k = 0; k < n; k++) tmp[k] = blend565(bg, s[i + k], a);
+            writePixels(tmp, (uint32_t)n);
+        }
+    }
+
+    endWrite();
+}
+
+// ============================================================================
+// bands
+// ============================================================================
+void UiDisplay::beginBands() {
+    _traffic[(uint8_t)UiTag::BANDS].transactions++;
+    Adafruit_ST7735::startWrite();
+    _writeHeld = true;
+}
+
+void UiDisplay::endBands() {
+    // Последняя полоса ещё может идти по DMA
+    dmaWait(0);
+
+    _bandBuf  = nullptr;
+    _writeHeld = false;
+
+    Adafruit_ST7735::endWrite();
+}
+
+void UiDisplay::beginOffscreen(const UiRect& r, uint16_t* buf) {
+    _writeHeld = true;
+    setBand(r, buf);
+}
+
+void UiDisplay::endOffscreen() {
+    _bandBuf   = nullptr;
+    _writeHeld = false;
+}
+
+void UiDisplay::setBand(const UiRect& band, uint16_t* buf) {
+    _band    = band;
+    _bandBuf = buf;
+}
+
+void UiDisplay::pushBand() {
+    if (!_bandBuf) return;
+
+    const uint32_t n = (uint32_t)_band.w * (uint32_t)_band.h;
+
+    if (_dmaOn) {
+        // Эта полоса — в очередь; ждём предыдущую (её буфер
+        // BandRenderer заполнит следующей полосой)
+        dmaQueueBand(n);
+        dmaWait(DMA_TRANS_PER_BAND);
+    } else {
+        // С блокировкой: буфер полосы сразу же заполняется следующей
+        Adafruit_ST7735::setAddrWindow(_band.x, _band.y, _band.w, _band.h);
+        writePixels(_bandBuf, n);
+    }
+
+    // Трафик полосы — компоновщику, не последнему нарисовавшему слою
+    Traffic& t = _traffic[(uint8_t)UiTag::BANDS];
+    t.windows++;
+    t.pixels += n;
+    _pixels  += n;
+
+    _bandBuf = nullptr;
+}
+
+// ============================================================================
+// DMA — полосы через spi_master (ESP32)
+// ============================================================================
+//
+// Adafruit_SPITFT на ESP32 шлёт writePixels() без DMA и блокирует, поэтому
+// полосы уходят мимо него: spi_master на том же хосте (VSPI), CS держит
+// Adafruit (startWrite в beginBands), DC переключает pre_cb по t->user.
+// Полоса = CASET/RASET/RAMWR (команда + данные) и поток пикселей:
+// DMA_TRANS_PER_BAND транзакций в очереди, пиксели — из буфера полосы.
+// После endBands() следующий startWrite() (SPI.beginTransaction) заново
+// выставляет частоту/режим SPI для Adafruit.
+#if defined(ARDUINO_ARCH_ESP32)
+
+namespace {
+
+spi_device_handle_t s_dmaDev = nullptr;
+int8_t              s_dcPin  = -1;
+
+// Транзакции двух полос: пока одна в DMA, другая собирается
+spi_transaction_t s_trans[2][UiDisplay::DMA_TRANS_PER_BAND];
+
+void IRAM_ATTR dmaPreCb(spi_transaction_t* t) {
+    gpio_set_level((gpio_num_t)s_dcPin, (int)(intptr_t)t->user);
+}
+
+void setCmd(spi_transaction_t& t, uint8_t cmd) {
+    t = {};
+    t.flags      = SPI_TRANS_USE_TXDATA;
+    t.length     = 8;
+    t.tx_data[0] = cmd;
+    t.user       = (void*)0;     // DC = команда
+}
+
+void setRange(spi_transaction_t& t, uint16_t a, uint16_t b) {
+    t = {};
+    t.flags      = SPI_TRANS_USE_TXDATA;
+    t.length     = 32;
+    t.tx_data[0] = (uint8_t)(a >> 8);
+    t.tx_data[1] = (uint8_t)a;
+    t.tx_data[2] = (uint8_t)(b >> 8);
+    t.tx_data[3] = (uint8_t)b;
+    t.user       = (void*)1;     // DC = данные
+}
+
+} // namespace
+
+bool UiDisplay::beginDma(uint32_t spiHz) {
+
+    if (_dmaOn) return true;
+
+    // Пины VSPI по умолчанию (SPI.begin()): MOSI 23, SCLK 18, MISO не нужен
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num     = 23;
+    bus.miso_io_num     = -1;
+    bus.sclk_io_num     = 18;
+    bus.quadwp_io_num   = -1;
+    bus.quadhd_io_num   = -1;
+    bus.max_transfer_sz = DMA_MAX_BYTES;
+
+    if (spi_bus_initialize(SPI3_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) return false;
+
+    spi_device_interface_config_t dev = {};
+    dev.clock_speed_hz = (int)spiHz;
+    dev.mode           = 0;
+    dev.spics_io_num   = -1;                       // CS — у Adafruit
+    dev.queue_size     = 2 * DMA_TRANS_PER_BAND;
+    dev.pre_cb         = dmaPreCb;
+
+    if (spi_bus_add_device(SPI3_HOST, &dev, &s_dmaDev) != ESP_OK) {
+        spi_bus_free(SPI3_HOST);
+        return false;
+    }
+
+    s_dcPin = _dcPin;
+    _dmaOn  = true;
+    return true;
+}
+
+void UiDisplay::dmaQueueBand(uint32_t n) {
+
+    spi_transaction_t* t = s_trans[_dmaSlot];
+    _dmaSlot ^= 1;
+
+    // Панель ждёт big-endian RGB565; буфер полосы больше не рисуется —
+    // переворачиваем на месте (Adafruit делал это на лету)
+    for (uint32_t i = 0; i < n; i++) {
+        _bandBuf[i] = (uint16_t)((_bandBuf[i] << 8) | (_bandBuf[i] >> 8));
+    }
+
+    const uint16_t x = (uint16_t)(_band.x + _xstart);
+    const uint16_t y = (uint16_t)(_band.y + _ystart);
+
+    setCmd  (t[0], ST77XX_CASET);
+    setRange(t[1], x, (uint16_t)(x + _band.w - 1));
+    setCmd  (t[2], ST77XX_RASET);
+    setRange(t[3], y, (uint16_t)(y + _band.h - 1));
+    setCmd  (t[4], ST77XX_RAMWR);
+
+    t[5] = {};
+    t[5].length    = n * 16;
+    t[5].tx_buffer = _bandBuf;
+    t[5].user      = (void*)1;
+
+    for (uint8_t i = 0; i < DMA_TRANS_PER_BAND; i++) {
+        spi_device_queue_trans(s_dmaDev, &t[i], portMAX_DELAY);
+    }
+    _dmaQueued += DMA_TRANS_PER_BAND;
+}
+
+void UiDisplay::dmaWait(uint8_t keep) {
+
+    spi_transaction_t* done = nullptr;
+
+    while (_dmaQueued > keep) {
+        spi_device_get_trans_result(s_dmaDev, &done, portMAX_DELAY);
+        _dmaQueued--;
+    }
+}
+
+#else
+
+// env:native: DMA нет — полосы блокирующим writePixels()
+bool UiDisplay::beginDma(uint32_t) { return false; }
+void UiDisplay::dmaQueueBand(uint32_t) {}
+void UiDisplay::dmaWait(uint8_t) {}
+
+#endif
+
+void UiDisplay::bandFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    uint16_t* row = _bandBuf
+                  + (int32_t)(y - _band.y) * _band.w
+                  + (x - _band.x);
+
+    for (int16_t r = 0; r < h; r++) {
+        for (int16_t i = 0; i < w; i++) row[i] = color;
+        row += _band.w;
+    }
+}
+
+// ============================================================================
+// traffic
+// ============================================================================
+void UiDisplay::resetTraffic() {
+    for (uint8_t i = 0; i < (uint8_t)UiTag::COUNT; i++) {
+        _traffic[i] = Traffic{};
+    }
+}
+
+void UiDisplay::dumpTraffic(Print& out) const {
+    out.println("[TFT] tag        pixels   windows  trans");
+
+    for (uint8_t i = 0; i < (uint8_t)UiTag::COUNT; i++) {
+        const Traffic& t = _traffic[i];
+        if (t.pixels == 0 && t.windows == 0 && t.transactions == 0) continue;
+
+        out.printf("[TFT] %-10s %8u %8u %6u\n",
+                   uiTagName((UiTag)i),
+                   (unsigned)t.pixels,
+                   (unsigned)t.windows,
+                   (unsigned)t.transactions);
+    }
+}
+
+// ============================================================================
+// text spans
+// ============================================================================
+bool UiDisplay::spanTextOk() {
+
+    // Только классический шрифт, непрозрачный фон, маски как в drawChar
+    if (gfxFont || textcolor == textbgcolor || _cp437) return false;
+
+    if (!_text.ready()) _text.begin();
+    return TextRenderer::cellPixels(textsize_x, textsize_y) <= TEXT_BUF_PX;
+}
+
+size_t UiDisplay::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t UiDisplay::write(const uint8_t* s, size_t n) {
+
+    if (!spanTextOk()) {
+        for (size_t i = 0; i < n; i++) Adafruit_ST7735::write(s[i]);
+        return n;
+    }
+
+    const int16_t cw = (int16_t)TextRenderer::CELL_W * textsize_x;
+
+    size_t i = 0;
+    while (i < n) {
+
+        // Набираем символы, которые Adafruit_GFX нарисовал бы подряд
+        size_t  j = i;
+        int16_t x = cursor_x;
+        while (j < n &&
+               s[j] != '\n' && s[j] != '\r' &&
+               !(wrap && x + cw > _width)) {
+            x += cw;
+            j++;
+        }
+
+        if (j > i) {
+            drawTextSpan(s + i, j - i);
+            i = j;
+            continue;
+        }
+
+        // Перевод строки / перенос — штатная логика курсора GFX
+        Adafruit_ST7735::write(s[i]);
+        i++;
+    }
+
+    return n;
+}
+
+void UiDisplay::drawTextSpan(const uint8_t* s, size_t n) {
+
+    const uint32_t t0 = micros();
+
+    const int16_t  cw       = (int16_t)TextRenderer::CELL_W * textsize_x;
+    const int16_t  ch       = (int16_t)TextRenderer::CELL_H * textsize_y;
+    const uint16_t perChunk =
+        (uint16_t)(TEXT_BUF_PX / TextRenderer::cellPixels(textsize_x, textsize_y));
+
+    while (n > 0) {
+        const uint16_t k = (n < perChunk) ? (uint16_t)n : perChunk;
+        const int16_t  w = (int16_t)(k * cw);
+
+        // Кусок целиком вне экрана/клипа — не растеризуем
+        if (clipIntersects(cursor_x, cursor_y, w, ch) &&
+            cursor_x < _width && cursor_x + w > 0) {
+            _text.render(s, k, textsize_x, textsize_y,
+                         textcolor, textbgcolor, _textBuf);
+            blit(cursor_x, cursor_y, w, ch, _textBuf);
+        }
+
+        cursor_x += w;
+        s        += k;
+        n        -= k;
+        _textChars += k;
+    }
+
+    _textUs += micros() - t0;
+}
@@ -0,0 +1,200 @@
+#pragma once
+#include <Adafruit_ST7735.h>
+
+#include "ui/DirtyRegion.h"
+#include "ui/TextRenderer.h"
+#include "ui/UiTag.h"
+
+/*
+ * UiDisplay
+ * ---------
+ * Тонкая обёртка над Adafruit_ST7735 для компоновщика кадра.
+ *
+ * Что добавляет:
+ *  - clip-прямоугольник: всё, что рисуется вне clip, НЕ уходит по SPI
+ *  - счётчик пикселей, реально отправленных в дисплей
+ *  - учёт трафика по тегам (UiTag): пиксели, окна адреса, транзакции
+ *  - непрозрачный текст классического шрифта — спанами (TextRenderer):
+ *    print() с setTextColor(fg, bg) уходит одним окном адреса на строку
+ *  - режим полосы (BandRenderer): примитивы пишутся в RAM-буфер,
+ *    буфер уходит одним окном адреса
+ *  - offscreen: тот же RAM-буфер без отправки (снимок кадра)
+ *
+ * Почему subclass, а не отдельный canvas:
+ *  - экраны и виджеты продолжают рисовать через Adafruit_ST7735& / GFX API
+ *  - весь текст/линии/круги Adafruit_GFX сводит к нескольким виртуальным
+ *    примитивам (writePixel / writeFillRect / write*Line), их и перехватываем
+ *
+ * ПРАВИЛО:
+ *  - clip выставляет ТОЛЬКО ScreenManager (на время flush)
+ *  - полосы включает ТОЛЬКО BandRenderer
+ */
+
+class UiDisplay : public Adafruit_ST7735 {
+public:
+    UiDisplay(int8_t cs, int8_t dc, int8_t rst);
+
+    // ===== CLIP =====
+    void setClip(const UiRect& r);
+    void resetClip();
+
+    bool hasClip() const { return _clipOn; }
+
+    // Пересекается ли прямоугольник с текущим clip
+    // (виджеты могут пропускать заведомо невидимые элементы).
+    bool clipIntersects(int16_t x, int16_t y, int16_t w, int16_t h) const;
+
+    // ===== BLIT =====
+    // RGB565 спрайт w*h одним окном адреса (setAddrWindow + поток пикселей).
+    // Учитывает clip: отправляется только видимая часть.
+    void blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+
+    // Тот же blit, но каждый пиксель смешан с bg (blend565):
+    // a=255 — как blit, a=0 — сплошной bg. Окно одно, смешиваются
+    // только видимые пиксели.
+    void blitBlend(int16_t x, int16_t y, int16_t w, int16_t h,
+                   const uint16_t* pixels, uint16_t bg, uint8_t a);
+
+    // ===== BAND =====
+    // Проход полосами держит одну SPI-транзакцию: startWrite()/endWrite()
+    // внутри прохода — no-op, между полосами в шину ходит только pushBand().
+    void beginBands();
+    void endBands();
+
+    // Дальше примитивы пишут в buf (band.w * band.h), а не в дисплей
+    void setBand(const UiRect& band, uint16_t* buf);
+
+    // Полосу — одним окном адреса. С DMA полоса уходит в очередь
+    // и pushBand ждёт только ПРЕДЫДУЩУЮ: буфер этой полосы трогать
+    // нельзя до следующего pushBand() / endBands(). Без DMA — с
+    // блокировкой, буфер свободен сразу.
+    void pushBand();
+
+    bool inBand() const { return _bandBuf != nullptr; }
+
+    // ===== DMA (ESP32) =====
+    // Полосы через spi_master на SPI-хосте дисплея (VSPI) с DMA.
+    // Вызывать после initR(); spiHz — та же частота, что у SPI дисплея.
+    // false — DMA нет (env:native, драйвер не встал): полосы блокируют.
+    bool beginDma(uint32_t spiHz);
+    bool dmaOn() const { return _dmaOn; }
+
+    // CASET, RASET, RAMWR (команда + данные) и пиксели
+    static constexpr uint8_t  DMA_TRANS_PER_BAND = 6;
+    // Самая большая полоса (BandRenderer::BAND_PX), байт
+    static constexpr uint32_t DMA_MAX_BYTES      = 160 * 16 * 2;
+
+    // ===== OFFSCREEN =====
+    // Как полоса, но без дисплея вообще: примитивы пишутся в buf
+    // (r.w * r.h), SPI не трогается до endOffscreen().
+    void beginOffscreen(const UiRect& r, uint16_t* buf);
+    void endOffscreen();
+
+    // ===== TEXT =====
+    // print() / write() через Print: непрозрачный классический шрифт
+    // собирается в буфер и идёт blit'ом; остальное — как в Adafruit_GFX.
+    using Adafruit_ST7735::write;
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* s, size_t n) override;
+
+    // ===== STATS =====
+    // Монотонный счётчик пикселей, отправленных в дисплей.
+    uint32_t pixelsPushed() const { return _pixels; }
+
+    // Трафик по тегам (монотонные счётчики)
+    struct Traffic {
+        uint32_t pixels;        // пикселей в дисплей
+        uint32_t windows;       // setAddrWindow
+        uint32_t transactions;  // startWrite → endWrite
+    };
+
+    void  setTag(UiTag t) { _tag = t; }
+    UiTag tag() const     { return _tag; }
+
+    const Traffic& traffic(UiTag t) const { return _traffic[(uint8_t)t]; }
+    void resetTraffic();
+
+    // Таблица по всем тегам с ненулевым трафиком
+    void dumpTraffic(Print& out) const;
+
+    // Текст спанами: символы и время растеризации + отправки (мкс)
+    uint32_t textChars() const { return _textChars; }
+    uint32_t textUs()    const { return _textUs; }
+
+    // ===== GFX primitives (clip + учёт) =====
+    void startWrite() override;
+    void endWrite() override;
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+    using Adafruit_ST7735::writePixel;
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+private:
+    // Нормализует и обрезает rect по экрану и clip.
+    // false — рисовать нечего.
+    bool clipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const;
+    bool clipPoint(int16_t x, int16_t y) const;
+
+    // Пиксели в дисплей — в общий счётчик и в счётчик тега
+    void account(uint32_t px) {
+        _pixels += px;
+        _traffic[(uint8_t)_tag].pixels += px;
+    }
+
+    // Запись в буфер полосы (координаты уже обрезаны clipRect)
+    void bandFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    // Можно ли рисовать текущий текст спаном
+    bool spanTextOk();
+    // n символов без переносов от курсора, курсор сдвигается
+    void drawTextSpan(const uint8_t* s, size_t n);
+
+private:
+    UiRect   _clip{ 0, 0, 0, 0 };
+    bool     _clipOn = false;
+
+    uint32_t _pixels = 0;
+
+    UiTag    _tag = UiTag::OTHER;
+    Traffic  _traffic[(uint8_t)UiTag::COUNT] = {};
+
+    // ---- band ----
+    // startWrite()/endWrite() — no-op: транзакцию держит проход
+    // полосами, либо рисуем offscreen и SPI не нужен
+    bool      _writeHeld = false;
+    UiRect    _band{ 0, 0, 0, 0 };
+    uint16_t* _bandBuf  = nullptr;
+
+    // ---- DMA ----
+    // Очередь spi_master: транзакции полосы в слоте _dmaSlot (0/1),
+    // _dmaQueued — поставлено и ещё не забрано
+    void dmaQueueBand(uint32_t n);
+    void dmaWait(uint8_t keep);
+
+    int8_t  _dcPin;
+    bool    _dmaOn     = false;
+    uint8_t _dmaSlot   = 0;
+    uint8_t _dmaQueued = 0;
+
+    // Одна строка size 1 во всю ширину; длиннее / крупнее — кусками
+    static constexpr uint16_t TEXT_BUF_PX = 160 * TextRenderer::CELL_H;
+
+    TextRenderer _text;
+    uint16_t     _textBuf[TEXT_BUF_PX];
+
+    uint32_t _textChars = 0;
+    uint32_t _textUs    = 0;
+};
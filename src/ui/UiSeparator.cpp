@@ -32,64 +32,43 @@ void UiSeparator::markDirty() {
     _dirty = true;
 }
 
-void UiSeparator::update() {
+UiRect UiSeparator::lineRect(int y) const {
+    return UiRect{ 0, (int16_t)y, (int16_t)_tft.width(), 1 };
+}
 
-    // Если раньше рисовали — и теперь нужно стереть старое место (смена видимости или смена y)
-    const bool needClearOld =
-        (_wasVisible && (_dirty || !_visible || _y < 0) && _lastY >= 0);
+void UiSeparator::update(DirtyRegion& dirty) {
 
-    if (needClearOld) {
-        clearAt(_lastY);
-    }
+    const bool show = _visible && _y >= 0;
 
-    // Скрыт → ничего не рисуем
-    if (!_visible) {
-        _wasVisible = false;
-        _dirty = false;
+    // Если не dirty и уже нарисовано на том же месте — можно выйти
+    if (!_dirty && show == _wasVisible && (!show || _lastY == _y))
         return;
-    }
 
-    // Невалидный Y → ничего не рисуем
-    if (_y < 0) {
-        _wasVisible = false;
-        _dirty = false;
-        return;
+    // Если раньше рисовали — старое место перерисуют нижние слои
+    if (_wasVisible && _lastY >= 0) {
+        dirty.add(lineRect(_lastY));
     }
 
-    // Если не dirty и уже было нарисовано — можно выйти
-    if (!_dirty && _wasVisible && _lastY == _y)
-        return;
-
-    // Рисуем линию
-    draw();
+    // Скрыт / невалидный Y → ничего не рисуем
+    if (show) {
+        dirty.add(lineRect(_y));
+    }
 
-    _lastY = _y;
-    _wasVisible = true;
-    _dirty = false;
+    _lastY      = show ? _y : -1;
+    _wasVisible = show;
+    _dirty      = false;
 }
 
 void UiSeparator::draw() {
+    if (!_wasVisible || _lastY < 0)
+        return;
+
     const Theme& th = _theme.current();
 
     _tft.drawFastHLine(
         0,
-        _y,
+        _lastY,
         _tft.width(),
         th.muted
     );
 }
-
-void UiSeparator::clearAt(int y) {
-    if (y < 0) return;
-
-    const Theme& th = _theme.current();
-
-    // очищаем область толщиной 2px на всякий случай
-    _tft.fillRect(
-        0,
-        y,
-        _tft.width(),
-        2,
-        th.bg
-    );
-}
\ No newline at end of file
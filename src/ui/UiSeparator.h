@@ -2,6 +2,7 @@
 #include <Adafruit_ST7735.h>
 #include "services/ThemeService.h"
 #include "services/LayoutService.h"
+#include "ui/DirtyRegion.h"
 
 /*
  * UiSeparator
@@ -15,6 +16,10 @@
  *      - при смене y
  *      - при уходе y в -1
  *  - Не является "overlay" над контентом экрана.
+ *
+ * КАДР:
+ *  - старое место НЕ стирается явно: оно уходит в dirty,
+ *    и нижние слои (экран / StatusBar) перерисовывают его сами
  */
 
 class UiSeparator {
@@ -28,11 +33,11 @@ public:
     void setY(int y);
     void setVisible(bool visible);
     void markDirty();
-    void update();
+    void update(DirtyRegion& dirty);
+    void draw();
 
 private:
-    void draw();
-    void clearAt(int y);
+    UiRect lineRect(int y) const;
 
 private:
     Adafruit_ST7735& _tft;
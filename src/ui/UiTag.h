@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+/*
+ * UiTag
+ * -----
+ * Кто сейчас рисует — для учёта SPI-трафика по виджетам (UiDisplay).
+ *
+ * Тег выставляет ScreenManager перед draw() каждого слоя.
+ * BANDS — проход BandRenderer: полосу шлёт компоновщик, а не виджет.
+ */
+enum class UiTag : uint8_t {
+    OTHER = 0,
+    CLOCK,
+    STATUSBAR,
+    BUTTONBAR,
+    SEPARATOR,
+    FORECAST,
+    SETTINGS,
+    OVERLAY,
+    BANDS,
+
+    COUNT
+};
+
+inline const char* uiTagName(UiTag t) {
+    switch (t) {
+        case UiTag::CLOCK:     return "clock";
+        case UiTag::STATUSBAR: return "statusbar";
+        case UiTag::BUTTONBAR: return "buttonbar";
+        case UiTag::SEPARATOR: return "separator";
+        case UiTag::FORECAST:  return "forecast";
+        case UiTag::SETTINGS:  return "settings";
+        case UiTag::OVERLAY:   return "overlay";
+        case UiTag::BANDS:     return "bands";
+        default:               return "other";
+    }
+}
@@ -0,0 +1,588 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+ * aa_digits.h
+ * -----------
+ * Сглаженные цифры часов '0'..'9' и ':' — мастер-растр 4bpp alpha.
+ *
+ * Формат:
+ *  - цифра 30x48, ':' 15x48 (сетка 10x16 единиц, 3 px на единицу)
+ *  - 2 пикселя на байт, старший полубайт — левый, строка дополнена до байта
+ *  - alpha 0..15 (0 — фон, 15 — цвет цифры)
+ *
+ * Штрихи: скруглённые линии/дуги толщиной 2.4 единицы, растр
+ * с суперсэмплингом 6x6. Размер на экране — любой (масштабирует
+ * DigitSpriteCache), мастер крупнее любой цифры на 160x128.
+ */
+
+static constexpr uint8_t AA_DIGIT_MASTER_W = 30;
+static constexpr uint8_t AA_COLON_MASTER_W = 15;
+static constexpr uint8_t AA_DIGIT_MASTER_H = 48;
+
+static const uint8_t aa_digit_0[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_1[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9A,0x81,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFE,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFC,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1F,0xFF,0xFF,0xFF,0x92,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x0A,0xFF,0xFF,0xF9,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xAF,0xFF,0x80,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x21,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFE,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9A,0x81,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_2[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE5,0x00,0x00,0x00,0x5E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x5F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x1F,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x06,0xFF,0xFF,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x49,0xA8,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xF7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xF4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xE0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFC,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0xFD,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xBF,0xFF,0xFF,0xFF,0xFE,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x73,0x00,
+  0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,
+  0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,
+  0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,
+  0x00,0x6A,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xA6,0x00
+};
+
+static const uint8_t aa_digit_3[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0xEF,0xFF,0xFF,0xFF,0xFE,0x81,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,
+  0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,
+  0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,
+  0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+  0x00,0x0D,0xFF,0xFF,0xFF,0xFF,0xFB,0x88,0xBF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,
+  0x00,0x6F,0xFF,0xFF,0xFF,0xF9,0x10,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xF6,0x00,
+  0x00,0xCF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFC,0x00,
+  0x00,0xCF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0x10,
+  0x00,0xBF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0x40,
+  0x00,0x3F,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0x70,
+  0x00,0x04,0xCF,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xDF,0xFF,0xFF,0xFE,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xEF,0xFF,0xFF,0xFF,0xF4,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x8C,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5E,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xA0,
+  0x00,0x00,0x12,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xC0,
+  0x00,0x0A,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC0,
+  0x00,0xAF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xA0,
+  0x01,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0x80,
+  0x02,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0x50,
+  0x00,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFE,0x10,
+  0x00,0x9F,0xFF,0xFF,0xFF,0xF8,0x10,0x00,0x01,0x8F,0xFF,0xFF,0xFF,0xF9,0x00,
+  0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,
+  0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,
+  0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+  0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,
+  0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0xEF,0xFF,0xFF,0xFF,0xFE,0x82,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_4[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x94,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xF2,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFE,0xEF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0xF7,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xD0,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x01,0xEF,0xFF,0xFF,0xFF,0x40,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFB,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xF2,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0xCF,0xFF,0xFF,0xFF,0x80,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x05,0xFF,0xFF,0xFF,0xFE,0x10,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x1D,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x8F,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x02,0xFF,0xFF,0xFF,0xFF,0x85,0x55,0x55,0xDF,0xFF,0xFF,0xF8,0x55,0x52,0x00,
+  0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,
+  0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,
+  0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
+  0x0C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,
+  0x01,0x8C,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xFF,0xFF,0xFF,0xFD,0xCC,0xC8,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF5,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xF2,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x94,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_5[] PROGMEM = {
+  0x00,0x00,0x18,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0x70,0x00,
+  0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x10,
+  0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x98,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x30,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0x34,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x00,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x0D,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x00,0x07,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0x90,
+  0x00,0x00,0x9F,0xFF,0xC1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x00,0x00,0x02,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x00,0x07,0xEF,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x00,0x8F,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x01,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x02,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x01,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x03,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_6[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE5,0x00,0x00,0x00,0x5E,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xF9,0x00,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xF2,0x00,
+  0x4F,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x02,0xCF,0xFD,0x40,0x00,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x20,0x00,0x00,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xF8,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x30,0x00,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0xAF,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0xAF,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0xAF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0xAF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,
+  0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_7[] PROGMEM = {
+  0x00,0x6A,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xA6,0x00,
+  0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,
+  0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,
+  0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,
+  0x00,0x37,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x8F,0xFF,0xFF,0xFF,0xA0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFD,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF8,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xF2,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0xC0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0x60,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFA,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xF5,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xE0,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0x90,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFD,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xEF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x4F,0xFF,0xFE,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x02,0x9A,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_8[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0xEF,0xFF,0xFF,0xFF,0xFE,0x81,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x06,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x60,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,
+  0x00,0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,
+  0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,0x00,
+  0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+  0x00,0x0D,0xFF,0xFF,0xFF,0xFF,0xFB,0x88,0xBF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,
+  0x00,0x6F,0xFF,0xFF,0xFF,0xF9,0x10,0x00,0x01,0x9F,0xFF,0xFF,0xFF,0xF6,0x00,
+  0x00,0xBF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFB,0x00,
+  0x01,0xFF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0x10,
+  0x04,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0x40,
+  0x07,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0x70,
+  0x08,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0x80,
+  0x08,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xFF,0xFF,0x80,
+  0x05,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0x50,
+  0x03,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0x30,
+  0x00,0xEF,0xFF,0xFF,0xFD,0x10,0x00,0x00,0x00,0x01,0xDF,0xFF,0xFF,0xFE,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x4F,0xFF,0xFF,0xFF,0xFE,0x71,0x00,0x17,0xEF,0xFF,0xFF,0xFF,0xF4,0x00,
+  0x00,0x0B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,
+  0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x20,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,
+  0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x00,0x00,
+  0x00,0x01,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x10,0x00,
+  0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,
+  0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xC8,0x55,0x8C,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xE5,0x00,0x00,0x00,0x5E,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x01,0xFF,0xFF,0xFF,0xFE,0x20,0x00,0x00,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0x10,
+  0x06,0xFF,0xFF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0x60,
+  0x09,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x0D,0xFF,0xFF,0xFF,0x90,
+  0x0A,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xA0,
+  0x0C,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xC0,
+  0x0C,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xC0,
+  0x0A,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xA0,
+  0x08,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0x80,
+  0x04,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFF,0x40,
+  0x00,0xEF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFE,0x00,
+  0x00,0x9F,0xFF,0xFF,0xFF,0xF8,0x10,0x00,0x01,0x8F,0xFF,0xFF,0xFF,0xF9,0x00,
+  0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFA,0x88,0xAF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,
+  0x00,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,
+  0x00,0x00,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x00,0x00,
+  0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,
+  0x00,0x00,0x01,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0xEF,0xFF,0xFF,0xFF,0xFE,0x82,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_9[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x30,0x00,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xF4,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0xAF,0xFF,0xFF,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x7F,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFA,
+  0x4F,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFA,
+  0x0E,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xFA,
+  0x0A,0xFF,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xFA,
+  0x02,0xFF,0xFF,0xFF,0xFF,0xE6,0x00,0x00,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0x1D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFF,0xFF,0xFA,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFA,
+  0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xF7,
+  0x00,0x04,0xDF,0xFC,0x20,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xF4,
+  0x00,0x2F,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFF,0xFF,0xE0,
+  0x00,0x9F,0xFF,0xFF,0xFC,0x10,0x00,0x00,0x00,0x01,0xCF,0xFF,0xFF,0xFF,0xA0,
+  0x00,0xAF,0xFF,0xFF,0xFF,0xE5,0x00,0x00,0x00,0x5E,0xFF,0xFF,0xFF,0xFF,0x20,
+  0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xEA,0x88,0xAE,0xFF,0xFF,0xFF,0xFF,0xFA,0x00,
+  0x00,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
+  0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x2A,0xEF,0xFF,0xFF,0xFF,0xFE,0xA2,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x7A,0xAA,0xA7,0x40,0x00,0x00,0x00,0x00,0x00
+};
+
+static const uint8_t aa_digit_colon[] PROGMEM = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x35,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x4C,0xFF,0xFC,0x40,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x0C,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+  0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+  0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x0C,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x4C,0xFF,0xFC,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x35,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x35,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x4C,0xFF,0xFC,0x40,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x0C,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+  0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0x50,0x00,
+  0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x30,0x00,
+  0x00,0x0C,0xFF,0xFF,0xFF,0xFC,0x00,0x00,
+  0x00,0x04,0xFF,0xFF,0xFF,0xF4,0x00,0x00,
+  0x00,0x00,0x4C,0xFF,0xFC,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x35,0x30,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+
+// Индекс = цифра, 10 = ':'
+static const uint8_t* const aa_digits[11] = {
+    aa_digit_0, aa_digit_1, aa_digit_2, aa_digit_3, aa_digit_4, aa_digit_5,
+    aa_digit_6, aa_digit_7, aa_digit_8, aa_digit_9, aa_digit_colon
+};
@@ -0,0 +1,116 @@
+#include "ui/weather/ForecastCardCache.h"
+
+#include <string.h>
+
+// ============================================================================
+// begin / end — холсты живут, пока экран прогноза на дисплее
+// ============================================================================
+bool ForecastCardCache::begin(int16_t w, int16_t h) {
+
+    if (_ready) return true;
+
+    if (w <= 0 || h <= 0 || w > CARD_W || h > CARD_H_MAX) return false;
+
+    for (uint8_t i = 0; i < CARDS; i++) {
+        GFXcanvas16* c = new GFXcanvas16(w, h);
+
+        if (!c || !c->getBuffer()) {
+            delete c;
+            // Половина бюджета бесполезна: slide нужны обе карточки
+            for (uint8_t k = 0; k < i; k++) {
+                delete _slots[k].canvas;
+                _slots[k].canvas = nullptr;
+            }
+            return false;
+        }
+
+        c->setTextWrap(false);
+        _slots[i].canvas = c;
+        _slots[i].valid  = false;
+    }
+
+    _w     = w;
+    _h     = h;
+    _ready = true;
+    return true;
+}
+
+void ForecastCardCache::end() {
+
+    for (uint8_t i = 0; i < CARDS; i++) {
+        delete _slots[i].canvas;
+        _slots[i] = {};
+    }
+
+    _w      = 0;
+    _h      = 0;
+    _ready  = false;
+    _synced = false;
+}
+
+// ============================================================================
+// invalidation
+// ============================================================================
+void ForecastCardCache::sync(uint32_t modelVersion, const ThemeBlend& blend) {
+
+    if (_synced &&
+        modelVersion == _modelVersion &&
+        memcmp(&blend, &_blend, sizeof(ThemeBlend)) == 0) {
+        return;
+    }
+
+    _modelVersion = modelVersion;
+    _blend        = blend;
+    _synced       = true;
+    clear();
+}
+
+void ForecastCardCache::clear() {
+    for (uint8_t i = 0; i < CARDS; i++) {
+        _slots[i].valid = false;
+    }
+}
+
+// ============================================================================
+// lookup
+// ============================================================================
+GFXcanvas16* ForecastCardCache::find(uint8_t day) {
+
+    if (!_ready) return nullptr;
+
+    for (uint8_t i = 0; i < CARDS; i++) {
+        Slot& s = _slots[i];
+        if (s.valid && s.day == day) {
+            s.lastUse = ++_tick;
+            return s.canvas;
+        }
+    }
+    return nullptr;
+}
+
+GFXcanvas16* ForecastCardCache::acquire(uint8_t day, int keep) {
+
+    if (!_ready) return nullptr;
+
+    int victim = -1;
+
+    for (uint8_t i = 0; i < CARDS; i++) {
+        const Slot& s = _slots[i];
+
+        if (s.valid && (int)s.day == keep) continue;
+
+        // пустой слот — лучший кандидат, иначе самый старый
+        if (victim >= 0 && !_slots[victim].valid) continue;
+        if (victim < 0 || !s.valid || s.lastUse < _slots[victim].lastUse) victim = i;
+    }
+
+    if (victim < 0) return nullptr;
+
+    Slot& s = _slots[victim];
+    s.day     = day;
+    s.valid   = true;
+    s.lastUse = ++_tick;
+    _renders++;
+
+    return s.canvas;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#include "services/ThemeBlend.h"
+
+/*
+ * ForecastCardCache
+ * -----------------
+ * Заранее отрисованные "карточки" дней прогноза (RGB565, вся content-зона).
+ *
+ * Зачем:
+ *  - slide-анимация каждый кадр чистила контент и заново печатала
+ *    два дня (заголовок, день, ночь, влажность) — мерцание и рваный темп
+ *  - с карточками кадр анимации = два blit окна со смещением
+ *
+ * Ключ слота:
+ *  - индекс дня
+ *  - версия модели (ForecastService::version) и ThemeBlend — общие:
+ *    при их смене sync() сбрасывает все карточки
+ *
+ * ПАМЯТЬ (фиксированный бюджет):
+ *  - CARDS холстов CARD_W x CARD_H_MAX, только пока Forecast на дисплее:
+ *    begin() при входе на экран, end() при уходе — под часами и
+ *    настройками эти ~50 КБ свободны (TLS-рукопожатие прогноза)
+ *  - не влезли / не выделились — ready() == false, экран рисует напрямую
+ */
+
+class ForecastCardCache {
+public:
+    static constexpr uint8_t  CARDS      = 2;     // slide: "откуда" + "куда"
+    static constexpr int16_t  CARD_W     = 160;
+    static constexpr int16_t  CARD_H_MAX = 80;
+
+    static constexpr uint32_t BUDGET_BYTES = 52UL * 1024UL;
+
+    static_assert(
+        (uint32_t)CARDS * CARD_W * CARD_H_MAX * sizeof(uint16_t) <= BUDGET_BYTES,
+        "ForecastCardCache: card sprites exceed memory budget"
+    );
+
+    // Выделить холсты под content-зону w x h (повторный вызов — no-op)
+    bool begin(int16_t w, int16_t h);
+    // Освободить холсты (карточки пропадают, ready() == false)
+    void end();
+    bool ready() const { return _ready; }
+
+    // Сбросить карточки, если данные или палитра изменились
+    void sync(uint32_t modelVersion, const ThemeBlend& blend);
+    void clear();
+
+    // Готовая карточка дня или nullptr
+    GFXcanvas16* find(uint8_t day);
+
+    // Слот под перерисовку дня (LRU, `keep` не вытесняется).
+    // Слот сразу считается картой `day` — вызывающий обязан нарисовать её.
+    GFXcanvas16* acquire(uint8_t day, int keep = -1);
+
+    int16_t width()  const { return _w; }
+    int16_t height() const { return _h; }
+
+    uint32_t renders() const { return _renders; }
+
+private:
+    struct Slot {
+        GFXcanvas16* canvas;
+        uint32_t     lastUse;
+        uint8_t      day;
+        bool         valid;
+    };
+
+private:
+    Slot _slots[CARDS] = {};
+
+    int16_t _w = 0;
+    int16_t _h = 0;
+    bool    _ready = false;
+
+    uint32_t   _modelVersion = 0;
+    ThemeBlend _blend        = {};
+    bool       _synced       = false;
+
+    uint32_t _tick    = 0;
+    uint32_t _renders = 0;
+};
@@ -0,0 +1,71 @@
+#include "ui/weather/WeatherIconCache.h"
+
+// ============================================================================
+// invalidation
+// ============================================================================
+void WeatherIconCache::sync(uint32_t paletteVersion) {
+    if (paletteVersion == _paletteVersion) return;
+
+    _paletteVersion = paletteVersion;
+    clear();
+}
+
+void WeatherIconCache::clear() {
+    for (uint8_t i = 0; i < SLOTS; i++) {
+        _slots[i].data = nullptr;
+    }
+}
+
+// ============================================================================
+// lookup (LRU)
+// ============================================================================
+const uint16_t* WeatherIconCache::get(const WeatherIcon& icon, uint16_t fg, uint16_t bg) {
+
+    if (!icon.data || icon.width != ICON_W || icon.height != ICON_H)
+        return nullptr;
+
+    _tick++;
+
+    uint8_t victim = 0;
+
+    for (uint8_t i = 0; i < SLOTS; i++) {
+        Slot& s = _slots[i];
+
+        if (s.data == icon.data && s.fg == fg && s.bg == bg) {
+            s.lastUse = _tick;
+            _hits++;
+            return _pixels[i];
+        }
+
+        // пустой слот — лучший кандидат, иначе самый старый
+        if (!_slots[victim].data) continue;
+        if (!s.data || s.lastUse < _slots[victim].lastUse) victim = i;
+    }
+
+    _misses++;
+    render(victim, icon.data, fg, bg);
+    return _pixels[victim];
+}
+
+// ============================================================================
+// render — 1bpp (формат drawBitmap, MSB первым) → RGB565
+// ============================================================================
+void WeatherIconCache::render(uint8_t slot, const uint8_t* data, uint16_t fg, uint16_t bg) {
+
+    Slot& s = _slots[slot];
+    s.data    = data;
+    s.fg      = fg;
+    s.bg      = bg;
+    s.lastUse = _tick;
+
+    constexpr uint8_t ROW_BYTES = (ICON_W + 7) / 8;
+
+    uint16_t* out = _pixels[slot];
+
+    for (uint8_t y = 0; y < ICON_H; y++) {
+        for (uint8_t x = 0; x < ICON_W; x++) {
+            const uint8_t byte = pgm_read_byte(&data[y * ROW_BYTES + (x >> 3)]);
+            *out++ = (byte & (0x80 >> (x & 7))) ? fg : bg;
+        }
+    }
+}
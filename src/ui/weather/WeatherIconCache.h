@@ -0,0 +1,61 @@
+#pragma once
+#include <Arduino.h>
+
+#include "ui/weather/WeatherIcons.h"
+
+/*
+ * WeatherIconCache
+ * ----------------
+ * Маленький LRU погодных иконок, уже развёрнутых в RGB565.
+ *
+ * Зачем:
+ *  - drawBitmap() шлёт иконку по одному пикселю (и только fg-пиксели)
+ *  - развёрнутая иконка уходит одним окном адреса (UiDisplay::blit)
+ *  - во время slide-анимации одна и та же иконка рисуется каждый кадр
+ *
+ * Ключ:
+ *  - (bitmap, fg, bg)
+ *
+ * Инвалидация:
+ *  - sync(version) — при смене версии палитры (ThemeService::tableVersion)
+ *    кеш очищается целиком, старые цвета больше не нужны
+ *
+ * ПАМЯТЬ:
+ *  - фиксированная, без heap: SLOTS * 16 * 16 * 2 байт
+ */
+
+class WeatherIconCache {
+public:
+    static constexpr uint8_t ICON_W = 16;
+    static constexpr uint8_t ICON_H = 16;
+    static constexpr uint8_t SLOTS  = 6;
+
+    void sync(uint32_t paletteVersion);
+    void clear();
+
+    // RGB565 ICON_W x ICON_H (nullptr — иконка другого размера)
+    const uint16_t* get(const WeatherIcon& icon, uint16_t fg, uint16_t bg);
+
+    uint32_t hits()   const { return _hits; }
+    uint32_t misses() const { return _misses; }
+
+private:
+    struct Slot {
+        const uint8_t* data;
+        uint16_t       fg;
+        uint16_t       bg;
+        uint32_t       lastUse;
+    };
+
+    void render(uint8_t slot, const uint8_t* data, uint16_t fg, uint16_t bg);
+
+private:
+    Slot     _slots[SLOTS] = {};
+    uint16_t _pixels[SLOTS][ICON_W * ICON_H];
+
+    uint32_t _paletteVersion = 0;
+
+    uint32_t _tick   = 0;
+    uint32_t _hits   = 0;
+    uint32_t _misses = 0;
+};
@@ -0,0 +1,387 @@
+#include "Adafruit_GFX.h"
+
+#include "glcdfont.h"
+
+// ============================================================================
+// Adafruit_GFX
+// ============================================================================
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h)
+{
+    _width      = WIDTH;
+    _height     = HEIGHT;
+    rotation    = 0;
+    cursor_y    = cursor_x = 0;
+    textsize_x  = textsize_y = 1;
+    textcolor   = textbgcolor = 0xFFFF;
+    wrap        = true;
+    _cp437      = false;
+    gfxFont     = nullptr;
+}
+
+void Adafruit_GFX::startWrite() {}
+void Adafruit_GFX::endWrite() {}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+    drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    const bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+    if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+
+    const int16_t dx = x1 - x0;
+    const int16_t dy = abs(y1 - y0);
+    int16_t err   = dx / 2;
+    const int16_t ystep = (y0 < y1) ? 1 : -1;
+
+    for (; x0 <= x1; x0++) {
+        if (steep) writePixel(y0, x0, color);
+        else       writePixel(x0, y0, color);
+        err -= dy;
+        if (err < 0) { y0 += ystep; err += dx; }
+    }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x, y + h - 1, color);
+    endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeLine(x, y, x + w - 1, y, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1) {
+        if (y0 > y1) std::swap(y0, y1);
+        drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if (y0 == y1) {
+        if (x0 > x1) std::swap(x0, x1);
+        drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+        startWrite();
+        writeLine(x0, y0, x1, y1, color);
+        endWrite();
+    }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+    rotation = r & 3;
+    switch (rotation) {
+        case 0:
+        case 2:
+            _width  = WIDTH;
+            _height = HEIGHT;
+            break;
+        default:
+            _width  = HEIGHT;
+            _height = WIDTH;
+            break;
+    }
+}
+
+// ============================================================================
+// круги и битмапы
+// ============================================================================
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    startWrite();
+    writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+    endWrite();
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                                    uint8_t corners, int16_t delta, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t px    = x;
+    int16_t py    = y;
+
+    delta++;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (x < (y + 1)) {
+            if (corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            if (corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+        if (y != py) {
+            if (corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            if (corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color) {
+    const int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+
+    startWrite();
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) b <<= 1;
+            else       b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            if (b & 0x80) writePixel(x + i, y, color);
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                                 int16_t w, int16_t h) {
+    startWrite();
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            writePixel(x + i, y, pgm_read_word(&bitmap[j * w + i]));
+        }
+    }
+    endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                                 int16_t w, int16_t h) {
+    drawRGBBitmap(x, y, (const uint16_t*)bitmap, w, h);
+}
+
+// ============================================================================
+// текст
+// ============================================================================
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size) {
+    drawChar(x, y, c, color, bg, size, size);
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg,
+                            uint8_t sizeX, uint8_t sizeY) {
+
+    if (gfxFont) return;
+
+    if (x >= _width || y >= _height ||
+        (x + 6 * sizeX - 1) < 0 || (y + 8 * sizeY - 1) < 0) return;
+
+    if (!_cp437 && c >= 176) c++;
+
+    const uint8_t* font = glcdfont();
+
+    startWrite();
+    for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+            if (line & 1) {
+                if (sizeX == 1 && sizeY == 1) writePixel(x + i, y + j, color);
+                else writeFillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, color);
+            } else if (bg != color) {
+                if (sizeX == 1 && sizeY == 1) writePixel(x + i, y + j, bg);
+                else writeFillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, bg);
+            }
+        }
+    }
+    if (bg != color) {
+        if (sizeX == 1 && sizeY == 1) writeFastVLine(x + 5, y, 8, bg);
+        else writeFillRect(x + 5 * sizeX, y, sizeX, 8 * sizeY, bg);
+    }
+    endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (gfxFont) return 1;
+
+    if (c == '\n') {
+        cursor_x  = 0;
+        cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+        if (wrap && (cursor_x + textsize_x * 6) > _width) {
+            cursor_x  = 0;
+            cursor_y += textsize_y * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        cursor_x += textsize_x * 6;
+    }
+    return 1;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t* x, int16_t* y,
+                              int16_t* minx, int16_t* miny,
+                              int16_t* maxx, int16_t* maxy) {
+    if (c == '\n') {
+        *x  = 0;
+        *y += textsize_y * 8;
+    } else if (c != '\r') {
+        if (wrap && (*x + textsize_x * 6) > _width) {
+            *x  = 0;
+            *y += textsize_y * 8;
+        }
+        const int16_t x2 = *x + textsize_x * 6 - 1;
+        const int16_t y2 = *y + textsize_y * 8 - 1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        if (*x < *minx) *minx = *x;
+        if (*y < *miny) *miny = *y;
+        *x += textsize_x * 6;
+    }
+}
+
+void Adafruit_GFX::getTextBounds(const char* s, int16_t x, int16_t y,
+                                 int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+
+    uint8_t c;
+    while ((c = (uint8_t)*s++)) charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+
+    if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+    if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
+
+void Adafruit_GFX::getTextBounds(const String& s, int16_t x, int16_t y,
+                                 int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(s.c_str(), x, y, x1, y1, w, h);
+}
+
+void Adafruit_GFX::setTextSize(uint8_t s) {
+    setTextSize(s, s);
+}
+
+void Adafruit_GFX::setTextSize(uint8_t sx, uint8_t sy) {
+    textsize_x = sx > 0 ? sx : 1;
+    textsize_y = sy > 0 ? sy : 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont* f) {
+    if (f) {
+        if (!gfxFont) cursor_y += 6;
+    } else if (gfxFont) {
+        cursor_y -= 6;
+    }
+    gfxFont = const_cast<GFXfont*>(f);
+}
+
+// ============================================================================
+// холсты
+// ============================================================================
+static void rotateCanvas(uint8_t rotation, int16_t W, int16_t H, int16_t& x, int16_t& y) {
+    int16_t t;
+    switch (rotation) {
+        case 1: t = x; x = W - 1 - y; y = t; break;
+        case 2: x = W - 1 - x; y = H - 1 - y; break;
+        case 3: t = x; x = y; y = H - 1 - t; break;
+        default: break;
+    }
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h)
+    : Adafruit_GFX(w, h)
+{
+    const size_t bytes = (size_t)((w + 7) / 8) * h;
+    buffer = (uint8_t*)calloc(bytes, 1);
+}
+
+GFXcanvas1::~GFXcanvas1() {
+    free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!buffer) return;
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    rotateCanvas(rotation, WIDTH, HEIGHT, x, y);
+
+    uint8_t* p = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color) *p |=  (uint8_t)(0x80 >> (x & 7));
+    else       *p &= (uint8_t)~(0x80 >> (x & 7));
+}
+
+void GFXcanvas1::fillScreen(uint16_t color) {
+    if (!buffer) return;
+    memset(buffer, color ? 0xFF : 0x00, (size_t)((WIDTH + 7) / 8) * HEIGHT);
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+    if (!buffer) return false;
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return false;
+    rotateCanvas(rotation, WIDTH, HEIGHT, x, y);
+    return (buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7))) != 0;
+}
+
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h)
+    : Adafruit_GFX(w, h)
+{
+    buffer = (uint16_t*)calloc((size_t)w * h, sizeof(uint16_t));
+}
+
+GFXcanvas16::~GFXcanvas16() {
+    free(buffer);
+}
+
+void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!buffer) return;
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    rotateCanvas(rotation, WIDTH, HEIGHT, x, y);
+    buffer[x + y * WIDTH] = color;
+}
+
+void GFXcanvas16::fillScreen(uint16_t color) {
+    if (!buffer) return;
+    const size_t n = (size_t)WIDTH * HEIGHT;
+    for (size_t i = 0; i < n; i++) buffer[i] = color;
+}
+
+uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const {
+    if (!buffer) return 0;
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    rotateCanvas(rotation, WIDTH, HEIGHT, x, y);
+    return buffer[x + y * WIDTH];
+}
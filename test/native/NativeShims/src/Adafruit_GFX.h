@@ -0,0 +1,158 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*
+ * Adafruit_GFX (env:native)
+ * -------------------------
+ * Подмножество Adafruit GFX Library, которым пользуются экраны и UiDisplay.
+ *
+ * Повторяет семантику оригинала там, где от неё зависит картинка
+ * и трафик:
+ *  - цепочки виртуальных примитивов (fillRect → writeFastVLine,
+ *    drawChar → writePixel / writeFillRect / writeFastVLine, ...)
+ *  - классический шрифт 5x7: drawChar / write / getTextBounds,
+ *    включая сдвиг "c >= 176" без cp437
+ *  - fillCircle (+ fillCircleHelper), drawBitmap, drawRGBBitmap
+ *  - сдвиг курсора в setFont()
+ *
+ * GFXfont-шрифты не растеризуются (в прошивке только setFont(nullptr)).
+ */
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t  width;
+    uint8_t  height;
+    uint8_t  xAdvance;
+    int8_t   xOffset;
+    int8_t   yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t*  bitmap;
+    GFXglyph* glyph;
+    uint16_t  first;
+    uint16_t  last;
+    uint8_t   yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    virtual ~Adafruit_GFX() = default;
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    // ===== транзакционные примитивы =====
+    virtual void startWrite();
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color);
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void endWrite();
+
+    // ===== примитивы =====
+    virtual void setRotation(uint8_t r);
+    virtual void invertDisplay(bool) {}
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillScreen(uint16_t color);
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                          uint8_t corners, int16_t delta, uint16_t color);
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                    int16_t w, int16_t h, uint16_t color);
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                       int16_t w, int16_t h);
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                       int16_t w, int16_t h);
+
+    // ===== текст =====
+    void drawChar(int16_t x, int16_t y, unsigned char c,
+                  uint16_t color, uint16_t bg, uint8_t size);
+    void drawChar(int16_t x, int16_t y, unsigned char c,
+                  uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY);
+
+    void getTextBounds(const char* s, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+    void getTextBounds(const String& s, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+
+    void setTextSize(uint8_t s);
+    void setTextSize(uint8_t sx, uint8_t sy);
+    void setFont(const GFXfont* f = nullptr);
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c)              { textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+    void setTextWrap(bool w) { wrap = w; }
+    void cp437(bool x = true) { _cp437 = x; }
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+
+    int16_t width()  const { return _width; }
+    int16_t height() const { return _height; }
+    uint8_t getRotation() const { return rotation; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+
+protected:
+    void charBounds(unsigned char c, int16_t* x, int16_t* y,
+                    int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy);
+
+    int16_t  WIDTH;
+    int16_t  HEIGHT;
+    int16_t  _width;
+    int16_t  _height;
+    int16_t  cursor_x;
+    int16_t  cursor_y;
+    uint16_t textcolor;
+    uint16_t textbgcolor;
+    uint8_t  textsize_x;
+    uint8_t  textsize_y;
+    uint8_t  rotation;
+    bool     wrap;
+    bool     _cp437;
+    GFXfont* gfxFont;
+};
+
+// ============================================================================
+// холсты в RAM
+// ============================================================================
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+    GFXcanvas1(uint16_t w, uint16_t h);
+    ~GFXcanvas1();
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    bool     getPixel(int16_t x, int16_t y) const;
+    uint8_t* getBuffer() const { return buffer; }
+
+private:
+    uint8_t* buffer;
+};
+
+class GFXcanvas16 : public Adafruit_GFX {
+public:
+    GFXcanvas16(uint16_t w, uint16_t h);
+    ~GFXcanvas16();
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+    uint16_t  getPixel(int16_t x, int16_t y) const;
+    uint16_t* getBuffer() const { return buffer; }
+
+private:
+    uint16_t* buffer;
+};
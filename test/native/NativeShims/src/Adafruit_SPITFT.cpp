@@ -0,0 +1,166 @@
+#include "Adafruit_SPITFT.h"
+
+// ============================================================================
+// ctor
+// ============================================================================
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst)
+    : Adafruit_GFX((int16_t)w, (int16_t)h)
+{
+    (void)cs;
+    (void)dc;
+    (void)rst;
+    _panel = (uint16_t*)calloc((size_t)w * h, sizeof(uint16_t));
+}
+
+Adafruit_SPITFT::~Adafruit_SPITFT() {
+    free(_panel);
+}
+
+// ============================================================================
+// транзакции
+// ============================================================================
+void Adafruit_SPITFT::startWrite() {
+    if (_inWrite) _errors++;
+    _inWrite = true;
+}
+
+void Adafruit_SPITFT::endWrite() {
+    if (!_inWrite) _errors++;
+    _inWrite = false;
+}
+
+// ============================================================================
+// панель
+// ============================================================================
+void Adafruit_SPITFT::panelWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (!_inWrite) _errors++;
+    _winX = x;
+    _winY = y;
+    _winW = w;
+    _winH = h;
+    _curX = 0;
+    _curY = 0;
+}
+
+void Adafruit_SPITFT::panelPut(uint16_t color) {
+    if (!_inWrite) _errors++;
+    if (_winW == 0 || _winH == 0) return;
+
+    const int32_t x = (int32_t)_winX + _curX;
+    const int32_t y = (int32_t)_winY + _curY;
+    if (x < _width && y < _height) {
+        _panel[y * _width + x] = color;
+        _panelPixels++;
+    }
+
+    if (++_curX >= _winW) {
+        _curX = 0;
+        if (++_curY >= _winH) _curY = 0;
+    }
+}
+
+// ============================================================================
+// примитивы внутри транзакции
+// ============================================================================
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
+    if (x >= 0 && x < _width && y >= 0 && y < _height) {
+        setAddrWindow(x, y, 1, 1);
+        panelPut(color);
+    }
+}
+
+void Adafruit_SPITFT::writePixel(uint16_t color) {
+    panelPut(color);
+}
+
+void Adafruit_SPITFT::writePixels(uint16_t* colors, uint32_t len, bool block, bool bigEndian) {
+    (void)block;
+    for (uint32_t i = 0; i < len; i++) {
+        const uint16_t c = colors[i];
+        panelPut(bigEndian ? (uint16_t)((c >> 8) | (c << 8)) : c);
+    }
+}
+
+void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) panelPut(color);
+}
+
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w && h) {
+        if (w < 0) { x += w + 1; w = -w; }
+        if (x < _width) {
+            if (h < 0) { y += h + 1; h = -h; }
+            if (y < _height) {
+                int16_t x2 = x + w - 1;
+                if (x2 >= 0) {
+                    int16_t y2 = y + h - 1;
+                    if (y2 >= 0) {
+                        if (x < 0) { x = 0; w = x2 + 1; }
+                        if (y < 0) { y = 0; h = y2 + 1; }
+                        if (x2 >= _width)  w = _width - x;
+                        if (y2 >= _height) h = _height - y;
+                        writeFillRectPreclipped(x, y, w, h, color);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (y >= 0 && y < _height && w) {
+        if (w < 0) { x += w + 1; w = -w; }
+        if (x < _width) {
+            int16_t x2 = x + w - 1;
+            if (x2 >= 0) {
+                if (x < 0) { x = 0; w = x2 + 1; }
+                if (x2 >= _width) w = _width - x;
+                writeFillRectPreclipped(x, y, w, 1, color);
+            }
+        }
+    }
+}
+
+void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (x >= 0 && x < _width && h) {
+        if (h < 0) { y += h + 1; h = -h; }
+        if (y < _height) {
+            int16_t y2 = y + h - 1;
+            if (y2 >= 0) {
+                if (y < 0) { y = 0; h = y2 + 1; }
+                if (y2 >= _height) h = _height - y;
+                writeFillRectPreclipped(x, y, 1, h, color);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// самостоятельные примитивы
+// ============================================================================
+void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x >= 0 && x < _width && y >= 0 && y < _height) {
+        startWrite();
+        setAddrWindow(x, y, 1, 1);
+        panelPut(color);
+        endWrite();
+    }
+}
+
+void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFillRect(x, y, w, h, color);
+    endWrite();
+}
+
+void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    endWrite();
+}
+
+void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastVLine(x, y, h, color);
+    endWrite();
+}
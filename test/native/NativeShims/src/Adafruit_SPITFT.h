@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+
+/*
+ * Adafruit_SPITFT (env:native)
+ * ----------------------------
+ * SPI-дисплей без SPI: всё, что ушло бы в шину, пишется в модель
+ * панели — буфер RGB565 в логических (повёрнутых) координатах.
+ *
+ * Модель панели:
+ *  - setAddrWindow() (Adafruit_ST77xx) задаёт окно, пиксели идут
+ *    построчно от его угла и по концу окна заворачиваются к началу,
+ *    как RAMWR у ST7735
+ *  - пиксели вне экрана отбрасываются
+ *
+ * Проверки протокола (nativeErrors):
+ *  - пиксели / окно вне startWrite()..endWrite()
+ *  - вложенный startWrite(): на ESP32 SPI.beginTransaction() берёт
+ *    нерекурсивный мьютекс — устройство бы зависло
+ *
+ * Примитивы и их порядок вызовов — как в оригинале (ESP32, без DMA):
+ * от этого зависят счётчики трафика UiDisplay.
+ */
+class Adafruit_SPITFT : public Adafruit_GFX {
+public:
+    Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst);
+    ~Adafruit_SPITFT();
+
+    virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+    // ===== транзакции =====
+    void startWrite() override;
+    void endWrite() override;
+
+    // ===== примитивы внутри транзакции =====
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(uint16_t color);
+    void writePixels(uint16_t* colors, uint32_t len,
+                     bool block = true, bool bigEndian = false);
+    void writeColor(uint16_t color, uint32_t len);
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+    inline void writeFillRectPreclipped(int16_t x, int16_t y,
+                                        int16_t w, int16_t h, uint16_t color) {
+        setAddrWindow(x, y, w, h);
+        writeColor(color, (uint32_t)w * h);
+    }
+
+    void dmaWait() {}
+
+    // ===== самостоятельные примитивы =====
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+        return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+    }
+
+    // ===== модель панели (только env:native) =====
+    // Кадр панели: width() * height(), строки подряд
+    const uint16_t* nativeFrame() const { return _panel; }
+
+    // Пикселей, записанных в RAM панели (монотонно)
+    uint32_t nativePixels() const { return _panelPixels; }
+
+    // Нарушения протокола SPI (монотонно)
+    uint32_t nativeErrors() const { return _errors; }
+
+protected:
+    // Окно в логических координатах (Adafruit_ST77xx::setAddrWindow)
+    void panelWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+private:
+    void panelPut(uint16_t color);
+
+    bool _inWrite = false;
+
+    uint16_t* _panel;
+    uint16_t  _winX = 0, _winY = 0, _winW = 0, _winH = 0;
+    uint16_t  _curX = 0, _curY = 0;
+
+    uint32_t _panelPixels = 0;
+    uint32_t _errors      = 0;
+};
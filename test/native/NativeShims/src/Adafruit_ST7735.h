@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Adafruit_ST77xx.h"
+
+#define INITR_GREENTAB   0x00
+#define INITR_REDTAB     0x01
+#define INITR_BLACKTAB   0x02
+#define INITR_18GREENTAB INITR_GREENTAB
+#define INITR_18REDTAB   INITR_REDTAB
+#define INITR_18BLACKTAB INITR_BLACKTAB
+#define INITR_144GREENTAB 0x01
+#define INITR_MINI160x80  0x04
+
+#define ST7735_BLACK   ST77XX_BLACK
+#define ST7735_WHITE   ST77XX_WHITE
+#define ST7735_RED     ST77XX_RED
+#define ST7735_GREEN   ST77XX_GREEN
+#define ST7735_BLUE    ST77XX_BLUE
+#define ST7735_CYAN    ST77XX_CYAN
+#define ST7735_MAGENTA ST77XX_MAGENTA
+#define ST7735_YELLOW  ST77XX_YELLOW
+#define ST7735_ORANGE  ST77XX_ORANGE
+
+/*
+ * Adafruit_ST7735 (env:native) — панель 128x160, как 1.8" BLACKTAB.
+ */
+class Adafruit_ST7735 : public Adafruit_ST77xx {
+public:
+    Adafruit_ST7735(int8_t cs, int8_t dc, int8_t rst)
+        : Adafruit_ST77xx(128, 160, cs, dc, rst) {}
+
+    void initR(uint8_t options = INITR_GREENTAB) { (void)options; }
+};
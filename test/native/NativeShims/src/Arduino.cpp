@@ -0,0 +1,176 @@
+#include "Arduino.h"
+#include "Native.h"
+
+#include <atomic>
+
+// ============================================================================
+// часы
+// ============================================================================
+static std::atomic<uint64_t> g_us{ 0 };
+
+// Системное время: epoch в момент g_epochAtUs
+static std::atomic<int64_t>  g_epoch{ 0 };
+static std::atomic<uint64_t> g_epochAtUs{ 0 };
+
+extern "C" time_t native_epoch_now(void) {
+    const uint64_t since = g_us.load() - g_epochAtUs.load();
+    return (time_t)(g_epoch.load() + (int64_t)(since / 1000000u));
+}
+
+extern "C" void native_set_epoch(time_t utc) {
+    g_epochAtUs.store(g_us.load());
+    g_epoch.store((int64_t)utc);
+}
+
+namespace Native {
+
+void     setUs(uint64_t us)     { g_us.store(us); }
+void     advanceUs(uint64_t us) { g_us.fetch_add(us); }
+void     advanceMs(uint32_t ms) { g_us.fetch_add((uint64_t)ms * 1000u); }
+uint64_t nowUs()                { return g_us.load(); }
+
+void   setEpoch(time_t utc) { native_set_epoch(utc); }
+time_t epoch()              { return native_epoch_now(); }
+
+}
+
+unsigned long millis() { return (unsigned long)(uint32_t)(g_us.load() / 1000u); }
+unsigned long micros() { return (unsigned long)(uint32_t)g_us.load(); }
+
+void delay(uint32_t ms)              { Native::advanceMs(ms); }
+void delayMicroseconds(uint32_t us)  { Native::advanceUs(us); }
+void yield() {}
+
+// ============================================================================
+// пины
+// ============================================================================
+void pinMode(uint8_t, uint8_t) {}
+int  digitalRead(uint8_t) { return HIGH; }
+void digitalWrite(uint8_t, uint8_t) {}
+
+void attachInterruptArg(uint8_t, void (*)(void*), void*, int) {}
+void detachInterrupt(uint8_t) {}
+
+uint32_t getCpuFrequencyMhz() { return 240; }
+
+// ============================================================================
+// esp32-hal-time: TZ строится так же, как на устройстве
+// ============================================================================
+static void setTimeZone(long offset, int daylight) {
+    // Худший случай: "UTC" + long + ":%02u:%02u" с unsigned во всю ширину
+    char cst[48] = { 0 };
+    char cdt[48] = "DST";
+    char tz[96]  = { 0 };
+
+    if (offset % 3600) {
+        snprintf(cst, sizeof(cst), "UTC%ld:%02u:%02u", offset / 3600,
+                 (unsigned)labs((offset % 3600) / 60), (unsigned)labs(offset % 60));
+    } else {
+        snprintf(cst, sizeof(cst), "UTC%ld", offset / 3600);
+    }
+
+    if (daylight != 3600) {
+        const long dst = offset - daylight;
+        if (dst % 3600) {
+            snprintf(cdt, sizeof(cdt), "DST%ld:%02u:%02u", dst / 3600,
+                     (unsigned)labs((dst % 3600) / 60), (unsigned)labs(dst % 60));
+        } else {
+            snprintf(cdt, sizeof(cdt), "DST%ld", dst / 3600);
+        }
+    }
+
+    snprintf(tz, sizeof(tz), "%s%s", cst, cdt);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec,
+                const char*, const char*, const char*) {
+    setTimeZone(-gmtOffsetSec, daylightOffsetSec);
+}
+
+// Часы не идут сами — ждать нечего
+bool getLocalTime(struct tm* info, uint32_t) {
+    const time_t now = native_epoch_now();
+    localtime_r(&now, info);
+    return info->tm_year > (2016 - 1900);
+}
+
+// ============================================================================
+// Print
+// ============================================================================
+size_t Print::write(const uint8_t* buf, size_t n) {
+    size_t out = 0;
+    while (n--) out += write(*buf++);
+    return out;
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char    local[64];
+    char*   buf = local;
+
+    va_list args;
+    va_start(args, fmt);
+    va_list copy;
+    va_copy(copy, args);
+    const int len = vsnprintf(local, sizeof(local), fmt, copy);
+    va_end(copy);
+
+    if (len < 0) {
+        va_end(args);
+        return 0;
+    }
+
+    if ((size_t)len >= sizeof(local)) {
+        buf = static_cast<char*>(malloc((size_t)len + 1));
+        if (!buf) {
+            va_end(args);
+            return 0;
+        }
+        vsnprintf(buf, (size_t)len + 1, fmt, args);
+    }
+    va_end(args);
+
+    const size_t out = write(reinterpret_cast<const uint8_t*>(buf), (size_t)len);
+    if (buf != local) free(buf);
+    return out;
+}
+
+size_t Print::printNumber(long n, int base) {
+    if (base == DEC) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%ld", n);
+        return write(buf);
+    }
+    return printUnsigned((unsigned long)n, base);
+}
+
+size_t Print::printUnsigned(unsigned long n, int base) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), base == HEX ? "%lX" : "%lu", n);
+    return write(buf);
+}
+
+size_t Print::print(double v, int digits) {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+}
+
+// ============================================================================
+// Serial / ESP
+// ============================================================================
+HardwareSerial Serial;
+EspClass       ESP;
+
+size_t HardwareSerial::write(uint8_t c) {
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t n) {
+    return fwrite(buf, 1, n, stdout);
+}
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t)(g_us.load() * 240u);
+}
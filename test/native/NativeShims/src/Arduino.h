@@ -0,0 +1,123 @@
+#pragma once
+
+/*
+ * Arduino.h (env:native)
+ * ----------------------
+ * Подмножество ядра Arduino-ESP32, на котором собираются ScreenManager,
+ * экраны, UiDisplay и сервисы для тестов на хосте.
+ *
+ * Отличия от устройства:
+ *  - millis() / micros() — виртуальные часы (Native.h): двигает тест,
+ *    кадры и анимации детерминированы
+ *  - time() / getLocalTime() — от тех же часов (native_time.c)
+ *  - пины, прерывания, LEDC — пустышки
+ *  - Serial — в stdout
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "WString.h"
+#include "Print.h"
+
+// Как в arduino-esp32 (Arduino.h): std::min / max вместо макросов
+using std::abs;
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#define constrain(amt, low, high) \
+    ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define digitalPinToInterrupt(p) (p)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ===== время =====
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// ===== пины (пустышки) =====
+void pinMode(uint8_t pin, uint8_t mode);
+int  digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+void attachInterruptArg(uint8_t pin, void (*fn)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// ===== esp32-hal-time =====
+void configTime(long gmtOffsetSec, int daylightOffsetSec,
+                const char* server1,
+                const char* server2 = nullptr,
+                const char* server3 = nullptr);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+uint32_t getCpuFrequencyMhz();
+
+// ===== Serial =====
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    int  available() { return 0; }
+    int  read()      { return -1; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t n) override;
+    using Print::write;
+
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// ===== ESP =====
+class EspClass {
+public:
+    uint32_t getFreeHeap()    { return 200u * 1024u; }
+    uint32_t getMinFreeHeap() { return 180u * 1024u; }
+    uint32_t getMaxAllocHeap() { return 110u * 1024u; }
+    uint32_t getCycleCount();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define DHT11 11
+#define DHT22 22
+
+/*
+ * DHT (env:native) — показания задаёт Native::setDht().
+ */
+class DHT {
+public:
+    DHT(uint8_t pin, uint8_t type) { (void)pin; (void)type; }
+
+    void  begin() {}
+    float readTemperature();
+    float readHumidity();
+};
@@ -0,0 +1,116 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Объекты задач не освобождаются: detached-поток может ждать
+// уведомления и во время выхода из процесса
+struct NativeTask {
+    std::mutex              m;
+    std::condition_variable cv;
+    uint32_t                notify = 0;
+};
+
+struct NativeMutex {
+    std::timed_mutex m;
+};
+
+static thread_local NativeTask* t_current = nullptr;
+
+// ============================================================================
+// tasks
+// ============================================================================
+BaseType_t xTaskCreatePinnedToCore(
+    TaskFunction_t fn,
+    const char*,
+    uint32_t,
+    void*          arg,
+    UBaseType_t,
+    TaskHandle_t*  outHandle,
+    BaseType_t
+) {
+    NativeTask* t = new NativeTask();
+    if (outHandle) *outHandle = t;
+
+    std::thread([t, fn, arg] {
+        t_current = t;
+        fn(arg);
+    }).detach();
+
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    if (!t_current) t_current = new NativeTask();
+    return t_current;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> lock(task->m);
+        task->notify++;
+    }
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    xTaskNotifyGive(task);
+    if (woken) *woken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    NativeTask* t = xTaskGetCurrentTaskHandle();
+
+    std::unique_lock<std::mutex> lock(t->m);
+    const auto ready = [t] { return t->notify > 0; };
+
+    if (ticks == portMAX_DELAY) {
+        t->cv.wait(lock, ready);
+    } else if (!t->cv.wait_for(lock, std::chrono::milliseconds(ticks), ready)) {
+        return 0;
+    }
+
+    const uint32_t v = t->notify;
+    t->notify = clearOnExit ? 0 : v - 1;
+    return v;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) {
+    return 0;
+}
+
+BaseType_t xPortGetCoreID() {
+    return 1;
+}
+
+// ============================================================================
+// mutex
+// ============================================================================
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new NativeMutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t ticks) {
+    if (!m) return pdFAIL;
+    if (ticks == portMAX_DELAY) {
+        m->m.lock();
+        return pdTRUE;
+    }
+    return m->m.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m) {
+    if (!m) return pdFAIL;
+    m->m.unlock();
+    return pdTRUE;
+}
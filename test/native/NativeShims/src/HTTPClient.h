@@ -0,0 +1,23 @@
+#pragma once
+
+#include <WiFi.h>
+
+/*
+ * HTTPClient (env:native)
+ * -----------------------
+ * Любой GET получает ответ, заданный Native::setHttpResponse().
+ */
+
+#define HTTP_CODE_OK 200
+
+class HTTPClient {
+public:
+    bool begin(WiFiClient& client, const String& url);
+    int  GET();
+    void end() {}
+
+    WiFiClient& getStream() { return *_client; }
+
+private:
+    WiFiClient* _client = nullptr;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Native
+ * ------
+ * Ручки тестов к "железу" env:native.
+ *
+ * Часы:
+ *  - один виртуальный счётчик мкс: millis(), micros(), time(),
+ *    getLocalTime(); сам НЕ идёт — его двигает тест (delay() тоже)
+ *  - setEpoch() — что показывают системные часы в текущий момент
+ *    (settimeofday() из TimeService делает то же самое)
+ *
+ * Периферия:
+ *  - Wi-Fi: статус / RSSI / SSID, которые увидят WifiService и StatusBar
+ *  - HTTP: ответ на любой GET (ForecastService)
+ *  - DHT: показания датчика
+ *
+ * Потоки: часы атомарные — ForecastTask (std::thread) читает их
+ * параллельно с тестом.
+ */
+namespace Native {
+
+// ===== часы =====
+void     setUs(uint64_t us);
+void     advanceUs(uint64_t us);
+void     advanceMs(uint32_t ms);
+uint64_t nowUs();
+
+void   setEpoch(time_t utc);
+time_t epoch();
+
+// ===== Wi-Fi =====
+// status — значение wl_status_t
+void setWifi(int status, int32_t rssi, const char* ssid);
+
+// ===== HTTP =====
+// body копируется; nullptr — пустой ответ
+void setHttpResponse(int code, const char* body);
+uint32_t httpRequests();
+
+// ===== DHT =====
+// NAN — чтение не удалось
+void setDht(float temperature, float humidity);
+
+}
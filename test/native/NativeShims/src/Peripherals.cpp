@@ -0,0 +1,126 @@
+#include "Native.h"
+
+#include <DHT.h>
+#include <HTTPClient.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <Wire.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+// ============================================================================
+// состояние (ForecastTask читает HTTP из своего потока)
+// ============================================================================
+namespace {
+
+std::mutex g_lock;
+
+int         g_wifiStatus = WL_DISCONNECTED;
+int32_t     g_rssi       = 0;
+std::string g_ssid;
+
+int         g_httpCode = 0;
+std::string g_httpBody;
+std::atomic<uint32_t> g_httpRequests{ 0 };
+
+float g_temperature = NAN;
+float g_humidity    = NAN;
+
+}
+
+WiFiClass WiFi;
+TwoWire   Wire;
+SPIClass  SPI;
+
+namespace Native {
+
+void setWifi(int status, int32_t rssi, const char* ssid) {
+    std::lock_guard<std::mutex> lock(g_lock);
+    g_wifiStatus = status;
+    g_rssi       = rssi;
+    g_ssid       = ssid ? ssid : "";
+}
+
+void setHttpResponse(int code, const char* body) {
+    std::lock_guard<std::mutex> lock(g_lock);
+    g_httpCode = code;
+    g_httpBody = body ? body : "";
+}
+
+uint32_t httpRequests() {
+    return g_httpRequests.load();
+}
+
+void setDht(float temperature, float humidity) {
+    std::lock_guard<std::mutex> lock(g_lock);
+    g_temperature = temperature;
+    g_humidity    = humidity;
+}
+
+}
+
+// ============================================================================
+// WiFi
+// ============================================================================
+wl_status_t WiFiClass::status() {
+    std::lock_guard<std::mutex> lock(g_lock);
+    return (wl_status_t)g_wifiStatus;
+}
+
+String WiFiClass::SSID() {
+    std::lock_guard<std::mutex> lock(g_lock);
+    return String(g_ssid.c_str());
+}
+
+int32_t WiFiClass::RSSI() {
+    std::lock_guard<std::mutex> lock(g_lock);
+    return g_rssi;
+}
+
+String           WiFiClass::SSID(uint8_t)           { return String(""); }
+int32_t          WiFiClass::RSSI(uint8_t)           { return 0; }
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t) { return WIFI_AUTH_OPEN; }
+
+int16_t WiFiClass::scanNetworks(bool, bool, bool, uint32_t) { return WIFI_SCAN_FAILED; }
+int16_t WiFiClass::scanComplete()                           { return WIFI_SCAN_FAILED; }
+void    WiFiClass::scanDelete() {}
+
+wl_status_t WiFiClass::begin(const char*, const char*) { return status(); }
+wl_status_t WiFiClass::begin()                         { return status(); }
+bool        WiFiClass::disconnect(bool, bool)          { return true; }
+
+bool WiFiClass::mode(wifi_mode_t)   { return true; }
+bool WiFiClass::setAutoConnect(bool)   { return true; }
+bool WiFiClass::setAutoReconnect(bool) { return true; }
+
+// ============================================================================
+// HTTP
+// ============================================================================
+bool HTTPClient::begin(WiFiClient& client, const String&) {
+    _client = &client;
+    return true;
+}
+
+int HTTPClient::GET() {
+    g_httpRequests.fetch_add(1);
+
+    // Тело живёт в g_httpBody; тест не меняет ответ во время запроса
+    std::lock_guard<std::mutex> lock(g_lock);
+    if (_client) _client->attach(g_httpBody.data(), g_httpBody.size());
+    return g_httpCode;
+}
+
+// ============================================================================
+// DHT
+// ============================================================================
+float DHT::readTemperature() {
+    std::lock_guard<std::mutex> lock(g_lock);
+    return g_temperature;
+}
+
+float DHT::readHumidity() {
+    std::lock_guard<std::mutex> lock(g_lock);
+    return g_humidity;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+
+/*
+ * Print / Stream (env:native)
+ * ---------------------------
+ * Как в arduino-esp32: printf() форматирует в буфер и отдаёт его ОДНИМ
+ * write(buf, n) — на этом держатся текстовые спаны UiDisplay.
+ */
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t n);
+
+    size_t write(const char* s) {
+        return s ? write(reinterpret_cast<const uint8_t*>(s), strlen(s)) : 0;
+    }
+    size_t write(const char* buf, size_t n) {
+        return write(reinterpret_cast<const uint8_t*>(buf), n);
+    }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    size_t print(const char* s)      { return write(s); }
+    size_t print(const String& s)    { return write(s.c_str()); }
+    size_t print(char c)             { return write((uint8_t)c); }
+    size_t print(int n, int base = DEC)           { return printNumber((long)n, base); }
+    size_t print(unsigned n, int base = DEC)      { return printUnsigned(n, base); }
+    size_t print(long n, int base = DEC)          { return printNumber(n, base); }
+    size_t print(unsigned long n, int base = DEC) { return printUnsigned(n, base); }
+    size_t print(double v, int digits = 2);
+
+    size_t println()                 { return write("\r\n"); }
+    size_t println(const char* s)    { return print(s) + println(); }
+    size_t println(const String& s)  { return print(s) + println(); }
+    size_t println(char c)           { return print(c) + println(); }
+    size_t println(int n, int base = DEC)           { return print(n, base) + println(); }
+    size_t println(unsigned n, int base = DEC)      { return print(n, base) + println(); }
+    size_t println(long n, int base = DEC)          { return print(n, base) + println(); }
+    size_t println(unsigned long n, int base = DEC) { return print(n, base) + println(); }
+    size_t println(double v, int digits = 2)        { return print(v, digits) + println(); }
+
+    virtual void flush() {}
+
+private:
+    size_t printNumber(long n, int base);
+    size_t printUnsigned(unsigned long n, int base);
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char* buf, size_t n) {
+        size_t got = 0;
+        while (got < n) {
+            const int c = read();
+            if (c < 0) break;
+            buf[got++] = (char)c;
+        }
+        return got;
+    }
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Arduino.h>
+
+class SPIClass {
+public:
+    void begin() {}
+};
+
+extern SPIClass SPI;
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+/*
+ * String (env:native) — ровно то, что нужно исходникам:
+ * склейка URL (ForecastService), SSID из WiFi.
+ */
+class String {
+public:
+    String(const char* s = "") : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned    length() const { return (unsigned)_s.size(); }
+
+    String& operator+=(const String& o) { _s += o._s; return *this; }
+    String& operator+=(const char* o)   { _s += (o ? o : ""); return *this; }
+
+    bool operator==(const String& o) const { return _s == o._s; }
+    bool operator!=(const String& o) const { return _s != o._s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const char* a, const String& b)   { return String(std::string(a) + b._s); }
+    friend String operator+(const String& a, const char* b)   { return String(a._s + b); }
+
+private:
+    std::string _s;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*
+ * WiFi (env:native)
+ * -----------------
+ * Состояние линка задаёт тест (Native::setWifi). Скан сразу
+ * "проваливается", подключение ничего не меняет.
+ */
+
+typedef enum {
+    WL_NO_SHIELD       = 255,
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_SCAN_COMPLETED  = 2,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED    = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA
+} wifi_mode_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK
+} wifi_auth_mode_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+class WiFiClass {
+public:
+    wl_status_t status();
+
+    String  SSID();
+    int32_t RSSI();
+
+    String           SSID(uint8_t i);
+    int32_t          RSSI(uint8_t i);
+    wifi_auth_mode_t encryptionType(uint8_t i);
+
+    int16_t scanNetworks(bool async = false, bool showHidden = false,
+                         bool passive = false, uint32_t maxMsPerChan = 300);
+    int16_t scanComplete();
+    void    scanDelete();
+
+    wl_status_t begin(const char* ssid, const char* pass = nullptr);
+    wl_status_t begin();
+    bool        disconnect(bool wifiOff = false, bool eraseAp = false);
+
+    bool mode(wifi_mode_t m);
+    bool setAutoConnect(bool on);
+    bool setAutoReconnect(bool on);
+};
+
+extern WiFiClass WiFi;
+
+// ============================================================================
+// клиент: поток тела ответа (HTTPClient::getStream)
+// ============================================================================
+class WiFiClient : public Stream {
+public:
+    void attach(const char* data, size_t n) { _data = data; _n = n; _pos = 0; }
+
+    int available() override { return (int)(_n - _pos); }
+    int read() override      { return _pos < _n ? (uint8_t)_data[_pos++] : -1; }
+    int peek() override      { return _pos < _n ? (uint8_t)_data[_pos]   : -1; }
+
+    size_t write(uint8_t) override { return 0; }
+    using Print::write;
+
+private:
+    const char* _data = nullptr;
+    size_t      _n    = 0;
+    size_t      _pos  = 0;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*
+ * Wire (env:native) — шина без устройств: EEPROM настроек пуст,
+ * PreferencesService стартует с настройками по умолчанию.
+ */
+class TwoWire {
+public:
+    bool    begin() { return true; }
+    void    beginTransmission(uint8_t) {}
+    size_t  write(uint8_t) { return 1; }
+    uint8_t endTransmission(bool = true) { return 0; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    int     available() { return 0; }
+    int     read() { return -1; }
+};
+
+extern TwoWire Wire;
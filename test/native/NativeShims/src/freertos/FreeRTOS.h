@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * FreeRTOS (env:native)
+ * ---------------------
+ * Задача — std::thread, уведомление задачи — счётчик под
+ * condition_variable, мьютекс — std::mutex. Тики = мс.
+ *
+ * Ожидание с таймаутом идёт по РЕАЛЬНОМУ времени хоста: тесты
+ * не зовут Scheduler::idle(), а ForecastTask ждёт без таймаута.
+ */
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+
+struct NativeTask;
+typedef NativeTask* TaskHandle_t;
+
+struct NativeMutex;
+typedef NativeMutex* SemaphoreHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  1
+#define pdFAIL  0
+
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define portYIELD_FROM_ISR(...) do {} while (0)
+
+BaseType_t xPortGetCoreID();
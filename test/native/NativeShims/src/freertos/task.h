@@ -0,0 +1,25 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreatePinnedToCore(
+    TaskFunction_t fn,
+    const char*    name,
+    uint32_t       stackBytes,
+    void*          arg,
+    UBaseType_t    priority,
+    TaskHandle_t*  outHandle,
+    BaseType_t     core
+);
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void       vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t   ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+
+void vTaskDelay(TickType_t ticks);
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * glcdfont (env:native)
+ * ---------------------
+ * Классический шрифт GFX 5x7: 5 байт-столбцов на символ, бит 0 — верх.
+ * Нарисованы 0x20..0x7F и знак градуса (0xF8); остальные коды пустые —
+ * в прошивке они встречаются только в UTF-8 хвостах ("…").
+ */
+// 256 * 5 байт
+const uint8_t* glcdfont();
@@ -0,0 +1,29 @@
+/*
+ * native_time.c (env:native)
+ * --------------------------
+ * time() / settimeofday() хоста подменены виртуальными часами (Native.h):
+ * ForecastService считает "сегодня" через time(nullptr), TimeService
+ * ставит системное время через settimeofday(). Оба видят одно и то же
+ * время теста, а не часы машины CI.
+ *
+ * В C, а не в C++: объявления glibc несут noexcept, и определение
+ * с другой спецификацией в C++ не собирается.
+ */
+
+#include <time.h>
+#include <sys/time.h>
+
+time_t native_epoch_now(void);
+void   native_set_epoch(time_t utc);
+
+time_t time(time_t* out) {
+    const time_t now = native_epoch_now();
+    if (out) *out = now;
+    return now;
+}
+
+int settimeofday(const struct timeval* tv, const struct timezone* tz) {
+    (void)tz;
+    if (tv) native_set_epoch(tv->tv_sec);
+    return 0;
+}
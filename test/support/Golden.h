@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+ * Golden
+ * ------
+ * Сравнение кадра с эталонным PNG рядом с тестом.
+ *
+ *  - эталон: <папка теста>/golden/<name>.png (GOLDEN_DIR(__FILE__))
+ *  - нет эталона или UPDATE_GOLDENS=1 — кадр записывается как эталон
+ *    (тест не падает: новый эталон смотрят глазами и коммитят)
+ *  - расхождение — рядом пишется <name>.actual.png, в отчёте число
+ *    отличающихся пикселей и первый из них
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <vector>
+
+#include "Png.h"
+
+#define GOLDEN_DIR(file) (Golden::dirOf(file) + "/golden")
+
+namespace Golden {
+
+inline std::string dirOf(const char* file) {
+    const std::string f(file);
+    const size_t slash = f.find_last_of('/');
+    return slash == std::string::npos ? std::string(".") : f.substr(0, slash);
+}
+
+struct Result {
+    bool        ok;
+    std::string message;
+};
+
+inline Result check(const std::string& dir, const char* name,
+                    const uint16_t* px, int w, int h) {
+
+    const std::string path   = dir + "/" + name + ".png";
+    const std::string actual = dir + "/" + name + ".actual.png";
+
+    const char* update = getenv("UPDATE_GOLDENS");
+    std::vector<uint16_t> ref;
+    int rw = 0, rh = 0;
+
+    if ((update && update[0] == '1') || !Png::read(path, ref, rw, rh)) {
+        mkdir(dir.c_str(), 0755);
+        if (!Png::write(path, px, w, h)) return { false, "cannot write " + path };
+        remove(actual.c_str());
+        printf("[GOLDEN] wrote %s\n", path.c_str());
+        return { true, "" };
+    }
+
+    char msg[256];
+
+    if (rw != w || rh != h) {
+        Png::write(actual, px, w, h);
+        snprintf(msg, sizeof(msg), "%s: size %dx%d, golden %dx%d",
+                 name, w, h, rw, rh);
+        return { false, msg };
+    }
+
+    uint32_t diff  = 0;
+    int      first = -1;
+    for (int i = 0; i < w * h; i++) {
+        if (px[i] == ref[i]) continue;
+        if (first < 0) first = i;
+        diff++;
+    }
+
+    if (diff == 0) {
+        remove(actual.c_str());
+        return { true, "" };
+    }
+
+    Png::write(actual, px, w, h);
+    snprintf(msg, sizeof(msg),
+             "%s: %u px differ, first at (%d,%d) 0x%04X vs golden 0x%04X, see %s",
+             name, (unsigned)diff, first % w, first / w,
+             px[first], ref[first], actual.c_str());
+    return { false, msg };
+}
+
+}
@@ -0,0 +1,369 @@
+#pragma once
+
+/*
+ * NativeApp
+ * ---------
+ * Граф объектов прошивки (как в main.cpp) для тестов env:native
+ * и цикл loop() на виртуальных часах.
+ *
+ * Отличия от main.cpp:
+ *  - нет Buttons / RTC / NTP / подсветки: события кнопок подаёт
+ *    тест (press), время даёт FixedNtpProvider — один раз,
+ *    как NTP после синхронизации
+ *  - сервисы ядра 0 — inline (ServiceCore::runInline): один поток,
+ *    кадры детерминированы; ForecastTask — настоящий поток
+ *  - вместо сна loop() часы сдвигаются сразу к ближайшему дедлайну
+ *
+ * Мир теста (begin):
+ *  - 2024-01-15 10:42:07 по местному (UTC+2, настройки по умолчанию)
+ *  - Wi-Fi подключён (-58 dBm), DHT 22.4 °C / 41 %
+ *  - прогноз OpenWeather на 5 дней от "сегодня" (forecastJson)
+ *
+ * Глобальные объекты — inline: заголовок можно подключать в любое
+ * число файлов одного теста (SettingsScreen ждёт extern prefs).
+ */
+
+#include <Arduino.h>
+#include <Native.h>
+#include <WiFi.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "config/Pins.h"
+
+#include "core/AppController.h"
+#include "core/EventBus.h"
+#include "core/PowerManager.h"
+#include "core/Scheduler.h"
+#include "core/ScreenManager.h"
+#include "core/ServiceCore.h"
+#include "core/Timeline.h"
+
+#include "services/BrightnessService.h"
+#include "services/ColorTemperatureService.h"
+#include "services/ConnectivityService.h"
+#include "services/DhtService.h"
+#include "services/ForecastService.h"
+#include "services/LayoutService.h"
+#include "services/NightService.h"
+#include "services/NightTransitionService.h"
+#include "services/PreferencesService.h"
+#include "services/ThemeService.h"
+#include "services/TimeService.h"
+#include "services/WifiService.h"
+
+#include "ui/StatusBar.h"
+#include "ui/UiDebugOverlay.h"
+#include "ui/UiDisplay.h"
+#include "ui/UiSeparator.h"
+
+#include "screens/ClockScreen.h"
+#include "screens/ForecastScreen.h"
+#include "screens/SettingsScreen.h"
+
+namespace NativeApp {
+
+// 2024-01-15 08:42:07 UTC = 10:42:07 UTC+2
+static constexpr time_t EPOCH = 1705308127;
+
+// ============================================================================
+// время: "NTP" отдаёт системные часы теста один раз
+// ============================================================================
+class NoTimeProvider : public TimeProvider {
+public:
+    void       update() override {}
+    bool       hasTime() const override { return false; }
+    TimeResult takeTime() override { return TimeResult{}; }
+};
+
+class FixedNtpProvider : public TimeProvider {
+public:
+    void update() override {}
+    bool hasTime() const override { return !_taken; }
+
+    TimeResult takeTime() override {
+        _taken = true;
+        TimeResult r;
+        const time_t now = time(nullptr);
+        localtime_r(&now, &r.time);
+        r.valid = true;
+        return r;
+    }
+
+private:
+    bool _taken = false;
+};
+
+}
+
+// ============================================================================
+// объекты — порядок и связи как в main.cpp
+// ============================================================================
+inline UiDisplay  tft(TFT_CS, TFT_DC, TFT_RST);
+inline DhtService dht(DHT_PIN, DHT_TYPE);
+
+inline LayoutService layout(tft);
+inline EventBus bus;
+inline Timeline timeline;
+inline Scheduler scheduler;
+inline ServiceCore serviceCore;
+inline NightTransitionService nightTransition(timeline);
+inline ThemeService themeService(bus);
+
+inline PreferencesService prefs;
+inline NightService nightService(bus, prefs);
+
+inline ColorTemperatureService colorTemp;
+inline BrightnessService brightness;
+
+inline WifiService wifi(bus, prefs);
+
+inline ForecastService forecastService(bus, "native", "Kharkiv", "metric", "en");
+
+inline NativeApp::NoTimeProvider   rtcProvider;
+inline NativeApp::FixedNtpProvider ntpProvider;
+
+inline TimeService timeService(bus);
+
+inline StatusBar statusBar(tft, themeService, timeService, wifi);
+inline ButtonBar buttonBar(tft, themeService, layout);
+
+inline ConnectivityService connectivity(timeService);
+
+inline UiSeparator sepStatus(tft, themeService, layout);
+inline UiSeparator sepBottom(tft, themeService, layout);
+
+inline UiDebugOverlay debugOverlay(tft, forecastService);
+
+inline ClockScreen clockScreen(
+    tft, timeService, nightTransition, themeService, layout, bus, dht, timeline);
+
+inline ForecastScreen forecastScreen(
+    tft, themeService, forecastService, layout, bus, timeline);
+
+inline SettingsScreen settingsScreen(
+    tft, themeService, layout, nightService, timeService, wifi, brightness, bus, buttonBar);
+
+inline ScreenManager screenManager(
+    tft, clockScreen, statusBar, buttonBar, layout, sepStatus, sepBottom,
+    bus, themeService, debugOverlay, timeline);
+
+inline AppController app(screenManager, clockScreen, forecastScreen, settingsScreen);
+
+namespace NativeApp {
+
+inline Scheduler::Id nightTask = Scheduler::NONE;
+inline Scheduler::Id timeTask  = Scheduler::NONE;
+
+inline EventBus::Subscriber clockEvents(bus, channelBit(UiChannel::CLOCK));
+
+// ============================================================================
+// прогноз: 5 дней по 8 точек (шаг 3 ч) от местной полуночи "сегодня"
+// ============================================================================
+inline std::string forecastJson(time_t now) {
+
+    tm local{};
+    localtime_r(&now, &local);
+    local.tm_hour = 0;
+    local.tm_min  = 0;
+    local.tm_sec  = 0;
+    const time_t midnight = mktime(&local);
+
+    // Средние дня / ночи не попадают на .5 — округление не плавает
+    static const float    DAY[5]   = { 2.1f, 3.3f, 4.6f, 5.9f, 7.2f };
+    static const float    NIGHT[5] = { -3.1f, -2.3f, -1.6f, -0.9f, 1.2f };
+    static const int      CODE[5]  = { 800, 500, 801, 600, 211 };
+    static const uint8_t  HUM[5]   = { 65, 80, 72, 90, 55 };
+
+    std::string s = "{\"cod\":\"200\",\"list\":[";
+    char item[200];
+    bool first = true;
+
+    for (int d = 0; d < 5; d++) {
+        for (int h = 0; h < 24; h += 3) {
+            const bool  isDay = (h >= 9 && h <= 18);
+            const float temp  = isDay ? DAY[d] : NIGHT[d];
+
+            snprintf(item, sizeof(item),
+                     "%s{\"dt\":%ld,\"main\":{\"temp\":%.2f,\"humidity\":%u},"
+                     "\"weather\":[{\"id\":%d}]}",
+                     first ? "" : ",",
+                     (long)(midnight + (time_t)(d * 24 + h) * 3600),
+                     (double)temp,
+                     (unsigned)HUM[d],
+                     CODE[d]);
+            s += item;
+            first = false;
+        }
+    }
+
+    s += "]}";
+    return s;
+}
+
+// ============================================================================
+// задачи — как в main.cpp
+// ============================================================================
+inline void sampleClock(void*) { timeService.sample(); }
+inline void sampleWifi(void*)  { wifi.sample(); }
+inline void sampleDht(void*)   { dht.sample(); }
+
+inline void taskTime(void*)         { timeService.update(); }
+inline void taskWifi(void*)         { wifi.update(); }
+inline void taskConnectivity(void*) { connectivity.update(); }
+inline void taskDht(void*)          { dht.update(); }
+inline void taskForecast(void*)     { forecastService.update(); }
+
+inline void taskNight(void*) {
+    nightService.update(timeService);
+    themeService.setNight(nightService.isNight());
+    nightTransition.setTarget(nightService.isNight());
+}
+
+// ============================================================================
+// setup()
+// ============================================================================
+inline void begin() {
+
+    static bool started = false;
+    if (started) return;
+    started = true;
+
+    Native::setUs(1000000);
+    Native::setEpoch(EPOCH);
+    Native::setWifi(WL_CONNECTED, -58, "native");
+    Native::setDht(22.4f, 41.0f);
+
+    prefs.begin();
+    nightService.begin();
+
+    timeService.setTimezone(prefs.tzGmtOffset(), prefs.tzDstOffset());
+
+    // Прогноз — от "сегодня" по местному времени теста
+    static const std::string json = forecastJson(EPOCH);
+    Native::setHttpResponse(200, json.c_str());
+
+    timeService.registerProvider(rtcProvider);
+    timeService.registerProvider(ntpProvider);
+
+    tft.initR(INITR_BLACKTAB);
+    tft.setRotation(1);
+    tft.fillScreen(0x0000);
+
+    brightness.begin();
+    themeService.attachFilters(colorTemp, brightness);
+    themeService.begin();
+    timeService.begin();
+    wifi.begin();
+    connectivity.begin();
+    layout.begin();
+    dht.begin();
+    forecastService.begin();
+
+    screenManager.begin();
+    app.begin();
+
+    scheduler.begin();
+    bus.begin();
+
+    timeTask = scheduler.add("time", 1000, taskTime);
+    scheduler.add("wifi",     250,   taskWifi);
+    scheduler.add("conn",     250,   taskConnectivity);
+    nightTask = scheduler.add("night", 1000, taskNight);
+    scheduler.add("dht",      1000,  taskDht);
+    scheduler.add("forecast", 1000,  taskForecast);
+
+    serviceCore.add("clock", 50,  sampleClock);
+    serviceCore.add("link",  250, sampleWifi);
+    serviceCore.add("dht",   DhtService::READ_INTERVAL_MS, sampleDht,
+                    nullptr, DhtService::READ_INTERVAL_MS);
+    serviceCore.setInline(true);
+}
+
+// ============================================================================
+// loop(): одна итерация без ввода и без сна
+// ============================================================================
+inline void loopOnce() {
+
+    scheduler.runDue();
+    serviceCore.runInline();
+
+    if (clockEvents.poll()) {
+        scheduler.runNow(timeTask);
+        scheduler.runDue();
+    }
+
+    if (screenManager.msUntilNextFrame() == 0) {
+        nightTransition.update();
+
+        const uint8_t night8 = nightTransition.value8();
+        colorTemp.set(
+            night8 > 178 ? ColorTemp::NIGHT :
+            night8 > 76  ? ColorTemp::EVENING :
+                           ColorTemp::DAY
+        );
+    }
+
+    screenManager.update();
+}
+
+// Мс до ближайшего дедлайна (как сон loop())
+inline uint32_t msUntilNext() {
+    uint32_t ms = scheduler.msUntilNext();
+    const uint32_t inlineMs = serviceCore.msUntilNext();
+    if (inlineMs < ms) ms = inlineMs;
+    const uint32_t frameMs = screenManager.msUntilNextFrame();
+    if (frameMs < ms) ms = frameMs;
+    return ms;
+}
+
+// ms виртуального времени: итерации loop() по дедлайнам
+inline void run(uint32_t ms) {
+    while (ms > 0) {
+        loopOnce();
+
+        uint32_t step = msUntilNext();
+        if (step == 0) step = 1;
+        if (step > ms) step = ms;
+
+        Native::advanceMs(step);
+        ms -= step;
+    }
+    loopOnce();
+}
+
+// Событие кнопки — как из Buttons::poll() в loop()
+inline void press(ButtonId id, ButtonEventType type = ButtonEventType::SHORT_PRESS) {
+    app.handleEvent(ButtonEvent{ id, type, (uint32_t)micros() });
+    scheduler.runNow(nightTask);
+}
+
+// Дождаться ForecastTask (реальный поток) и показать результат.
+// false — за timeoutMs реального времени загрузка не закончилась.
+inline bool waitForecast(uint32_t timeoutMs = 5000) {
+
+    // Первая попытка — не раньше RETRY_INTERVAL_MS (10 с) от старта,
+    // в задаче "forecast" (раз в 1 с). Фиксированный шаг: кадры после
+    // ожидания не зависят от того, как быстро отработал поток.
+    run(11000);
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    // Модель UI меняется только в update() (снимок ForecastTask) —
+    // зовём его сами, не сдвигая виртуальные часы
+    for (;;) {
+        forecastService.update();
+        if (forecastService.isReady() && !forecastService.isUpdating()) break;
+
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    run(100);
+    return true;
+}
+
+}
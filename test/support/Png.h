@@ -0,0 +1,197 @@
+#pragma once
+
+/*
+ * Png
+ * ---
+ * Кадры RGB565 ↔ PNG (RGB 8 бит) для golden-тестов env:native.
+ *
+ *  - 565 → 888 повторяет старшие биты в младших, 888 → 565 берёт
+ *    старшие: круг 565 → PNG → 565 без потерь
+ *  - читает то, что пишет сам, и PNG из редакторов: RGB / RGBA 8 бит,
+ *    без interlace, любые фильтры строк
+ *  - zlib (compress / uncompress) — -lz в env:native
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+namespace Png {
+
+namespace detail {
+
+inline void put32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back((uint8_t)(v >> 24));
+    out.push_back((uint8_t)(v >> 16));
+    out.push_back((uint8_t)(v >> 8));
+    out.push_back((uint8_t)v);
+}
+
+inline uint32_t get32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8)  |  (uint32_t)p[3];
+}
+
+inline void chunk(std::vector<uint8_t>& out, const char* type,
+                  const uint8_t* data, size_t n) {
+    put32(out, (uint32_t)n);
+    const size_t at = out.size();
+    out.insert(out.end(), type, type + 4);
+    if (n) out.insert(out.end(), data, data + n);
+    put32(out, (uint32_t)crc32(0, out.data() + at, (uInt)(n + 4)));
+}
+
+inline uint8_t paeth(int a, int b, int c) {
+    const int p  = a + b - c;
+    const int pa = p > a ? p - a : a - p;
+    const int pb = p > b ? p - b : b - p;
+    const int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc) return (uint8_t)a;
+    if (pb <= pc) return (uint8_t)b;
+    return (uint8_t)c;
+}
+
+}
+
+// ============================================================================
+// запись
+// ============================================================================
+inline bool write(const std::string& path, const uint16_t* px, int w, int h) {
+
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)h * (1 + w * 3));
+
+    for (int y = 0; y < h; y++) {
+        raw.push_back(0);   // фильтр None
+        for (int x = 0; x < w; x++) {
+            const uint16_t c = px[y * w + x];
+            const uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+            const uint8_t g = (uint8_t)((c >> 5) & 0x3F);
+            const uint8_t b = (uint8_t)(c & 0x1F);
+            raw.push_back((uint8_t)((r << 3) | (r >> 2)));
+            raw.push_back((uint8_t)((g << 2) | (g >> 4)));
+            raw.push_back((uint8_t)((b << 3) | (b >> 2)));
+        }
+    }
+
+    uLongf zn = compressBound((uLong)raw.size());
+    std::vector<uint8_t> z(zn);
+    if (compress2(z.data(), &zn, raw.data(), (uLong)raw.size(), 9) != Z_OK) return false;
+
+    std::vector<uint8_t> out = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+
+    uint8_t ihdr[13];
+    ihdr[0] = (uint8_t)(w >> 24); ihdr[1] = (uint8_t)(w >> 16);
+    ihdr[2] = (uint8_t)(w >> 8);  ihdr[3] = (uint8_t)w;
+    ihdr[4] = (uint8_t)(h >> 24); ihdr[5] = (uint8_t)(h >> 16);
+    ihdr[6] = (uint8_t)(h >> 8);  ihdr[7] = (uint8_t)h;
+    ihdr[8]  = 8;   // бит на канал
+    ihdr[9]  = 2;   // RGB
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+
+    detail::chunk(out, "IHDR", ihdr, sizeof(ihdr));
+    detail::chunk(out, "IDAT", z.data(), zn);
+    detail::chunk(out, "IEND", nullptr, 0);
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    const bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+    fclose(f);
+    return ok;
+}
+
+// ============================================================================
+// чтение (false — нет файла / не тот формат)
+// ============================================================================
+inline bool read(const std::string& path, std::vector<uint16_t>& px, int& w, int& h) {
+
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    std::vector<uint8_t> file;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+    fclose(f);
+
+    static const uint8_t SIG[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    if (file.size() < 8 || memcmp(file.data(), SIG, 8) != 0) return false;
+
+    std::vector<uint8_t> idat;
+    int channels = 0;
+    w = h = 0;
+
+    size_t at = 8;
+    while (at + 12 <= file.size()) {
+        const uint32_t len  = detail::get32(&file[at]);
+        const char*    type = (const char*)&file[at + 4];
+        const uint8_t* data = &file[at + 8];
+        if (at + 12 + len > file.size()) return false;
+
+        if (!memcmp(type, "IHDR", 4)) {
+            w = (int)detail::get32(data);
+            h = (int)detail::get32(data + 4);
+            if (data[8] != 8 || data[12] != 0) return false;
+            if (data[9] == 2)      channels = 3;
+            else if (data[9] == 6) channels = 4;
+            else return false;
+        } else if (!memcmp(type, "IDAT", 4)) {
+            idat.insert(idat.end(), data, data + len);
+        } else if (!memcmp(type, "IEND", 4)) {
+            break;
+        }
+        at += 12 + len;
+    }
+
+    if (!channels || w <= 0 || h <= 0) return false;
+
+    const size_t stride = (size_t)w * channels;
+    std::vector<uint8_t> raw((stride + 1) * h);
+    uLongf rn = (uLongf)raw.size();
+    if (uncompress(raw.data(), &rn, idat.data(), (uLong)idat.size()) != Z_OK ||
+        rn != raw.size()) return false;
+
+    // Фильтры строк → чистые байты (на месте)
+    std::vector<uint8_t> prev(stride, 0);
+    px.assign((size_t)w * h, 0);
+
+    for (int y = 0; y < h; y++) {
+        const uint8_t ft  = raw[y * (stride + 1)];
+        uint8_t*      row = &raw[y * (stride + 1) + 1];
+
+        for (size_t i = 0; i < stride; i++) {
+            const int a = i >= (size_t)channels ? row[i - channels] : 0;
+            const int b = prev[i];
+            const int c = i >= (size_t)channels ? prev[i - channels] : 0;
+
+            switch (ft) {
+                case 0: break;
+                case 1: row[i] = (uint8_t)(row[i] + a); break;
+                case 2: row[i] = (uint8_t)(row[i] + b); break;
+                case 3: row[i] = (uint8_t)(row[i] + ((a + b) >> 1)); break;
+                case 4: row[i] = (uint8_t)(row[i] + detail::paeth(a, b, c)); break;
+                default: return false;
+            }
+        }
+
+        for (int x = 0; x < w; x++) {
+            const uint8_t* p = row + x * channels;
+            px[(size_t)y * w + x] = (uint16_t)(((p[0] >> 3) << 11) |
+                                               ((p[1] >> 2) << 5)  |
+                                                (p[2] >> 3));
+        }
+
+        memcpy(prev.data(), row, stride);
+    }
+
+    return true;
+}
+
+}
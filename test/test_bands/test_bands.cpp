@@ -0,0 +1,136 @@
+/*
+ * test_bands
+ * ----------
+ * Полный кадр (forceFullRedraw) полосами BandRenderer против прямого
+ * пути flushRect — на модели панели.
+ *
+ *  - кадр: оба пути дают одинаковую панель
+ *  - бенч: окна адреса, транзакции, байты SPI (2 * пиксели + 11 *
+ *    окна) и время кадра на хосте. micros() на хосте виртуальные,
+ *    поэтому BandRenderer::lastUs() здесь 0 — время меряется
+ *    steady_clock вокруг loop(); на ESP32 — строка [UI] (full=...)
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <string.h>
+#include <vector>
+
+#include "NativeApp.h"
+
+static constexpr int ROUNDS = 200;
+
+struct FullFrame {
+    uint32_t pixels;
+    uint32_t windows;
+    uint32_t transactions;
+    double   hostUs;
+};
+
+static FullFrame fullFrame(bool bands) {
+
+    screenManager.setBandRendering(bands);
+
+    FullFrame f{ 0, 0, 0, 0.0 };
+
+    for (int i = 0; i < ROUNDS; i++) {
+        tft.resetTraffic();
+        screenManager.forceFullRedraw();
+
+        const auto t0 = std::chrono::steady_clock::now();
+        screenManager.update();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        f.hostUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+    }
+    f.hostUs /= ROUNDS;
+
+    // Трафик последнего прохода по всем тегам
+    for (uint8_t t = 0; t < (uint8_t)UiTag::COUNT; t++) {
+        const UiDisplay::Traffic& x = tft.traffic((UiTag)t);
+        f.pixels       += x.pixels;
+        f.windows      += x.windows;
+        f.transactions += x.transactions;
+    }
+    return f;
+}
+
+static void report(const char* name, const FullFrame& f) {
+    printf("[BENCH] full frame %-6s: %6u px, %4u windows, %4u transactions, "
+           "%6u B, host %.1f us\n",
+           name, (unsigned)f.pixels, (unsigned)f.windows, (unsigned)f.transactions,
+           (unsigned)(2 * f.pixels + 11 * f.windows), f.hostUs);
+}
+
+void setUp() {
+    screenManager.setTransitions(false);
+}
+
+void tearDown() {
+    screenManager.setBandRendering(true);
+}
+
+// ============================================================================
+// полосы == прямой путь
+// ============================================================================
+static void test_bands_match_direct() {
+
+    const size_t n = (size_t)tft.width() * tft.height();
+
+    screenManager.setBandRendering(false);
+    screenManager.forceFullRedraw();
+    screenManager.update();
+    const std::vector<uint16_t> direct(tft.nativeFrame(), tft.nativeFrame() + n);
+
+    screenManager.setBandRendering(true);
+    screenManager.forceFullRedraw();
+    screenManager.update();
+
+    TEST_ASSERT_TRUE_MESSAGE(
+        memcmp(direct.data(), tft.nativeFrame(), n * sizeof(uint16_t)) == 0,
+        "banded frame != direct frame");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+// ============================================================================
+// бенч: Clock и Forecast
+// ============================================================================
+static void benchScreen(const char* screen) {
+
+    const FullFrame direct = fullFrame(false);
+    const FullFrame banded = fullFrame(true);
+
+    printf("[BENCH] %s\n", screen);
+    report("direct", direct);
+    report("bands",  banded);
+
+    TEST_ASSERT_LESS_THAN_UINT32(direct.windows, banded.windows);
+    TEST_ASSERT_LESS_THAN_UINT32(direct.transactions, banded.transactions);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+static void test_bench_clock() {
+    benchScreen("clock");
+}
+
+static void test_bench_forecast() {
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::LONG_PRESS);
+    NativeApp::run(2000);
+    benchScreen("forecast");
+}
+
+int main() {
+    NativeApp::begin();
+    if (!NativeApp::waitForecast()) {
+        printf("forecast did not load: %s\n", forecastService.lastError());
+        return 1;
+    }
+    NativeApp::run(2000);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bands_match_direct);
+    RUN_TEST(test_bench_clock);
+    RUN_TEST(test_bench_forecast);
+    return UNITY_END();
+}
@@ -0,0 +1,223 @@
+/*
+ * test_clock_bytes
+ * ----------------
+ * Байты в SPI за минуту часов: HH:MM старым путём (print "%02d"
+ * шрифтом 6x8 * 3 поверх Adafruit_GFX) против спрайтов
+ * DigitSpriteCache + перерисовки только сменившихся цифр.
+ *
+ * Сценарий (одинаковый для обоих путей):
+ *  - 60 с с 10:42:07, кадр 10 fps (как ClockScreen), минута
+ *    сменится один раз (42 → 43)
+ *  - цвет ":" — пульс 1 с (pulseQ16), как в ClockScreen
+ *  - политика старого кода: сменилась минута → обе цифры MM,
+ *    сменился цвет ":" → ":"; нового — только сменившаяся цифра
+ *
+ * Байты = 2 * пиксели + 11 * окна (CASET 1+4, RASET 1+4, RAMWR 1).
+ *
+ * Сравнение — на ОДНОЙ высоте глифа: спрайты строятся на 24 px, как
+ * старый шрифт size 3 (ширина — по пропорции шрифта, 15 против 18).
+ * Спрайты высоты layout (clockDigitsH) — отдельной строкой, без
+ * сравнения: это другой объём работы.
+ *
+ * Весь тег CLOCK реального экрана за минуту — тоже отдельно: туда
+ * входят секунды, DHT и первый кадр всей зоны контента, у старого
+ * пути такого замера нет.
+ */
+
+#include <unity.h>
+
+#include "NativeApp.h"
+
+#include "core/FixedMath.h"
+#include "ui/ColorUtil.h"
+#include "ui/DigitSpriteCache.h"
+
+static constexpr uint32_t MINUTE_MS = 60000;
+static constexpr uint32_t FRAME_MS  = 100;
+static constexpr uint32_t PULSE_MS  = 1000;
+
+// Старый шрифт часов: 6x8 * size 3
+static constexpr int16_t LEGACY_W = 18;
+static constexpr int16_t LEGACY_H = 24;
+
+static DigitSpriteCache sprites;
+
+static uint32_t bytesOf(const UiDisplay::Traffic& t) {
+    return 2 * t.pixels + 11 * t.windows;
+}
+
+// ============================================================================
+// кадр сценария
+// ============================================================================
+struct Frame {
+    int8_t   h;
+    int8_t   m;
+    uint16_t colon;
+};
+
+static Frame frameAt(const ThemeBlend& th, uint32_t ms) {
+    const uint32_t s = 10 * 3600 + 42 * 60 + 7 + ms / 1000;
+    const q16_t    t = q16Div((int32_t)(ms % PULSE_MS), PULSE_MS);
+
+    Frame f;
+    f.h     = (int8_t)(s / 3600 % 24);
+    f.m     = (int8_t)(s / 60 % 60);
+    f.colon = blend565(th.accent, th.fg, q16ToU8(pulseQ16(t)));
+    return f;
+}
+
+// ============================================================================
+// старый путь: Adafruit_GFX print поверх фона
+// ============================================================================
+static void legacyText(int16_t x, int16_t y, uint16_t fg, uint16_t bg, const char* s) {
+    tft.setTextSize(3);
+    tft.setTextColor(fg, bg);
+    tft.setCursor(x, y);
+    // Мимо спанов UiDisplay — посимвольно, как было
+    while (*s) tft.Adafruit_GFX::write((uint8_t)*s++);
+}
+
+static UiDisplay::Traffic runLegacy(const ThemeBlend& th, int16_t x, int16_t y) {
+
+    char buf[5];
+    Frame prev{ -1, -1, 0 };
+    bool  first = true;
+
+    tft.resetTraffic();
+
+    for (uint32_t ms = 0; ms < MINUTE_MS; ms += FRAME_MS) {
+        const Frame f = frameAt(th, ms);
+
+        if (first || f.h != prev.h) {
+            snprintf(buf, sizeof(buf), "%02d", f.h);
+            legacyText(x, y, th.fg, th.bg, buf);
+        }
+        if (first || f.colon != prev.colon) {
+            legacyText(x + 2 * LEGACY_W, y, f.colon, th.bg, ":");
+        }
+        if (first || f.m != prev.m) {
+            snprintf(buf, sizeof(buf), "%02d", f.m);
+            legacyText(x + 3 * LEGACY_W, y, th.fg, th.bg, buf);
+        }
+
+        prev  = f;
+        first = false;
+    }
+
+    return tft.traffic(UiTag::CLOCK);
+}
+
+// ============================================================================
+// новый путь: спрайты, только сменившиеся глифы
+// ============================================================================
+static void spriteGlyph(int16_t x, int16_t y, uint8_t glyph, uint16_t fg, uint16_t bg) {
+    tft.blit(x, y, sprites.glyphW(glyph), sprites.digitH(), sprites.sprite(glyph, fg, bg));
+}
+
+static UiDisplay::Traffic runSprites(const ThemeBlend& th, int16_t x, int16_t y) {
+
+    const int16_t dw = sprites.digitW();
+    const int16_t cw = sprites.colonW();
+    const int16_t gx[5] = { x, (int16_t)(x + dw), (int16_t)(x + 2 * dw),
+                            (int16_t)(x + 2 * dw + cw), (int16_t)(x + 3 * dw + cw) };
+
+    Frame prev{ -1, -1, 0 };
+    bool  first = true;
+
+    tft.resetTraffic();
+
+    for (uint32_t ms = 0; ms < MINUTE_MS; ms += FRAME_MS) {
+        const Frame f = frameAt(th, ms);
+
+        const int8_t was[4] = { (int8_t)(prev.h / 10), (int8_t)(prev.h % 10),
+                                (int8_t)(prev.m / 10), (int8_t)(prev.m % 10) };
+        const int8_t now[4] = { (int8_t)(f.h / 10),    (int8_t)(f.h % 10),
+                                (int8_t)(f.m / 10),    (int8_t)(f.m % 10) };
+        static const uint8_t POS[4] = { 0, 1, 3, 4 };
+
+        for (uint8_t i = 0; i < 4; i++) {
+            if (first || was[i] != now[i]) {
+                spriteGlyph(gx[POS[i]], y, (uint8_t)now[i], th.fg, th.bg);
+            }
+        }
+        if (first || f.colon != prev.colon) {
+            spriteGlyph(gx[2], y, DigitSpriteCache::COLON, f.colon, th.bg);
+        }
+
+        prev  = f;
+        first = false;
+    }
+
+    return tft.traffic(UiTag::CLOCK);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// HH:MM: старый путь против спрайтов
+// ============================================================================
+static UiDisplay::Traffic spritesAt(const ThemeBlend& th, int16_t h, int16_t y) {
+    sprites.begin(h);
+    const int16_t w = 4 * sprites.digitW() + sprites.colonW();
+    return runSprites(th, (layout.current().width - w) / 2, y);
+}
+
+static void report(const char* name, const UiDisplay::Traffic& t, int16_t h) {
+    printf("[BENCH] HH:MM per minute, %-7s h %2d: %6u B (%6u px, %5u windows)\n",
+           name, (int)h, (unsigned)bytesOf(t), (unsigned)t.pixels, (unsigned)t.windows);
+}
+
+static void test_digits_bytes_per_minute() {
+
+    const UiLayout&   L  = layout.current();
+    const ThemeBlend& th = themeService.at(0);
+
+    const int16_t y = L.clockDigitsY;
+
+    tft.setTag(UiTag::CLOCK);
+    const UiDisplay::Traffic legacy = runLegacy(th, (L.width - 5 * LEGACY_W) / 2, y);
+    const UiDisplay::Traffic same   = spritesAt(th, LEGACY_H, y);
+    const UiDisplay::Traffic layH   = spritesAt(th, L.clockDigitsH, y);
+    tft.setTag(UiTag::OTHER);
+
+    report("GFX",     legacy, LEGACY_H);
+    report("sprites", same,   LEGACY_H);
+    report("sprites", layH,   L.clockDigitsH);
+
+    const uint32_t before = bytesOf(legacy);
+    const uint32_t after  = bytesOf(same);
+    printf("[BENCH] HH:MM at equal height: %.1f%% of GFX bytes, "
+           "%.1f%% of GFX pixels\n",
+           100.0 * after / before, 100.0 * same.pixels / legacy.pixels);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+    TEST_ASSERT_LESS_THAN_UINT32(before, after);
+}
+
+// ============================================================================
+// весь экран часов за минуту (для порядка)
+// ============================================================================
+static void test_clock_screen_bytes_per_minute() {
+
+    // Панель после бенча HH:MM испорчена — не важно: считаем трафик,
+    // а экран шлёт только то, что сам считает грязным
+    tft.resetTraffic();
+    NativeApp::run(MINUTE_MS);
+
+    const UiDisplay::Traffic& t = tft.traffic(UiTag::CLOCK);
+    printf("[BENCH] CLOCK tag bytes/min: %u (%u px, %u windows)\n",
+           (unsigned)bytesOf(t), (unsigned)t.pixels, (unsigned)t.windows);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+int main() {
+    NativeApp::begin();
+    NativeApp::run(2000);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_digits_bytes_per_minute);
+    RUN_TEST(test_clock_screen_bytes_per_minute);
+    return UNITY_END();
+}
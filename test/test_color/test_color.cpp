@@ -0,0 +1,295 @@
+/*
+ * test_color
+ * ----------
+ * Ядра ColorUtil против float-эталона и их цена на хосте.
+ *
+ *  - blend565 / scale565 (SWAR): каждый канал не дальше 1 LSB от
+ *    round(bg + (fg - bg) * a / 255), концы (a = 0 / 255) — точно
+ *  - blend565Gamma: концы точно, середина между bg и fg, каждый канал
+ *    не дальше 1 LSB от смешивания в линейном свете на double
+ *  - blendPalette565 / blendPalette: тот же результат, что скаляр
+ *
+ * Бенч: нс на пиксель — SWAR, gamma, палитра пачкой и старый float
+ * путь (ThemeService::blend565 до SWAR). Числа хоста, не ESP32: важно
+ * соотношение, а не абсолют.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ui/ColorUtil.h"
+
+// Граф прошивки не нужен, но src линкуется целиком (extern prefs)
+#include "NativeApp.h"
+
+static constexpr uint32_t SWEEP = 2000000;
+
+// ============================================================================
+// эталон
+// ============================================================================
+struct Rgb {
+    int r, g, b;
+};
+
+static Rgb split(uint16_t c) {
+    return Rgb{ (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F };
+}
+
+static int refChannel(int b, int f, uint8_t a) {
+    return (int)lround(b + (f - b) * (a / 255.0));
+}
+
+// Старый float путь (до SWAR): усечение через uint8_t
+static uint16_t blendFloat(uint16_t a, uint16_t b, float k) {
+    const Rgb x = split(a);
+    const Rgb y = split(b);
+
+    const uint8_t r  = x.r + (y.r - x.r) * k;
+    const uint8_t g  = x.g + (y.g - x.g) * k;
+    const uint8_t b2 = x.b + (y.b - x.b) * k;
+
+    return (r << 11) | (g << 5) | b2;
+}
+
+// Линейный свет на double: гамма 2.2, ближайший код канала
+static int refGammaChannel(int c0, int c1, uint8_t a, int maxCode) {
+    const double l0 = pow(c0 / (double)maxCode, 2.2);
+    const double l1 = pow(c1 / (double)maxCode, 2.2);
+    const double l  = l0 + (l1 - l0) * (a / 255.0);
+
+    int best = 0;
+    for (int c = 1; c <= maxCode; c++) {
+        if (fabs(pow(c / (double)maxCode, 2.2) - l) <
+            fabs(pow(best / (double)maxCode, 2.2) - l)) best = c;
+    }
+    return best;
+}
+
+// Случайные цвета и alpha: повторяемая последовательность
+static uint32_t rngState = 1;
+
+static uint32_t rng() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState >> 8;
+}
+
+void setUp()    { rngState = 1; }
+void tearDown() {}
+
+// ============================================================================
+// точность
+// ============================================================================
+static void test_blend565_within_1_lsb() {
+
+    Rgb worst{ 0, 0, 0 };
+
+    for (uint32_t i = 0; i < SWEEP; i++) {
+        const uint16_t bg = (uint16_t)rng();
+        const uint16_t fg = (uint16_t)rng();
+        const uint8_t  a  = (uint8_t)rng();
+
+        const Rgb b = split(bg);
+        const Rgb f = split(fg);
+        const Rgb o = split(blend565(bg, fg, a));
+
+        worst.r = max(worst.r, abs(o.r - refChannel(b.r, f.r, a)));
+        worst.g = max(worst.g, abs(o.g - refChannel(b.g, f.g, a)));
+        worst.b = max(worst.b, abs(o.b - refChannel(b.b, f.b, a)));
+    }
+
+    printf("[COLOR] blend565 max error: R %d G %d B %d LSB\n", worst.r, worst.g, worst.b);
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.r);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.g);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.b);
+}
+
+static void test_blend565_endpoints() {
+    for (uint32_t i = 0; i < 65536; i++) {
+        const uint16_t bg = (uint16_t)i;
+        const uint16_t fg = (uint16_t)(i * 40503u);
+
+        TEST_ASSERT_EQUAL_HEX16(bg, blend565(bg, fg, 0));
+        TEST_ASSERT_EQUAL_HEX16(fg, blend565(bg, fg, 255));
+    }
+}
+
+static void test_scale565_within_1_lsb() {
+
+    Rgb worst{ 0, 0, 0 };
+
+    for (uint32_t c = 0; c < 65536; c++) {
+        for (uint32_t k = 0; k < 256; k += 3) {
+            const Rgb x = split((uint16_t)c);
+            const Rgb o = split(scale565((uint16_t)c, (uint8_t)k));
+
+            worst.r = max(worst.r, abs(o.r - refChannel(0, x.r, k)));
+            worst.g = max(worst.g, abs(o.g - refChannel(0, x.g, k)));
+            worst.b = max(worst.b, abs(o.b - refChannel(0, x.b, k)));
+        }
+        TEST_ASSERT_EQUAL_HEX16(c, scale565((uint16_t)c, 255));
+        TEST_ASSERT_EQUAL_HEX16(0, scale565((uint16_t)c, 0));
+    }
+
+    printf("[COLOR] scale565 max error: R %d G %d B %d LSB\n", worst.r, worst.g, worst.b);
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.r);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.g);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.b);
+}
+
+static void test_blend565Gamma_endpoints_and_order() {
+    for (uint32_t i = 0; i < 20000; i++) {
+        const uint16_t bg = (uint16_t)rng();
+        const uint16_t fg = (uint16_t)rng();
+
+        TEST_ASSERT_EQUAL_HEX16(bg, blend565Gamma(bg, fg, 0));
+        TEST_ASSERT_EQUAL_HEX16(fg, blend565Gamma(bg, fg, 255));
+
+        // Каждый канал середины — между концами
+        const Rgb b = split(bg);
+        const Rgb f = split(fg);
+        const Rgb m = split(blend565Gamma(bg, fg, 128));
+
+        TEST_ASSERT_TRUE(m.r >= min(b.r, f.r) && m.r <= max(b.r, f.r));
+        TEST_ASSERT_TRUE(m.g >= min(b.g, f.g) && m.g <= max(b.g, f.g));
+        TEST_ASSERT_TRUE(m.b >= min(b.b, f.b) && m.b <= max(b.b, f.b));
+    }
+}
+
+static void test_blend565Gamma_within_1_lsb() {
+
+    Rgb worst{ 0, 0, 0 };
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        const uint16_t bg = (uint16_t)rng();
+        const uint16_t fg = (uint16_t)rng();
+        const uint8_t  a  = (uint8_t)rng();
+
+        const Rgb b = split(bg);
+        const Rgb f = split(fg);
+        const Rgb o = split(blend565Gamma(bg, fg, a));
+
+        worst.r = max(worst.r, abs(o.r - refGammaChannel(b.r, f.r, a, 31)));
+        worst.g = max(worst.g, abs(o.g - refGammaChannel(b.g, f.g, a, 63)));
+        worst.b = max(worst.b, abs(o.b - refGammaChannel(b.b, f.b, a, 31)));
+
+        // Одинаковые каналы смешиваются точно
+        TEST_ASSERT_EQUAL_HEX16(bg, blend565Gamma(bg, bg, a));
+    }
+
+    printf("[COLOR] blend565Gamma max error: R %d G %d B %d LSB\n", worst.r, worst.g, worst.b);
+
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.r);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.g);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(1, worst.b);
+}
+
+static void test_blendPalette_matches_scalar() {
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        uint16_t pa[8], pb[8], po[8];
+        for (uint8_t k = 0; k < 8; k++) {
+            pa[k] = (uint16_t)rng();
+            pb[k] = (uint16_t)rng();
+        }
+        const uint8_t a = (uint8_t)rng();
+
+        blendPalette565(pa, pb, po, 8, a);
+        for (uint8_t k = 0; k < 8; k++) {
+            TEST_ASSERT_EQUAL_HEX16(blend565Gamma(pa[k], pb[k], a), po[k]);
+        }
+
+        // На месте: out == a
+        blendPalette565(pa, pb, pa, 8, a);
+        for (uint8_t k = 0; k < 8; k++) {
+            TEST_ASSERT_EQUAL_HEX16(po[k], pa[k]);
+        }
+    }
+
+    const ThemeBlend day   = { 0xFFFF, 0x0000, 0x041F, 0x7BEF, 0xF800, 0x07E0, 0xFD20, 0x867F };
+    const ThemeBlend night = { 0x0000, 0xC618, 0x8010, 0x39E7, 0x8000, 0x0320, 0xA280, 0x4210 };
+    const ThemeBlend m = blendPalette(day, night, 100);
+
+    TEST_ASSERT_EQUAL_HEX16(blend565Gamma(day.bg,     night.bg,     100), m.bg);
+    TEST_ASSERT_EQUAL_HEX16(blend565Gamma(day.accent, night.accent, 100), m.accent);
+    TEST_ASSERT_EQUAL_HEX16(blend565Gamma(day.fgCool, night.fgCool, 100), m.fgCool);
+}
+
+// ============================================================================
+// бенч
+// ============================================================================
+template <typename F>
+static double nsPerPixel(F blend) {
+
+    static uint16_t bg[4096], fg[4096];
+    static uint8_t  al[4096];
+    for (int i = 0; i < 4096; i++) {
+        bg[i] = (uint16_t)rng();
+        fg[i] = (uint16_t)rng();
+        al[i] = (uint8_t)rng();
+    }
+
+    volatile uint16_t sink = 0;
+    uint16_t acc = 0;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < SWEEP; n++) {
+        const uint32_t i = n & 4095;
+        acc ^= blend(bg[i], fg[i], al[i]);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    sink = acc;
+    (void)sink;
+
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / SWEEP;
+}
+
+static void test_bench_blend() {
+
+    const double swar  = nsPerPixel([](uint16_t b, uint16_t f, uint8_t a) {
+        return blend565(b, f, a);
+    });
+    const double gamma = nsPerPixel([](uint16_t b, uint16_t f, uint8_t a) {
+        return blend565Gamma(b, f, a);
+    });
+    const double flt   = nsPerPixel([](uint16_t b, uint16_t f, uint8_t a) {
+        return blendFloat(b, f, a / 255.0f);
+    });
+
+    // Палитра ThemeBlend (8 цветов) одним вызовом, нс на цвет
+    static uint16_t pa[8], pb[8], po[8];
+    for (uint8_t k = 0; k < 8; k++) {
+        pa[k] = (uint16_t)rng();
+        pb[k] = (uint16_t)rng();
+    }
+    volatile uint16_t sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < SWEEP / 8; n++) {
+        blendPalette565(pa, pb, po, 8, (uint8_t)n);
+        sink = sink ^ po[n & 7];
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    const double batch = std::chrono::duration<double, std::nano>(t1 - t0).count() / SWEEP;
+
+    printf("[BENCH] ns/px: blend565 %.2f, blend565Gamma %.2f, palette x8 %.2f, float %.2f\n",
+           swar, gamma, batch, flt);
+
+    TEST_ASSERT_TRUE(swar > 0.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_blend565_within_1_lsb);
+    RUN_TEST(test_blend565_endpoints);
+    RUN_TEST(test_scale565_within_1_lsb);
+    RUN_TEST(test_blend565Gamma_endpoints_and_order);
+    RUN_TEST(test_blend565Gamma_within_1_lsb);
+    RUN_TEST(test_blendPalette_matches_scalar);
+    RUN_TEST(test_bench_blend);
+    return UNITY_END();
+}
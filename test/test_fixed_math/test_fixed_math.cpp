@@ -0,0 +1,180 @@
+/*
+ * test_fixed_math
+ * ---------------
+ * FixedMath против libm и его цена на хосте.
+ *
+ * Границы — те, что обещает FixedMath.h (доля полной шкалы):
+ *  - sinQ15:        < 0.00012 на всех 65536 фазах
+ *  - pulseQ16:      < 0.0001
+ *  - smoothstepQ16: < 0.0001
+ *
+ * Бенч: тактов на вызов (rdtsc на x86-64, иначе только нс) —
+ * Q-версии против sinf / float. Числа хоста: для ESP32 важно
+ * соотношение (у LX6 нет FPU двойной точности, sinf — программный).
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <math.h>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "core/FixedMath.h"
+
+// Граф прошивки не нужен, но src линкуется целиком (extern prefs)
+#include "NativeApp.h"
+
+static constexpr uint32_t CALLS = 4000000;
+
+static constexpr double TWO_PI = 6.283185307179586;
+
+void setUp() {}
+void tearDown() {}
+
+// ============================================================================
+// точность
+// ============================================================================
+static void test_sinQ15_error_bound() {
+
+    double worst = 0.0;
+    for (uint32_t p = 0; p < 65536; p++) {
+        const double ref = sin(TWO_PI * p / 65536.0);
+        const double got = sinQ15((uint16_t)p) / 32767.0;
+        worst = fmax(worst, fabs(got - ref));
+    }
+
+    printf("[FIXED] sinQ15 max error %.2e\n", worst);
+    TEST_ASSERT_TRUE(worst < 0.00012);
+}
+
+static void test_sinQ15_quadrants() {
+    TEST_ASSERT_EQUAL_INT(0,      sinQ15(0));
+    TEST_ASSERT_EQUAL_INT(32767,  sinQ15(0x4000));
+    TEST_ASSERT_EQUAL_INT(0,      sinQ15(0x8000));
+    TEST_ASSERT_EQUAL_INT(-32767, sinQ15(0xC000));
+
+    // Нечётность: sin(-x) == -sin(x)
+    for (uint32_t p = 1; p < 0x8000; p++) {
+        TEST_ASSERT_EQUAL_INT(-sinQ15((uint16_t)p), sinQ15((uint16_t)(65536 - p)));
+    }
+}
+
+static void test_pulseQ16_error_bound() {
+
+    double worst = 0.0;
+    for (uint32_t t = 0; t < 65536; t++) {
+        const double ref = 0.5 + 0.5 * sin(TWO_PI * t / 65536.0);
+        const double got = pulseQ16((q16_t)t) / 65536.0;
+        worst = fmax(worst, fabs(got - ref));
+    }
+
+    printf("[FIXED] pulseQ16 max error %.2e\n", worst);
+    TEST_ASSERT_TRUE(worst < 0.0001);
+}
+
+static void test_smoothstepQ16_error_bound() {
+
+    double worst = 0.0;
+    for (uint32_t t = 0; t <= 65536; t++) {
+        const double x   = t / 65536.0;
+        const double ref = x * x * (3.0 - 2.0 * x);
+        const double got = smoothstepQ16((q16_t)t) / 65536.0;
+        worst = fmax(worst, fabs(got - ref));
+    }
+
+    printf("[FIXED] smoothstepQ16 max error %.2e\n", worst);
+    TEST_ASSERT_TRUE(worst < 0.0001);
+
+    TEST_ASSERT_EQUAL_INT(0,       smoothstepQ16(-100));
+    TEST_ASSERT_EQUAL_INT(Q16_ONE, smoothstepQ16(Q16_ONE + 100));
+}
+
+// ============================================================================
+// бенч
+// ============================================================================
+struct Cost {
+    double ns;
+    double cycles;   // 0 — счётчика тактов нет
+};
+
+template <typename F>
+static Cost cost(F fn) {
+
+    volatile int32_t sink = 0;
+    int32_t acc = 0;
+
+#if defined(__x86_64__)
+    const uint64_t c0 = __rdtsc();
+#endif
+    const auto t0 = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < CALLS; i++) {
+        // Шаг 40503 обходит все фазы вразброс, без предсказуемого паттерна
+        acc += fn((uint16_t)(i * 40503u));
+    }
+
+    const auto t1 = std::chrono::steady_clock::now();
+#if defined(__x86_64__)
+    const uint64_t c1 = __rdtsc();
+#endif
+    sink = acc;
+    (void)sink;
+
+    Cost c;
+    c.ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / CALLS;
+#if defined(__x86_64__)
+    c.cycles = (double)(c1 - c0) / CALLS;
+#else
+    c.cycles = 0.0;
+#endif
+    return c;
+}
+
+static void report(const char* name, const Cost& c) {
+    printf("[BENCH] %-14s %6.2f ns/call, %6.1f cycles/call\n", name, c.ns, c.cycles);
+}
+
+static void test_bench_cycles() {
+
+    const Cost qSin = cost([](uint16_t p) -> int32_t {
+        return sinQ15(p);
+    });
+    const Cost fSin = cost([](uint16_t p) -> int32_t {
+        return (int32_t)(sinf((float)TWO_PI * p / 65536.0f) * 32767.0f);
+    });
+    const Cost qPulse = cost([](uint16_t p) -> int32_t {
+        return pulseQ16((q16_t)p);
+    });
+    const Cost fPulse = cost([](uint16_t p) -> int32_t {
+        return (int32_t)((0.5f + 0.5f * sinf((float)TWO_PI * p / 65536.0f)) * 65536.0f);
+    });
+    const Cost qSmooth = cost([](uint16_t p) -> int32_t {
+        return smoothstepQ16((q16_t)p);
+    });
+    const Cost fSmooth = cost([](uint16_t p) -> int32_t {
+        const float x = p / 65536.0f;
+        return (int32_t)(x * x * (3.0f - 2.0f * x) * 65536.0f);
+    });
+
+    report("sinQ15",        qSin);
+    report("sinf",          fSin);
+    report("pulseQ16",      qPulse);
+    report("pulse float",   fPulse);
+    report("smoothstepQ16", qSmooth);
+    report("smooth float",  fSmooth);
+
+    TEST_ASSERT_TRUE(qSin.ns > 0.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_sinQ15_error_bound);
+    RUN_TEST(test_sinQ15_quadrants);
+    RUN_TEST(test_pulseQ16_error_bound);
+    RUN_TEST(test_smoothstepQ16_error_bound);
+    RUN_TEST(test_bench_cycles);
+    return UNITY_END();
+}
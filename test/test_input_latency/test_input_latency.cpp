@@ -0,0 +1,141 @@
+/*
+ * test_input_latency
+ * ------------------
+ * InputLatency на полном графе прошивки: какие нажатия становятся
+ * замером и каким кадром закрываются.
+ *
+ *  - смена экрана, слайд прогноза, курсор Settings, аккорд HUD — замер
+ *  - нажатие без реакции не закрывается кадрами пульса двоеточия:
+ *    noReaction, гистограмма экрана не растёт
+ *  - открытая последняя корзина в dump — ">=1024ms", не "<2048ms"
+ */
+
+#include <unity.h>
+
+#include <string>
+
+#include "NativeApp.h"
+
+// dump() в строку
+class StringPrint : public Print {
+public:
+    size_t write(uint8_t c) override { text += (char)c; return 1; }
+    std::string text;
+};
+
+static uint32_t histCount(UiTag screen) {
+    uint16_t hist[InputLatency::BUCKETS];
+    screenManager.latency().screenHist(screen, hist);
+
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < InputLatency::BUCKETS; i++) n += hist[i];
+    return n;
+}
+
+void setUp() {
+    screenManager.resetLatency();
+}
+
+void tearDown() {}
+
+// ============================================================================
+// нажатие без реакции
+// ============================================================================
+static void test_no_effect_press_is_not_closed_by_pulse() {
+
+    // SHORT LEFT на часах ничего не делает; кадры пульса двоеточия
+    // идут дальше и не должны закрыть замер
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::SHORT_PRESS);
+    NativeApp::run(2500);
+
+    TEST_ASSERT_EQUAL_UINT32(0, histCount(UiTag::CLOCK));
+    TEST_ASSERT_EQUAL_UINT32(1, screenManager.latency().noReaction());
+}
+
+// ============================================================================
+// реакции
+// ============================================================================
+static void test_screen_switch_is_measured() {
+
+    // Ключ — экран, который получил событие (часы)
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::LONG_PRESS);
+    NativeApp::run(1000);
+
+    TEST_ASSERT_EQUAL_UINT32(1, histCount(UiTag::CLOCK));
+    TEST_ASSERT_EQUAL_UINT32(0, screenManager.latency().noReaction());
+    TEST_ASSERT_EQUAL_STRING("C:L.l", screenManager.latency().lastLabel());
+}
+
+static void test_forecast_slide_is_measured() {
+
+    NativeApp::press(ButtonId::RIGHT, ButtonEventType::SHORT_PRESS);
+    NativeApp::run(1000);
+
+    TEST_ASSERT_EQUAL_UINT32(1, histCount(UiTag::FORECAST));
+    TEST_ASSERT_EQUAL_UINT32(0, screenManager.latency().noReaction());
+    TEST_ASSERT_EQUAL_STRING("F:R.s", screenManager.latency().lastLabel());
+}
+
+static void test_settings_cursor_is_measured() {
+
+    NativeApp::press(ButtonId::OK, ButtonEventType::LONG_PRESS);
+    NativeApp::run(1000);
+
+    NativeApp::press(ButtonId::RIGHT, ButtonEventType::SHORT_PRESS);
+    NativeApp::run(1000);
+
+    TEST_ASSERT_EQUAL_UINT32(1, histCount(UiTag::SETTINGS));
+    TEST_ASSERT_EQUAL_UINT32(0, screenManager.latency().noReaction());
+    TEST_ASSERT_EQUAL_STRING("S:R.s", screenManager.latency().lastLabel());
+}
+
+static void test_hud_chord_is_measured() {
+
+    // Включить и выключить: обе реакции — область HUD
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::CHORD);
+    NativeApp::run(1500);
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::CHORD);
+    NativeApp::run(500);
+
+    TEST_ASSERT_EQUAL_UINT32(2, histCount(UiTag::SETTINGS));
+    TEST_ASSERT_EQUAL_UINT32(0, screenManager.latency().noReaction());
+    TEST_ASSERT_EQUAL_STRING("S:L.c", screenManager.latency().lastLabel());
+}
+
+// ============================================================================
+// dump: открытая корзина
+// ============================================================================
+static void test_dump_open_bucket() {
+
+    // Кадр-реакция опоздал на 1.5 с — последняя корзина
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::SHORT_PRESS);
+    Native::advanceMs(1500);
+    NativeApp::run(100);
+
+    TEST_ASSERT_EQUAL_UINT32(1, histCount(UiTag::SETTINGS));
+
+    StringPrint out;
+    screenManager.latency().dump(out);
+    printf("%s", out.text.c_str());
+
+    TEST_ASSERT_TRUE(out.text.find("p50>=1024ms p90>=1024ms") != std::string::npos);
+    TEST_ASSERT_TRUE(out.text.find("<2048ms") == std::string::npos);
+}
+
+int main() {
+    NativeApp::begin();
+    if (!NativeApp::waitForecast()) {
+        printf("forecast did not load: %s\n", forecastService.lastError());
+        return 1;
+    }
+    NativeApp::run(2000);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_no_effect_press_is_not_closed_by_pulse);
+    RUN_TEST(test_screen_switch_is_measured);
+    RUN_TEST(test_forecast_slide_is_measured);
+    RUN_TEST(test_settings_cursor_is_measured);
+    RUN_TEST(test_hud_chord_is_measured);
+    RUN_TEST(test_dump_open_bucket);
+    return UNITY_END();
+}
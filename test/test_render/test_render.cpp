@@ -0,0 +1,82 @@
+/*
+ * test_render
+ * -----------
+ * Кадры Clock / Forecast / Settings на хосте против эталонных PNG.
+ *
+ * Кадр берётся из модели панели (то, что реально ушло по SPI), а
+ * не из снимка компоновщика; снимок (captureFrame) обязан совпасть
+ * с панелью — иначе частичные перерисовки разошлись с полным кадром.
+ *
+ * Обновить эталоны: UPDATE_GOLDENS=1 pio test -e native -f test_render
+ */
+
+#include <unity.h>
+
+#include <vector>
+
+#include "NativeApp.h"
+#include "Golden.h"
+
+static const std::string GOLDEN = GOLDEN_DIR(__FILE__);
+
+static void checkFrame(const char* name) {
+
+    const int w = tft.width();
+    const int h = tft.height();
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+
+    std::vector<uint16_t> captured((size_t)w * h);
+    screenManager.captureFrame(captured.data());
+
+    const uint16_t* panel = tft.nativeFrame();
+    uint32_t mismatch = 0;
+    for (int i = 0; i < w * h; i++) {
+        if (captured[i] != panel[i]) mismatch++;
+    }
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, mismatch, "panel != captureFrame");
+
+    const Golden::Result r = Golden::check(GOLDEN, name, panel, w, h);
+    TEST_ASSERT_TRUE_MESSAGE(r.ok, r.message.c_str());
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_clock() {
+    NativeApp::run(2000);
+    checkFrame("clock");
+}
+
+static void test_forecast() {
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::LONG_PRESS);
+    NativeApp::run(2000);
+    checkFrame("forecast");
+}
+
+static void test_forecast_next_day() {
+    NativeApp::press(ButtonId::RIGHT);
+    NativeApp::run(2000);
+    checkFrame("forecast_day2");
+}
+
+static void test_settings() {
+    NativeApp::press(ButtonId::OK, ButtonEventType::LONG_PRESS);
+    NativeApp::run(2000);
+    checkFrame("settings");
+}
+
+int main() {
+    NativeApp::begin();
+    if (!NativeApp::waitForecast()) {
+        printf("forecast did not load: %s (requests=%u)\n", forecastService.lastError(), (unsigned)Native::httpRequests());
+        return 1;
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_clock);
+    RUN_TEST(test_forecast);
+    RUN_TEST(test_forecast_next_day);
+    RUN_TEST(test_settings);
+    return UNITY_END();
+}
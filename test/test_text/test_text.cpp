@@ -0,0 +1,142 @@
+/*
+ * test_text
+ * ---------
+ * Текст спанами (UiDisplay::write → TextRenderer → blit) против
+ * посимвольного Adafruit_GFX::write на модели панели.
+ *
+ *  - кадр: спан обязан дать те же пиксели, что и GFX
+ *  - бенч: символов в секунду (хост, вместе с моделью панели) и
+ *    байт SPI на символ (2 * пиксели + 11 * окна) — второе
+ *    переносится на ESP32 как есть, первое — только соотношением
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <string.h>
+#include <vector>
+
+#include "NativeApp.h"
+
+static constexpr uint32_t ROUNDS = 2000;
+
+// Типичная строка статус-бара / меню
+static const char LABEL[] = "10:42  22.4C 41% -58dBm";
+
+static uint32_t bytesOf(const UiDisplay::Traffic& t) {
+    return 2 * t.pixels + 11 * t.windows;
+}
+
+static void drawGfx(const char* s) {
+    while (*s) tft.Adafruit_GFX::write((uint8_t)*s++);
+}
+
+static void drawSpan(const char* s) {
+    tft.print(s);
+}
+
+// Кусок панели под строкой
+static std::vector<uint16_t> grab(int16_t x, int16_t y, int16_t w, int16_t h) {
+    std::vector<uint16_t> out;
+    const uint16_t* panel = tft.nativeFrame();
+    for (int16_t r = 0; r < h; r++) {
+        out.insert(out.end(), panel + (y + r) * tft.width() + x,
+                              panel + (y + r) * tft.width() + x + w);
+    }
+    return out;
+}
+
+static std::vector<uint16_t> renderWith(void (*draw)(const char*), uint8_t size) {
+    const int16_t w = (int16_t)(strlen(LABEL) * TextRenderer::CELL_W * size);
+    const int16_t h = (int16_t)(TextRenderer::CELL_H * size);
+    const int16_t cw = w < tft.width() ? w : tft.width();
+
+    tft.fillRect(0, 0, tft.width(), h, 0x0000);
+    tft.setTextWrap(false);
+    tft.setTextSize(size);
+    tft.setTextColor(0xFFE0, 0x001F);
+    tft.setCursor(0, 0);
+    draw(LABEL);
+
+    return grab(0, 0, cw, h);
+}
+
+void setUp() {
+    tft.setTag(UiTag::OTHER);
+}
+
+void tearDown() {}
+
+// ============================================================================
+// спан == GFX
+// ============================================================================
+static void test_span_matches_gfx() {
+    for (uint8_t size = 1; size <= 3; size++) {
+        const std::vector<uint16_t> gfx  = renderWith(drawGfx, size);
+        const std::vector<uint16_t> span = renderWith(drawSpan, size);
+
+        TEST_ASSERT_EQUAL_UINT32(gfx.size(), span.size());
+        TEST_ASSERT_TRUE_MESSAGE(gfx == span, "span text != Adafruit_GFX");
+    }
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+// ============================================================================
+// бенч
+// ============================================================================
+struct TextBench {
+    double   charsPerSec;
+    uint32_t bytesPerChar;
+};
+
+static TextBench bench(void (*draw)(const char*)) {
+
+    const uint32_t n = (uint32_t)strlen(LABEL);
+
+    tft.setTextWrap(false);
+    tft.setTextSize(1);
+    tft.setTextColor(0xFFFF, 0x0000);
+    tft.resetTraffic();
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ROUNDS; i++) {
+        tft.setCursor(0, (int16_t)((i % 8) * TextRenderer::CELL_H));
+        draw(LABEL);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double s = std::chrono::duration<double>(t1 - t0).count();
+
+    TextBench r;
+    r.charsPerSec  = (double)n * ROUNDS / s;
+    r.bytesPerChar = bytesOf(tft.traffic(UiTag::OTHER)) / (n * ROUNDS);
+    return r;
+}
+
+static void test_bench_chars_per_second() {
+
+    const TextBench gfx  = bench(drawGfx);
+
+    const uint32_t spanChars = tft.textChars();
+    const TextBench span = bench(drawSpan);
+
+    // Строка действительно ушла спанами, а не откатилась на GFX
+    TEST_ASSERT_EQUAL_UINT32(strlen(LABEL) * ROUNDS, tft.textChars() - spanChars);
+
+    printf("[BENCH] size 1 text: GFX %.0f chars/s, %u B/char; "
+           "span %.0f chars/s, %u B/char\n",
+           gfx.charsPerSec,  (unsigned)gfx.bytesPerChar,
+           span.charsPerSec, (unsigned)span.bytesPerChar);
+
+    TEST_ASSERT_LESS_THAN_UINT32(gfx.bytesPerChar, span.bytesPerChar);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+int main() {
+    NativeApp::begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_span_matches_gfx);
+    RUN_TEST(test_bench_chars_per_second);
+    return UNITY_END();
+}
@@ -0,0 +1,121 @@
+/*
+ * test_time_service
+ * -----------------
+ * TimeService: sample() (ядро сервисов) + update() (ядро UI) на
+ * разовом времени RTC.
+ *
+ *  - LOCAL_ONLY: sample() не забирает время у providers — разовое
+ *    время RTC доживает до возврата в AUTO
+ *  - CLOCK публикуется раз в секунду (и на время provider), а не на
+ *    каждый sample() — loop() не будится впустую
+ */
+
+#include <unity.h>
+
+#include "NativeApp.h"
+
+// Разовое время: hasTime() до первого takeTime(), как RtcTimeProvider
+class OneShotProvider : public TimeProvider {
+public:
+    void update() override { _updates++; }
+    bool hasTime() const override { return !_taken; }
+
+    TimeResult takeTime() override {
+        _taken = true;
+        TimeResult r;
+        const time_t t = NativeApp::EPOCH;
+        localtime_r(&t, &r.time);
+        r.valid = true;
+        return r;
+    }
+
+    bool     taken()   const { return _taken; }
+    uint32_t updates() const { return _updates; }
+
+private:
+    bool     _taken   = false;
+    uint32_t _updates = 0;
+};
+
+static void step(TimeService& ts, int n) {
+    for (int i = 0; i < n; i++) {
+        ts.sample();
+        ts.update();
+        Native::advanceMs(50);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_local_only_keeps_rtc_time() {
+
+    EventBus        localBus;
+    TimeService     ts(localBus);
+    OneShotProvider rtc;
+    NativeApp::NoTimeProvider ntp;
+
+    ts.registerProvider(rtc);
+    ts.registerProvider(ntp);
+    ts.setMode(TimeService::LOCAL_ONLY);
+    ts.begin();
+
+    step(ts, 20);
+
+    TEST_ASSERT_FALSE_MESSAGE(rtc.taken(), "LOCAL_ONLY consumed the RTC one-shot");
+    TEST_ASSERT_EQUAL_UINT32(0, rtc.updates());
+    TEST_ASSERT_EQUAL_INT(TimeService::NONE, ts.source());
+
+    ts.setMode(TimeService::RTC_ONLY);
+    step(ts, 2);
+
+    TEST_ASSERT_TRUE(rtc.taken());
+    TEST_ASSERT_EQUAL_INT(TimeService::RTC, ts.source());
+    TEST_ASSERT_TRUE(ts.isValid());
+}
+
+static void test_auto_takes_rtc_time() {
+
+    EventBus        localBus;
+    TimeService     ts(localBus);
+    OneShotProvider rtc;
+    NativeApp::NoTimeProvider ntp;
+
+    ts.registerProvider(rtc);
+    ts.registerProvider(ntp);
+    ts.begin();
+
+    step(ts, 2);
+
+    TEST_ASSERT_TRUE(rtc.taken());
+    TEST_ASSERT_EQUAL_INT(TimeService::RTC, ts.source());
+}
+
+static void test_clock_channel_once_per_second() {
+
+    EventBus    localBus;
+    TimeService ts(localBus);
+    NativeApp::NoTimeProvider ntp;
+
+    ts.registerProvider(ntp);
+    ts.begin();
+
+    // 5 с по 50 мс — 100 sample()
+    const uint32_t v0 = localBus.version(UiChannel::CLOCK);
+    step(ts, 100);
+    const uint32_t n = localBus.version(UiChannel::CLOCK) - v0;
+
+    printf("[TIME] CLOCK publishes over 100 samples: %u\n", (unsigned)n);
+    TEST_ASSERT_UINT32_WITHIN(1, 5, n);
+}
+
+int main() {
+    Native::setUs(1000000);
+    Native::setEpoch(NativeApp::EPOCH);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_local_only_keeps_rtc_time);
+    RUN_TEST(test_auto_takes_rtc_time);
+    RUN_TEST(test_clock_channel_once_per_second);
+    return UNITY_END();
+}
@@ -0,0 +1,109 @@
+/*
+ * test_timeline
+ * -------------
+ * Дорожки Timeline на заданных часах: значения, цепочки, петли,
+ * вырожденные длительности.
+ */
+
+#include <unity.h>
+
+#include "core/Timeline.h"
+
+// Граф прошивки не нужен, но src линкуется целиком (extern prefs)
+#include "NativeApp.h"
+
+static Timeline tl;
+static uint32_t nowMs;
+
+static void tickTo(uint32_t ms) {
+    nowMs = ms;
+    tl.tick(nowMs);
+}
+
+static void countDone(void* ctx) {
+    (*(int*)ctx)++;
+}
+
+void setUp() {
+    tl    = Timeline();
+    nowMs = 1000;
+    tl.tick(nowMs);
+}
+
+void tearDown() {}
+
+static void test_linear_track() {
+    static const Timeline::Spec S = { 0, Q16_ONE, 100, 0, Timeline::Ease::LINEAR, false };
+
+    int done = 0;
+    const Timeline::Id id = tl.start(S, countDone, &done);
+
+    tickTo(1050);
+    TEST_ASSERT_INT_WITHIN(1, Q16_HALF, tl.value(id, -1));
+    TEST_ASSERT_TRUE(tl.anyActive());
+
+    tickTo(1100);
+    TEST_ASSERT_FALSE(tl.active(id));
+    TEST_ASSERT_EQUAL_INT(1, done);
+    TEST_ASSERT_EQUAL_INT(-1, tl.value(id, -1));
+}
+
+static void test_zero_duration_track_ends_at_to() {
+    static const Timeline::Spec S = { 0, Q16_ONE, 0, 0, Timeline::Ease::LINEAR, false };
+
+    int done = 0;
+    const Timeline::Id id = tl.start(S, countDone, &done);
+
+    tickTo(1000);
+    TEST_ASSERT_FALSE(tl.active(id));
+    TEST_ASSERT_EQUAL_INT(1, done);
+}
+
+static void test_zero_duration_loop_holds_to() {
+    static const Timeline::Spec S = { 0, Q16_ONE, 0, 0, Timeline::Ease::PULSE, true };
+
+    const Timeline::Id id = tl.start(S);
+
+    for (uint32_t ms = 1000; ms < 1100; ms += 7) {
+        tickTo(ms);
+        TEST_ASSERT_TRUE(tl.active(id));
+        TEST_ASSERT_EQUAL_INT(Q16_ONE, tl.value(id, -1));
+    }
+
+    // Петля — фоновая: темп кадров не держит
+    TEST_ASSERT_FALSE(tl.anyActive());
+}
+
+static void test_loop_wraps() {
+    static const Timeline::Spec S = { 0, Q16_ONE, 100, 0, Timeline::Ease::LINEAR, true };
+
+    const Timeline::Id id = tl.start(S);
+
+    tickTo(1025);
+    const q16_t first = tl.value(id, -1);
+    tickTo(1325);
+    TEST_ASSERT_EQUAL_INT(first, tl.value(id, -1));
+}
+
+static void test_chain_starts_at_end_of_previous() {
+    static const Timeline::Spec A = { 0, Q16_ONE, 100, 0, Timeline::Ease::LINEAR, false };
+    static const Timeline::Spec B = { Q16_ONE, 0, 100, 0, Timeline::Ease::LINEAR, false };
+
+    const Timeline::Id first  = tl.start(A);
+    const Timeline::Id second = tl.chain(first, B);
+
+    // Кадр опоздал: первая кончилась в 1100, вторая идёт от 1100, а не от 1130
+    tickTo(1130);
+    TEST_ASSERT_FALSE(tl.active(first));
+    TEST_ASSERT_INT_WITHIN(1, Q16_ONE - Q16_ONE * 3 / 10, tl.value(second, -1));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_linear_track);
+    RUN_TEST(test_zero_duration_track_ends_at_to);
+    RUN_TEST(test_zero_duration_loop_holds_to);
+    RUN_TEST(test_loop_wraps);
+    RUN_TEST(test_chain_starts_at_end_of_previous);
+    return UNITY_END();
+}
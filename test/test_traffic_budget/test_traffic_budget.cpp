@@ -0,0 +1,157 @@
+/*
+ * test_traffic_budget
+ * -------------------
+ * SPI-трафик эталонных сценариев по тегам (UiDisplay::traffic) против
+ * верхних границ: пиксели, окна адреса, транзакции.
+ *
+ * Граница = замер на момент записи + запас ~25 % (округлено вверх).
+ * Тег без строки в таблице сценария обязан молчать (0 / 0 / 0).
+ * Упёрлись в границу — смотреть, какой виджет стал слать больше,
+ * а не поднимать число.
+ */
+
+#include <unity.h>
+
+#include "NativeApp.h"
+
+struct Budget {
+    UiTag    tag;
+    uint32_t pixels;
+    uint32_t windows;
+    uint32_t transactions;
+};
+
+static void report(const char* scenario) {
+    printf("[BUDGET] %s\n", scenario);
+    tft.dumpTraffic(Serial);
+}
+
+template <size_t N>
+static void checkBudget(const char* scenario, const Budget (&budget)[N]) {
+
+    report(scenario);
+
+    char msg[128];
+
+    for (uint8_t i = 0; i < (uint8_t)UiTag::COUNT; i++) {
+        const UiTag tag = (UiTag)i;
+        const UiDisplay::Traffic& t = tft.traffic(tag);
+
+        const Budget* b = nullptr;
+        for (const Budget& x : budget) {
+            if (x.tag == tag) b = &x;
+        }
+
+        const uint32_t maxPx  = b ? b->pixels       : 0;
+        const uint32_t maxWin = b ? b->windows      : 0;
+        const uint32_t maxTr  = b ? b->transactions : 0;
+
+        snprintf(msg, sizeof(msg), "%s: %s pixels", scenario, uiTagName(tag));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(maxPx, t.pixels, msg);
+
+        snprintf(msg, sizeof(msg), "%s: %s windows", scenario, uiTagName(tag));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(maxWin, t.windows, msg);
+
+        snprintf(msg, sizeof(msg), "%s: %s transactions", scenario, uiTagName(tag));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(maxTr, t.transactions, msg);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, tft.nativeErrors(), "SPI protocol errors");
+}
+
+void setUp() {
+    tft.resetTraffic();
+}
+
+void tearDown() {}
+
+// Минута часов: 60 тиков секунд, минута сменилась один раз
+static void test_clock_minute() {
+    NativeApp::run(60000);
+
+    static const Budget BUDGET[] = {
+        { UiTag::CLOCK,     394000u, 902u, 902u },
+    };
+    checkBudget("clock 60 s", BUDGET);
+}
+
+// После окна пульса ":" часы в покое: FPS_STATIC, кадр — по секунде
+static void test_clock_idle_frames() {
+    TEST_ASSERT_EQUAL_UINT8(Screen::FPS_STATIC, clockScreen.targetFps());
+
+    const ScreenManager::FrameStats& st = screenManager.stats();
+    const uint32_t before = st.frames + st.skipped;
+    NativeApp::run(10000);
+    const uint32_t built = st.frames + st.skipped - before;
+
+    printf("[BUDGET] clock idle: %u frames built in 10 s\n", (unsigned)built);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(25u, built);
+}
+
+// Clock → Forecast: crossfade контента + полный кадр
+static void test_enter_forecast() {
+    NativeApp::press(ButtonId::LEFT, ButtonEventType::LONG_PRESS);
+    NativeApp::run(2000);
+
+    static const Budget BUDGET[] = {
+        { UiTag::STATUSBAR,  11200u, 20u, 10u },
+        { UiTag::BUTTONBAR,  10900u, 10u, 10u },
+        { UiTag::SEPARATOR,    400u,  2u,  2u },
+        { UiTag::BANDS,     109200u, 44u,  9u },
+    };
+    checkBudget("enter forecast", BUDGET);
+}
+
+// Следующий день: слайд карточек
+static void test_forecast_slide() {
+    NativeApp::press(ButtonId::RIGHT);
+    NativeApp::run(2000);
+
+    static const Budget BUDGET[] = {
+        { UiTag::BANDS,      78000u, 32u,  7u },
+    };
+    checkBudget("forecast slide", BUDGET);
+}
+
+// Forecast → Settings
+static void test_enter_settings() {
+    NativeApp::press(ButtonId::OK, ButtonEventType::LONG_PRESS);
+    NativeApp::run(2000);
+
+    static const Budget BUDGET[] = {
+        { UiTag::STATUSBAR,  11200u, 20u, 10u },
+        { UiTag::BUTTONBAR,  10900u, 10u, 10u },
+        { UiTag::SEPARATOR,    400u,  2u,  2u },
+        { UiTag::BANDS,     109200u, 44u,  9u },
+    };
+    checkBudget("enter settings", BUDGET);
+}
+
+// Курсор меню вниз: две строки списка
+static void test_settings_cursor() {
+    NativeApp::press(ButtonId::RIGHT);
+    NativeApp::run(1000);
+
+    static const Budget BUDGET[] = {
+        { UiTag::SETTINGS,   10740u,  7u,  7u },
+    };
+    checkBudget("settings cursor", BUDGET);
+}
+
+int main() {
+    NativeApp::begin();
+    if (!NativeApp::waitForecast()) {
+        printf("forecast did not load: %s\n", forecastService.lastError());
+        return 1;
+    }
+    NativeApp::run(2000);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_clock_minute);
+    RUN_TEST(test_clock_idle_frames);
+    RUN_TEST(test_enter_forecast);
+    RUN_TEST(test_forecast_slide);
+    RUN_TEST(test_enter_settings);
+    RUN_TEST(test_settings_cursor);
+    return UNITY_END();
+}